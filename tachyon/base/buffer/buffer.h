@@ -4,15 +4,18 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <iostream>
 #include <type_traits>
 #include <utility>
 
 #include "absl/base/internal/endian.h"
+#include "absl/types/span.h"
 
 #include "tachyon/base/buffer/copyable_forward.h"
 #include "tachyon/base/endian.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/checked_math.h"
 
 namespace tachyon::base {
 namespace internal {
@@ -36,6 +39,14 @@ struct IsNonBuiltinSerializable<
 
 }  // namespace internal
 
+// Every bit pattern of an arithmetic type is a valid value except for bool.
+template <typename T>
+class TriviallySerializable<
+    T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>> {
+ public:
+  static bool IsValid(const T& value) { return true; }
+};
+
 // Buffer policy:
 // It tries to write / read as much as possible.
 // If errors occur during write or read, it is because the requested
@@ -59,6 +70,12 @@ class TACHYON_EXPORT Buffer {
   }
   virtual ~Buffer() = default;
 
+  // Returns a buffer that reads from the |buffer|, e.g., a memory mapped file.
+  // It is const, so that nothing can be written to the |buffer|.
+  static const Buffer CreateReadOnly(const void* buffer, size_t buffer_len) {
+    return Buffer(const_cast<void*>(buffer), buffer_len);
+  }
+
   Endian endian() const { return endian_; }
   void set_endian(Endian endian) { endian_ = endian; }
 
@@ -66,7 +83,7 @@ class TACHYON_EXPORT Buffer {
   const void* buffer() const { return buffer_; }
 
   size_t buffer_offset() const { return buffer_offset_; }
-  void set_buffer_offset(size_t buffer_offset) {
+  void set_buffer_offset(size_t buffer_offset) const {
     buffer_offset_ = buffer_offset;
   }
 
@@ -136,6 +153,44 @@ class TACHYON_EXPORT Buffer {
     return ReadAt(buffer_offset_, std::forward<T>(value));
   }
 
+  // Reads |values.size()| values written by |WriteRaw()| into |values|. If
+  // |validate| is true, each value is checked by
+  // |TriviallySerializable<T>::IsValid()|, which is needed unless the buffer
+  // is trusted.
+  template <typename T>
+  [[nodiscard]] bool ReadRaw(absl::Span<T> values,
+                             bool validate = false) const {
+    static_assert(IsTriviallySerializable<T>::value);
+    size_t size;
+    if (!CheckMul(values.size(), sizeof(T)).AssignIfValid(&size)) return false;
+    if (!Read(reinterpret_cast<uint8_t*>(values.data()), size)) return false;
+    return !validate || AreValid(absl::Span<const T>(values));
+  }
+
+  // Same as above, but sets |values| to the view of |size| values in this
+  // buffer without a copy. |values| is valid as long as the memory of this
+  // buffer is. Returns false if the values aren't aligned for |T|.
+  template <typename T>
+  [[nodiscard]] bool ReadRawView(size_t size, absl::Span<const T>* values,
+                                 bool validate = false) const {
+    static_assert(IsTriviallySerializable<T>::value);
+    size_t bytes;
+    if (!CheckMul(size, sizeof(T)).AssignIfValid(&bytes)) return false;
+    size_t size_needed;
+    if (!CheckAdd(buffer_offset_, bytes).AssignIfValid(&size_needed)) {
+      return false;
+    }
+    if (size_needed > buffer_len_) return false;
+    const uint8_t* data =
+        reinterpret_cast<const uint8_t*>(buffer_) + buffer_offset_;
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) return false;
+    absl::Span<const T> view(reinterpret_cast<const T*>(data), size);
+    if (validate && !AreValid(view)) return false;
+    *values = view;
+    buffer_offset_ = size_needed;
+    return true;
+  }
+
   template <typename T>
   [[nodiscard]] bool ReadMany(T&& value) const {
     return Read(std::forward<T>(value));
@@ -168,6 +223,19 @@ class TACHYON_EXPORT Buffer {
     return WriteAt(buffer_offset_, value);
   }
 
+  // Writes |values| as their bytes in memory with a single bounds check and
+  // a memcpy. Unlike |Write()|, neither |Copyable<T>| nor |endian()| is
+  // applied, so that, for example, prime fields are written in their
+  // Montgomery forms. The size isn't written, and the bytes can be read back
+  // by |ReadRaw()| only on a machine with the same layout of |T|.
+  template <typename T>
+  [[nodiscard]] bool WriteRaw(absl::Span<const T> values) {
+    static_assert(IsTriviallySerializable<T>::value);
+    size_t size;
+    if (!CheckMul(values.size(), sizeof(T)).AssignIfValid(&size)) return false;
+    return Write(reinterpret_cast<const uint8_t*>(values.data()), size);
+  }
+
   template <typename T>
   [[nodiscard]] bool WriteMany(const T& value) {
     return Write(value);
@@ -248,6 +316,13 @@ class TACHYON_EXPORT Buffer {
   [[nodiscard]] virtual bool Grow(size_t size) { return false; }
 
  protected:
+  template <typename T>
+  static bool AreValid(absl::Span<const T> values) {
+    return std::all_of(values.begin(), values.end(), [](const T& value) {
+      return TriviallySerializable<T>::IsValid(value);
+    });
+  }
+
   bool Read16BEAt(size_t buffer_offset, uint16_t* ptr) const;
   bool Read16LEAt(size_t buffer_offset, uint16_t* ptr) const;
   bool Read32BEAt(size_t buffer_offset, uint32_t* ptr) const;
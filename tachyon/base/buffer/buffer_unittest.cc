@@ -1,3 +1,6 @@
+#include <limits>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -6,6 +9,22 @@
 
 namespace tachyon::base {
 
+namespace {
+
+struct EvenNumber {
+  uint32_t value;
+};
+
+}  // namespace
+
+template <>
+class TriviallySerializable<EvenNumber> {
+ public:
+  static bool IsValid(const EvenNumber& number) {
+    return number.value % 2 == 0;
+  }
+};
+
 TEST(CopyableTest, BuiltInSerializableTest) {
 #define TEST_BUILTIN_TYPES(type)                                   \
   EXPECT_TRUE(base::internal::IsBuiltinSerializable<type>::value); \
@@ -135,4 +154,84 @@ TEST(BufferTest, WriteMany) {
   }
 }
 
+TEST(BufferTest, WriteRaw) {
+  std::vector<uint64_t> values = {1, 2, 3, 4};
+
+  Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.WriteRaw(absl::MakeConstSpan(values)));
+  EXPECT_EQ(write_buf.buffer_len(), values.size() * sizeof(uint64_t));
+
+  Buffer read_buf(write_buf.buffer(), write_buf.buffer_len());
+  std::vector<uint64_t> read_values(values.size());
+  ASSERT_TRUE(read_buf.ReadRaw(absl::MakeSpan(read_values)));
+  EXPECT_EQ(read_values, values);
+  ASSERT_TRUE(read_buf.Done());
+  EXPECT_FALSE(read_buf.ReadRaw(absl::MakeSpan(read_values)));
+
+  read_buf.set_buffer_offset(0);
+  absl::Span<const uint64_t> view;
+  ASSERT_TRUE(read_buf.ReadRawView(values.size(), &view));
+  EXPECT_EQ(view.data(), write_buf.buffer());
+  EXPECT_EQ(view, absl::MakeConstSpan(values));
+  ASSERT_TRUE(read_buf.Done());
+  EXPECT_FALSE(read_buf.ReadRawView(1, &view));
+}
+
+TEST(BufferTest, CreateReadOnly) {
+  const std::vector<uint64_t> values = {1, 2};
+
+  const Buffer read_buf = Buffer::CreateReadOnly(
+      values.data(), values.size() * sizeof(uint64_t));
+  uint64_t value;
+  ASSERT_TRUE(read_buf.Read(&value));
+  EXPECT_EQ(value, values[0]);
+  ASSERT_TRUE(read_buf.Read(&value));
+  EXPECT_EQ(value, values[1]);
+  ASSERT_TRUE(read_buf.Done());
+}
+
+TEST(BufferTest, ReadRawWithValidation) {
+  std::vector<EvenNumber> numbers = {{2}, {3}};
+
+  Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.WriteRaw(absl::MakeConstSpan(numbers)));
+
+  Buffer read_buf(write_buf.buffer(), write_buf.buffer_len());
+  std::vector<EvenNumber> read_numbers(numbers.size());
+  EXPECT_TRUE(read_buf.ReadRaw(absl::MakeSpan(read_numbers)));
+  read_buf.set_buffer_offset(0);
+  EXPECT_FALSE(read_buf.ReadRaw(absl::MakeSpan(read_numbers), true));
+
+  read_buf.set_buffer_offset(0);
+  absl::Span<const EvenNumber> view;
+  EXPECT_TRUE(read_buf.ReadRawView(1, &view, true));
+  EXPECT_FALSE(read_buf.ReadRawView(1, &view, true));
+}
+
+TEST(CopyableTest, VectorInBulk) {
+  std::vector<uint32_t> values = {1, 2, 3};
+
+  // A vector of builtin types is written as its bytes in memory in the
+  // native byte order, which is the same as writing them one by one.
+  Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Write(values));
+  Uint8VectorBuffer expected_buf;
+  ASSERT_TRUE(expected_buf.Write(values.size()));
+  for (uint32_t value : values) {
+    ASSERT_TRUE(expected_buf.Write(value));
+  }
+  EXPECT_EQ(write_buf.owned_buffer(), expected_buf.owned_buffer());
+
+  write_buf.set_buffer_offset(0);
+  std::vector<uint32_t> read_values;
+  ASSERT_TRUE(write_buf.Read(&read_values));
+  EXPECT_EQ(read_values, values);
+
+  // The size is checked against the buffer before the allocation.
+  Uint8VectorBuffer corrupted_buf;
+  ASSERT_TRUE(corrupted_buf.Write(std::numeric_limits<size_t>::max()));
+  corrupted_buf.set_buffer_offset(0);
+  EXPECT_FALSE(corrupted_buf.Read(&read_values));
+}
+
 }  // namespace tachyon::base
@@ -1,11 +1,14 @@
 #ifndef TACHYON_BASE_BUFFER_COPYABLE_H_
 #define TACHYON_BASE_BUFFER_COPYABLE_H_
 
+#include <algorithm>
 #include <array>
 #include <numeric>
 #include <string>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/buffer.h"
 #include "tachyon/base/buffer/copyable_forward.h"
 #include "tachyon/base/logging.h"
@@ -118,6 +121,9 @@ class Copyable<std::vector<T>> {
  public:
   static bool WriteTo(const std::vector<T>& values, Buffer* buffer) {
     if (!buffer->Write(values.size())) return false;
+    if (CanCopyInBulk(*buffer)) {
+      return buffer->WriteRaw(absl::MakeConstSpan(values));
+    }
     for (const T& value : values) {
       if (!buffer->Write(value)) return false;
     }
@@ -127,6 +133,17 @@ class Copyable<std::vector<T>> {
   static bool ReadFrom(const Buffer& buffer, std::vector<T>* values) {
     size_t size;
     if (!buffer.Read(&size)) return false;
+    if (CanCopyInBulk(buffer)) {
+      // Checks the size before the allocation, which a corrupted |size| would
+      // make huge.
+      if (size > (buffer.buffer_len() -
+                  std::min(buffer.buffer_offset(), buffer.buffer_len())) /
+                     sizeof(T)) {
+        return false;
+      }
+      values->resize(size);
+      return buffer.ReadRaw(absl::MakeSpan(*values));
+    }
     values->resize(size);
     for (T& value : (*values)) {
       if (!buffer.Read(&value)) return false;
@@ -140,6 +157,20 @@ class Copyable<std::vector<T>> {
                              return total + base::EstimateSize(value);
                            });
   }
+
+ private:
+  // The builtin types are written as their bytes in memory in the native
+  // byte order, so that they are copied with a single memcpy in the same
+  // format. Other trivially serializable types, e.g., prime fields, are
+  // written in a different format by |Copyable<T>|.
+  static bool CanCopyInBulk(const Buffer& buffer) {
+    if constexpr (internal::IsBuiltinSerializable<T>::value &&
+                  IsTriviallySerializable<T>::value) {
+      return buffer.endian() == Endian::kNative;
+    } else {
+      return false;
+    }
+  }
 };
 
 template <typename T, size_t N>
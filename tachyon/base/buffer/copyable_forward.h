@@ -29,6 +29,25 @@ struct IsCopyable<
         decltype(Copyable<T>::EstimateSize(std::declval<const T&>()))>>
     : std::true_type {};
 
+// Specialize this to declare that |T| is trivially serializable, that is, an
+// array of |T| can be written and read in bulk as its bytes in memory. See
+// |Buffer::WriteRaw()|. The specialization defines
+// |static bool IsValid(const T& value)|, which checks a value read from an
+// untrusted buffer. If not every byte pattern of a member is valid, e.g., a
+// bool, |IsValid()| checks its bytes before the member is read. The padding of
+// |T|, if any, is written as it is in memory.
+template <typename T, typename SFINAE = void>
+class TriviallySerializable;
+
+template <typename, typename = void>
+struct IsTriviallySerializable : std::false_type {};
+
+template <typename T>
+struct IsTriviallySerializable<
+    T, std::void_t<decltype(TriviallySerializable<T>::IsValid(
+           std::declval<const T&>()))>>
+    : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
 template <typename T>
 size_t EstimateSize(const T& value) {
   return Copyable<T>::EstimateSize(value);
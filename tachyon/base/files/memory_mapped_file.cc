@@ -0,0 +1,104 @@
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::base {
+
+MemoryMappedFile::~MemoryMappedFile() { CloseHandles(); }
+
+bool MemoryMappedFile::Initialize(const FilePath& file_name) {
+  return Initialize(File(file_name, File::FLAG_OPEN | File::FLAG_READ));
+}
+
+bool MemoryMappedFile::Initialize(File file) {
+  if (IsValid()) {
+    LOG(ERROR) << "The file is already mapped";
+    return false;
+  }
+  file_ = std::move(file);
+  if (!MapFileToMemory()) {
+    CloseHandles();
+    return false;
+  }
+  return true;
+}
+
+bool MemoryMappedFile::Advise(size_t offset, size_t length,
+                              Advice advice) const {
+  if (!IsValid()) {
+    LOG(ERROR) << "The file is not mapped";
+    return false;
+  }
+  if (offset > length_ || length > length_ - offset) {
+    LOG(ERROR) << "The range is out of the file";
+    return false;
+  }
+  if (length == 0) return true;
+
+  int native_advice;
+  switch (advice) {
+    case Advice::kWillNeed:
+      native_advice = MADV_WILLNEED;
+      break;
+    case Advice::kHugePage:
+#if defined(MADV_HUGEPAGE)
+      native_advice = MADV_HUGEPAGE;
+      break;
+#else
+      LOG(ERROR) << "Huge pages are not supported";
+      return false;
+#endif
+  }
+
+  // |madvise()| requires the address to be aligned to the page size.
+  size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t aligned_offset = offset - offset % page_size;
+  if (madvise(data_ + aligned_offset, length + (offset - aligned_offset),
+              native_advice) != 0) {
+    PLOG(ERROR) << "Failed to madvise";
+    return false;
+  }
+  return true;
+}
+
+bool MemoryMappedFile::MapFileToMemory() {
+  if (!file_.IsValid()) {
+    LOG(ERROR) << "Failed to open the file: "
+               << File::ErrorToString(file_.error_details());
+    return false;
+  }
+
+  int64_t file_len = file_.GetLength();
+  if (file_len <= 0) {
+    LOG(ERROR) << "Failed to map an empty file";
+    return false;
+  }
+
+  void* data = mmap(nullptr, static_cast<size_t>(file_len), PROT_READ,
+                    MAP_SHARED, file_.GetPlatformFile(), 0);
+  if (data == MAP_FAILED) {
+    PLOG(ERROR) << "Failed to mmap";
+    return false;
+  }
+  data_ = static_cast<uint8_t*>(data);
+  length_ = static_cast<size_t>(file_len);
+  // The mapping stays valid after the file descriptor is closed.
+  file_.Close();
+  return true;
+}
+
+void MemoryMappedFile::CloseHandles() {
+  if (data_ != nullptr) {
+    munmap(data_, length_);
+  }
+  file_.Close();
+  data_ = nullptr;
+  length_ = 0;
+}
+
+}  // namespace tachyon::base
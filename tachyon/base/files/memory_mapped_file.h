@@ -0,0 +1,66 @@
+#ifndef TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+#define TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+
+namespace tachyon::base {
+
+// Maps a whole file into memory as read-only. The mapping is released when
+// this is destroyed, so the views of |data()| must not outlive this.
+class TACHYON_EXPORT MemoryMappedFile {
+ public:
+  // Hints about how the mapped memory is going to be accessed. These are only
+  // hints, so the kernel may ignore them.
+  enum class Advice {
+    // The range will be accessed soon, so that it is read ahead.
+    kWillNeed,
+    // The range is backed by huge pages if the file system supports it. This
+    // reduces TLB misses on random accesses to a large file.
+    kHugePage,
+  };
+
+  MemoryMappedFile() = default;
+  MemoryMappedFile(const MemoryMappedFile& other) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+  ~MemoryMappedFile();
+
+  const uint8_t* data() const { return data_; }
+  size_t length() const { return length_; }
+  absl::Span<const uint8_t> bytes() const {
+    return absl::MakeConstSpan(data_, length_);
+  }
+
+  // Opens an existing file at |file_name| and maps it into memory. Returns
+  // false if the file can't be opened or mapped, or if it is empty.
+  [[nodiscard]] bool Initialize(const FilePath& file_name);
+  // Same as above, but it takes the ownership of an already opened |file|.
+  [[nodiscard]] bool Initialize(File file);
+
+  bool IsValid() const { return data_ != nullptr; }
+
+  // Gives the |advice| for |length| bytes from |offset| of the mapped file.
+  // Returns false if the range is out of the file or the |advice| isn't
+  // supported on this platform.
+  [[nodiscard]] bool Advise(size_t offset, size_t length, Advice advice) const;
+
+ private:
+  // Maps |file_| into memory and closes it on success.
+  bool MapFileToMemory();
+
+  void CloseHandles();
+
+  File file_;
+  uint8_t* data_ = nullptr;
+  size_t length_ = 0;
+};
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_FILES_MEMORY_MAPPED_FILE_H_
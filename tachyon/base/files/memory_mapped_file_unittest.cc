@@ -0,0 +1,64 @@
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::base {
+
+TEST(MemoryMappedFileTest, Initialize) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  FilePath file_path = temp_dir.GetPath().Append("file");
+  constexpr std::string_view kData = "memory mapped file";
+  ASSERT_TRUE(WriteFile(file_path, kData));
+
+  MemoryMappedFile file;
+  EXPECT_FALSE(file.IsValid());
+  ASSERT_TRUE(file.Initialize(file_path));
+  EXPECT_TRUE(file.IsValid());
+  EXPECT_EQ(file.length(), kData.size());
+  EXPECT_EQ(std::string_view(reinterpret_cast<const char*>(file.data()),
+                             file.length()),
+            kData);
+  // A mapped file can't be initialized twice.
+  EXPECT_FALSE(file.Initialize(file_path));
+}
+
+TEST(MemoryMappedFileTest, Advise) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  FilePath file_path = temp_dir.GetPath().Append("file");
+  constexpr std::string_view kData = "memory mapped file";
+  ASSERT_TRUE(WriteFile(file_path, kData));
+
+  MemoryMappedFile file;
+  EXPECT_FALSE(file.Advise(0, 1, MemoryMappedFile::Advice::kWillNeed));
+  ASSERT_TRUE(file.Initialize(file_path));
+  EXPECT_TRUE(
+      file.Advise(0, kData.size(), MemoryMappedFile::Advice::kWillNeed));
+  EXPECT_TRUE(file.Advise(3, 5, MemoryMappedFile::Advice::kWillNeed));
+  EXPECT_FALSE(
+      file.Advise(3, kData.size(), MemoryMappedFile::Advice::kWillNeed));
+}
+
+TEST(MemoryMappedFileTest, InitializeWithInvalidFile) {
+  ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  MemoryMappedFile file;
+  EXPECT_FALSE(file.Initialize(temp_dir.GetPath().Append("nonexistent")));
+  EXPECT_FALSE(file.IsValid());
+
+  FilePath empty_file_path = temp_dir.GetPath().Append("empty");
+  ASSERT_TRUE(WriteFile(empty_file_path, ""));
+  EXPECT_FALSE(file.Initialize(empty_file_path));
+  EXPECT_FALSE(file.IsValid());
+}
+
+}  // namespace tachyon::base
@@ -9,6 +9,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/functional/functor_traits.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/threading/task_pool.h"
 
 namespace tachyon::base {
 
@@ -19,8 +20,26 @@ using ParallelizeCallback2 = std::function<void(absl::Span<T>, size_t)>;
 template <typename T>
 using ParallelizeCallback3 = std::function<void(absl::Span<T>, size_t, size_t)>;
 
-// Splits the |container| by |chunk_size| and executes |callback| in parallel.
-// See parallelize_unittest.cc for more details.
+namespace internal {
+
+// Like |GetNumElementsPerThread()|, but the |container| is split into as many
+// chunks as the tasks that the |TaskPool| runs at once. Unlike the number of
+// the OpenMP threads, this doesn't drop to 1 inside a task, so that a nested
+// |Parallelize()| still runs in parallel.
+template <typename Container>
+size_t GetNumElementsPerTask(const Container& container,
+                             std::optional<size_t> threshold) {
+  size_t task_nums = TaskPool::GetInstance().concurrency();
+  size_t size = std::size(container);
+  return (threshold.has_value() && size > threshold.value())
+             ? (size + task_nums - 1) / task_nums
+             : size;
+}
+
+}  // namespace internal
+
+// Splits the |container| by |chunk_size| and executes |callback| in parallel
+// on the |TaskPool|. See parallelize_unittest.cc for more details.
 template <typename Container, typename Callable,
           typename FunctorTraits = internal::MakeFunctorTraits<Callable>,
           typename RunType = typename FunctorTraits::RunType,
@@ -36,7 +55,7 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
   std::vector<SpanTy> chunks =
       base::Map(chunked_adapter.begin(), chunked_adapter.end(),
                 [](SpanTy chunk) { return chunk; });
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < chunks.size(); ++i) {
+  ParallelFor(chunks.size(), [&chunks, &callback, chunk_size](size_t i) {
     if constexpr (ArgNum == 1) {
       callback(chunks[i]);
     } else if constexpr (ArgNum == 2) {
@@ -45,7 +64,7 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
       static_assert(ArgNum == 3);
       callback(chunks[i], i, chunk_size);
     }
-  }
+  });
 }
 
 // Splits the |container| into threads and executes |callback| in parallel.
@@ -53,10 +72,9 @@ void ParallelizeByChunkSize(Container& container, size_t chunk_size,
 template <typename Container, typename Callable>
 void Parallelize(Container& container, Callable callback,
                  std::optional<size_t> threshold = std::nullopt) {
-  size_t num_elements_per_thread =
-      GetNumElementsPerThread(container, threshold);
-  ParallelizeByChunkSize(container, num_elements_per_thread,
-                         std::move(callback));
+  size_t num_elements_per_task =
+      internal::GetNumElementsPerTask(container, threshold);
+  ParallelizeByChunkSize(container, num_elements_per_task, std::move(callback));
 }
 
 // Splits the |container| by |chunk_size| and maps each chunk using the provided
@@ -82,16 +100,17 @@ std::vector<ReturnType> ParallelizeMapByChunkSize(Container& container,
                 [](SpanTy chunk) { return chunk; });
   std::vector<ReturnType> values;
   values.resize(chunks.size());
-  OPENMP_PARALLEL_FOR(size_t i = 0; i < chunks.size(); ++i) {
-    if constexpr (ArgNum == 1) {
-      values[i] = callback(chunks[i]);
-    } else if constexpr (ArgNum == 2) {
-      values[i] = callback(chunks[i], i);
-    } else {
-      static_assert(ArgNum == 3);
-      values[i] = callback(chunks[i], i, chunk_size);
-    }
-  }
+  ParallelFor(chunks.size(),
+              [&chunks, &callback, &values, chunk_size](size_t i) {
+                if constexpr (ArgNum == 1) {
+                  values[i] = callback(chunks[i]);
+                } else if constexpr (ArgNum == 2) {
+                  values[i] = callback(chunks[i], i);
+                } else {
+                  static_assert(ArgNum == 3);
+                  values[i] = callback(chunks[i], i, chunk_size);
+                }
+              });
   return values;
 }
 
@@ -102,9 +121,9 @@ std::vector<ReturnType> ParallelizeMapByChunkSize(Container& container,
 template <typename Container, typename Callable>
 auto ParallelizeMap(Container& container, Callable callback,
                     std::optional<size_t> threshold = std::nullopt) {
-  size_t num_elements_per_thread =
-      GetNumElementsPerThread(container, threshold);
-  return ParallelizeMapByChunkSize(container, num_elements_per_thread,
+  size_t num_elements_per_task =
+      internal::GetNumElementsPerTask(container, threshold);
+  return ParallelizeMapByChunkSize(container, num_elements_per_task,
                                    std::move(callback));
 }
 
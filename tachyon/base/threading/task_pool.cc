@@ -0,0 +1,241 @@
+#include "tachyon/base/threading/task_pool.h"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/device/numa.h"
+
+#if defined(TACHYON_HAS_OPENMP)
+#include <omp.h>
+#endif  // defined(TACHYON_HAS_OPENMP)
+
+namespace tachyon::base {
+
+namespace {
+
+thread_local const TaskPool* g_current_pool = nullptr;
+thread_local int g_current_worker_index = -1;
+
+size_t GetDefaultNumWorkers() {
+#if defined(TACHYON_HAS_OPENMP)
+  size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+  size_t thread_nums = std::thread::hardware_concurrency();
+#endif
+  return std::max(thread_nums, size_t{1}) - 1;
+}
+
+}  // namespace
+
+struct TaskPool::Worker {
+  absl::Mutex mutex;
+  std::deque<Task> tasks ABSL_GUARDED_BY(mutex);
+  int node = device::kNUMANoAffinity;
+  std::thread thread;
+};
+
+TaskPool::TaskPool(size_t num_workers, int node) {
+  int num_nodes = device::NUMAEnabled() ? device::NUMANumNodes() : 0;
+  if (node >= num_nodes) node = device::kNUMANoAffinity;
+  workers_.reserve(num_workers);
+  node_workers_.resize(num_nodes);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+    if (num_nodes > 0) {
+      int worker_node = node >= 0 ? node : static_cast<int>(i % num_nodes);
+      workers_.back()->node = worker_node;
+      node_workers_[worker_node].push_back(i);
+    }
+  }
+  // The threads start after all the workers are created, since a worker may
+  // steal from any of the others.
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_[i]->thread = std::thread(&TaskPool::RunWorker, this, i);
+  }
+}
+
+TaskPool::~TaskPool() {
+  {
+    absl::MutexLock lock(&mutex_);
+    stopped_ = true;
+    cond_var_.SignalAll();
+  }
+  for (std::unique_ptr<Worker>& worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+// static
+TaskPool& TaskPool::GetInstance() {
+  static NoDestructor<TaskPool> pool(GetDefaultNumWorkers());
+  return *pool;
+}
+
+int TaskPool::GetWorkerNode(size_t index) const {
+  return workers_[index]->node;
+}
+
+int TaskPool::GetCurrentWorkerIndex() const {
+  return g_current_pool == this ? g_current_worker_index : -1;
+}
+
+void TaskPool::Post(Task task, int node) {
+  int index = GetCurrentWorkerIndex();
+  // A task for another node goes to the queue of one of its workers, which
+  // pops it from the back like its own ones.
+  if (node >= 0 && static_cast<size_t>(node) < node_workers_.size() &&
+      !node_workers_[node].empty() &&
+      (index < 0 || workers_[index]->node != node)) {
+    const std::vector<size_t>& candidates = node_workers_[node];
+    index = static_cast<int>(
+        candidates[next_node_worker_.fetch_add(1, std::memory_order_relaxed) %
+                   candidates.size()]);
+  }
+  if (index >= 0) {
+    Worker& worker = *workers_[index];
+    absl::MutexLock lock(&worker.mutex);
+    worker.tasks.push_back(std::move(task));
+  } else {
+    absl::MutexLock lock(&shared_tasks_mutex_);
+    shared_tasks_.push_back(std::move(task));
+  }
+  num_pending_tasks_.fetch_add(1, std::memory_order_release);
+  // The signal is sent under |mutex_|, so that it isn't lost between the check
+  // of |num_pending_tasks_| and the wait of a worker.
+  absl::MutexLock lock(&mutex_);
+  cond_var_.Signal();
+  if (num_group_waiters_ > 0) group_cond_var_.Signal();
+}
+
+bool TaskPool::RunPendingTask() {
+  Task task;
+  if (!TakeTask(GetCurrentWorkerIndex(), &task)) return false;
+  RunTask(task);
+  return true;
+}
+
+bool TaskPool::TakeTask(int index, Task* task) {
+  if (num_pending_tasks_.load(std::memory_order_acquire) == 0) return false;
+
+  bool taken = false;
+  if (index >= 0) {
+    Worker& worker = *workers_[index];
+    absl::MutexLock lock(&worker.mutex);
+    if (!worker.tasks.empty()) {
+      *task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+      taken = true;
+    }
+  }
+  if (!taken) {
+    absl::MutexLock lock(&shared_tasks_mutex_);
+    if (!shared_tasks_.empty()) {
+      *task = std::move(shared_tasks_.front());
+      shared_tasks_.pop_front();
+      taken = true;
+    }
+  }
+  // Steal from the others, starting from the next one of the current worker
+  // so that the thieves don't all go after the same victim.
+  size_t start = index >= 0 ? static_cast<size_t>(index) : 0;
+  for (size_t i = 1; !taken && i <= workers_.size(); ++i) {
+    Worker& victim = *workers_[(start + i) % workers_.size()];
+    absl::MutexLock lock(&victim.mutex);
+    if (!victim.tasks.empty()) {
+      *task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      taken = true;
+    }
+  }
+  if (taken) num_pending_tasks_.fetch_sub(1, std::memory_order_relaxed);
+  return taken;
+}
+
+void TaskPool::RunTask(Task& task) {
+#if defined(TACHYON_HAS_OPENMP)
+  int max_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+#endif
+  task();
+#if defined(TACHYON_HAS_OPENMP)
+  omp_set_num_threads(max_threads);
+#endif
+}
+
+void TaskPool::RunWorker(size_t index) {
+  g_current_pool = this;
+  g_current_worker_index = static_cast<int>(index);
+  if (workers_[index]->node != device::kNUMANoAffinity) {
+    device::NUMASetThreadNodeAffinity(workers_[index]->node);
+  }
+
+  while (true) {
+    Task task;
+    if (TakeTask(static_cast<int>(index), &task)) {
+      RunTask(task);
+      continue;
+    }
+    absl::MutexLock lock(&mutex_);
+    while (!stopped_ &&
+           num_pending_tasks_.load(std::memory_order_acquire) == 0) {
+      cond_var_.Wait(&mutex_);
+    }
+    if (stopped_ && num_pending_tasks_.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+  }
+}
+
+void TaskPool::WaitForTaskGroup(const std::atomic<size_t>& num_group_tasks) {
+  absl::MutexLock lock(&mutex_);
+  ++num_group_waiters_;
+  // |NotifyTaskGroupDone()| is called under |mutex_| after |num_group_tasks|
+  // drops to 0, so the wake-up isn't lost between the check and the wait.
+  while (num_group_tasks.load(std::memory_order_acquire) > 0 &&
+         num_pending_tasks_.load(std::memory_order_acquire) == 0) {
+    group_cond_var_.Wait(&mutex_);
+  }
+  --num_group_waiters_;
+}
+
+void TaskPool::NotifyTaskGroupDone() {
+  absl::MutexLock lock(&mutex_);
+  if (num_group_waiters_ > 0) group_cond_var_.SignalAll();
+}
+
+void TaskGroup::Run(TaskPool::Task task, int node) {
+  num_pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+  pool_->Post(
+      [this, pool = pool_, task = std::move(task)]() mutable {
+        task();
+        // |Wait()| may return and this group may be destroyed right after the
+        // decrement, so |task| is destroyed before it and |pool| is used
+        // after it.
+        task = nullptr;
+        if (num_pending_tasks_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          pool->NotifyTaskGroupDone();
+        }
+      },
+      node);
+}
+
+void TaskGroup::Wait() {
+  size_t num_spins = 0;
+  while (num_pending_tasks_.load(std::memory_order_acquire) > 0) {
+    // The tasks of this group may be run by the others. Meanwhile, run any
+    // pending task rather than sleeping.
+    if (pool_->RunPendingTask()) {
+      num_spins = 0;
+    } else if (num_spins < kMaxSpins) {
+      ++num_spins;
+      std::this_thread::yield();
+    } else {
+      pool_->WaitForTaskGroup(num_pending_tasks_);
+      num_spins = 0;
+    }
+  }
+}
+
+}  // namespace tachyon::base
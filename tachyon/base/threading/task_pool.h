@@ -0,0 +1,212 @@
+#ifndef TACHYON_BASE_THREADING_TASK_POOL_H_
+#define TACHYON_BASE_THREADING_TASK_POOL_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/device/numa.h"
+#include "tachyon/device/numa_placement.h"
+#include "tachyon/export.h"
+
+namespace tachyon::base {
+
+// A pool of worker threads that run tasks with work stealing.
+//
+// Each worker owns a queue. A task posted from a worker is pushed to the back
+// of its own queue and the worker pops from the back, so that the nested tasks
+// run right after their parent while the data they share is in the cache. An
+// idle worker steals from the front of the queues of the others, where the
+// oldest and usually the largest tasks are. The tasks posted from the other
+// threads go to a shared queue.
+//
+// A thread that waits for its tasks runs the pending tasks instead of
+// blocking, and sleeps only when there is nothing left to run. See
+// |TaskGroup::Wait()|. So the parallel loops can be nested in
+// one another without creating more threads than the cores or deadlocking.
+// The OpenMP regions inside a task are run serially, so that the
+// |OPENMP_PARALLEL_FOR|s called from a task don't oversubscribe the cores
+// either. The loops that may be called from a task should use
+// |ParallelFor()| or |ParallelForRange()| instead to stay parallel.
+//
+// If NUMA is enabled, the workers are assigned to the nodes in a round robin
+// and pinned to them with |device::NUMASetThreadNodeAffinity()|. A task can be
+// posted to a node, and then it is run by a worker of the node unless an idle
+// worker of another node steals it. The tasks are not posted to any node
+// unless asked to, e.g., by |ParallelForPartitioned()|.
+class TACHYON_EXPORT TaskPool {
+ public:
+  using Task = std::function<void()>;
+
+  // Creates a pool of |num_workers| workers. The thread that waits for the
+  // tasks takes part in running them, so at most |num_workers| + 1 tasks run
+  // at once. If |node| is given and NUMA is enabled, all the workers are
+  // pinned to it instead of being spread over the nodes.
+  explicit TaskPool(size_t num_workers, int node = device::kNUMANoAffinity);
+  TaskPool(const TaskPool& other) = delete;
+  TaskPool& operator=(const TaskPool& other) = delete;
+  ~TaskPool();
+
+  // Returns the pool shared in the process. It has |omp_get_max_threads()| - 1
+  // workers, or the number of the hardware threads - 1 if OpenMP isn't
+  // available.
+  static TaskPool& GetInstance();
+
+  size_t num_workers() const { return workers_.size(); }
+
+  // Returns the number of the tasks that can run at once.
+  size_t concurrency() const { return workers_.size() + 1; }
+
+  // Returns the number of the NUMA nodes that the workers are assigned to, or
+  // 0 if NUMA is not enabled. This is queried once when the pool is created.
+  size_t num_nodes() const { return node_workers_.size(); }
+
+  // Returns the NUMA node of the |index|-th worker, or
+  // |device::kNUMANoAffinity| if NUMA is not enabled.
+  int GetWorkerNode(size_t index) const;
+
+  // Returns the index of the worker of this pool that runs the current thread,
+  // or -1 if the current thread is not one of them.
+  int GetCurrentWorkerIndex() const;
+
+  // Posts |task| to a worker of |node| if it is given and NUMA is enabled.
+  // Otherwise, it is posted to the queue of the current worker, or to the
+  // shared queue if the current thread is not a worker.
+  void Post(Task task, int node = device::kNUMANoAffinity);
+
+  // Runs a pending task on the current thread. Returns false if there is no
+  // pending task.
+  bool RunPendingTask();
+
+ private:
+  friend class TaskGroup;
+
+  struct Worker;
+
+  // Blocks until |num_group_tasks| drops to 0 or a task is posted.
+  void WaitForTaskGroup(const std::atomic<size_t>& num_group_tasks);
+  // Wakes up the threads blocked in |WaitForTaskGroup()|.
+  void NotifyTaskGroupDone();
+
+  bool TakeTask(int index, Task* task);
+  void RunTask(Task& task);
+  void RunWorker(size_t index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // The indices of the workers of each NUMA node.
+  std::vector<std::vector<size_t>> node_workers_;
+  // Used to pick the worker of a node that a task is posted to.
+  std::atomic<size_t> next_node_worker_ = 0;
+  absl::Mutex shared_tasks_mutex_;
+  std::deque<Task> shared_tasks_ ABSL_GUARDED_BY(shared_tasks_mutex_);
+  // The number of the tasks in all the queues.
+  std::atomic<size_t> num_pending_tasks_ = 0;
+
+  // The idle workers sleep on |cond_var_|, and the threads that wait for a
+  // |TaskGroup| sleep on |group_cond_var_|.
+  absl::Mutex mutex_;
+  absl::CondVar cond_var_;
+  absl::CondVar group_cond_var_;
+  size_t num_group_waiters_ ABSL_GUARDED_BY(mutex_) = 0;
+  bool stopped_ ABSL_GUARDED_BY(mutex_) = false;
+};
+
+// A set of tasks posted to a |TaskPool| that can be waited for together.
+class TACHYON_EXPORT TaskGroup {
+ public:
+  TaskGroup() : TaskGroup(&TaskPool::GetInstance()) {}
+  explicit TaskGroup(TaskPool* pool) : pool_(pool) {}
+  TaskGroup(const TaskGroup& other) = delete;
+  TaskGroup& operator=(const TaskGroup& other) = delete;
+  ~TaskGroup() { Wait(); }
+
+  // See |TaskPool::Post()| for |node|.
+  void Run(TaskPool::Task task, int node = device::kNUMANoAffinity);
+
+  // Returns once all the tasks of this group are done. Meanwhile, the current
+  // thread runs the pending tasks of the pool. If there is none, it spins for
+  // a while, since the tasks being run by the others are usually about to
+  // finish, and then sleeps until they are done or another task is posted.
+  void Wait();
+
+ private:
+  // The number of the yields in |Wait()| before it sleeps.
+  constexpr static size_t kMaxSpins = 64;
+
+  // not owned
+  TaskPool* const pool_;
+  std::atomic<size_t> num_pending_tasks_ = 0;
+};
+
+// Runs |callback(i)| for every i in [0, |n|) on the |TaskPool| and returns
+// once all of them are done. Each index is run as a task, so |n| should be
+// the number of the chunks of the work rather than the number of elements.
+template <typename Callable>
+void ParallelFor(size_t n, Callable callback) {
+  if (n == 0) return;
+  TaskGroup group;
+  for (size_t i = 0; i < n; ++i) {
+    group.Run([&callback, i]() { callback(i); });
+  }
+  group.Wait();
+}
+
+// The minimum number of elements of a range of |ParallelForRange()| by
+// default.
+constexpr size_t kMinElementsPerRange = 1 << 10;
+
+// Returns the number of elements of each range when [0, |size|) is split into
+// as many ranges as the tasks that the |TaskPool| runs at once. A range has at
+// least |min_elements_per_range| elements unless it is the last one, so a
+// small |size| is a single range.
+inline size_t GetNumElementsPerRange(
+    size_t size, size_t min_elements_per_range = kMinElementsPerRange) {
+  size_t task_nums = TaskPool::GetInstance().concurrency();
+  return std::max((size + task_nums - 1) / task_nums, min_elements_per_range);
+}
+
+// Splits [0, |size|) into the ranges of |GetNumElementsPerRange()| elements
+// and runs |callback(begin, end)| on each of them with |ParallelFor()|.
+template <typename Callable>
+void ParallelForRange(size_t size, Callable callback,
+                      size_t min_elements_per_range = kMinElementsPerRange) {
+  size_t num_elems_per_range =
+      GetNumElementsPerRange(size, min_elements_per_range);
+  size_t num_ranges = (size + num_elems_per_range - 1) / num_elems_per_range;
+  ParallelFor(num_ranges, [size, num_elems_per_range, &callback](size_t i) {
+    size_t begin = i * num_elems_per_range;
+    callback(begin, std::min(begin + num_elems_per_range, size));
+  });
+}
+
+// Same as |ParallelFor()|, but if NUMA is enabled, the i-th task is posted to
+// the node that holds the i-th of the |n| chunks of a buffer placed with
+// |device::NUMAPlacement::kPartitioned|. Use it only for the loops over such
+// buffers. A loop nested in a task of the pool is not routed, since its tasks
+// are better run by the current worker, which has the data of the parent
+// task in its cache.
+template <typename Callable>
+void ParallelForPartitioned(size_t n, Callable callback) {
+  if (n == 0) return;
+  TaskPool& pool = TaskPool::GetInstance();
+  size_t num_nodes = pool.GetCurrentWorkerIndex() < 0 ? pool.num_nodes() : 0;
+  TaskGroup group(&pool);
+  for (size_t i = 0; i < n; ++i) {
+    group.Run([&callback, i]() { callback(i); },
+              num_nodes > 0 ? device::GetNUMAPartitionNode(i, n, num_nodes)
+                            : device::kNUMANoAffinity);
+  }
+  group.Wait();
+}
+
+}  // namespace tachyon::base
+
+#endif  // TACHYON_BASE_THREADING_TASK_POOL_H_
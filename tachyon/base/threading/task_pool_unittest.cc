@@ -0,0 +1,124 @@
+#include "tachyon/base/threading/task_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+
+namespace tachyon::base {
+
+TEST(TaskPoolTest, ParallelFor) {
+  for (size_t num_workers : {0, 1, 4}) {
+    TaskPool pool(num_workers);
+    EXPECT_EQ(pool.concurrency(), num_workers + 1);
+
+    std::vector<int> values(100, 0);
+    TaskGroup group(&pool);
+    for (size_t i = 0; i < values.size(); ++i) {
+      group.Run([&values, i]() { values[i] = static_cast<int>(i); });
+    }
+    group.Wait();
+    for (size_t i = 0; i < values.size(); ++i) {
+      EXPECT_EQ(values[i], static_cast<int>(i));
+    }
+  }
+
+  std::vector<int> values(100, 0);
+  ParallelFor(values.size(), [&values](size_t i) { values[i] += 1; });
+  EXPECT_EQ(values, std::vector<int>(100, 1));
+}
+
+TEST(TaskPoolTest, ParallelForRange) {
+  size_t task_nums = TaskPool::GetInstance().concurrency();
+  EXPECT_EQ(GetNumElementsPerRange(0), kMinElementsPerRange);
+  EXPECT_EQ(GetNumElementsPerRange(10), kMinElementsPerRange);
+  EXPECT_EQ(GetNumElementsPerRange(10, 1), (10 + task_nums - 1) / task_nums);
+
+  for (size_t size :
+       {size_t{0}, size_t{10}, task_nums * kMinElementsPerRange + 3}) {
+    for (size_t min_elements_per_range : {size_t{1}, kMinElementsPerRange}) {
+      std::vector<int> values(size, 0);
+      std::atomic<size_t> num_ranges = 0;
+      ParallelForRange(
+          size,
+          [&values, &num_ranges](size_t begin, size_t end) {
+            EXPECT_LT(begin, end);
+            for (size_t i = begin; i < end; ++i) {
+              values[i] += 1;
+            }
+            num_ranges.fetch_add(1, std::memory_order_relaxed);
+          },
+          min_elements_per_range);
+      EXPECT_EQ(values, std::vector<int>(size, 1));
+      EXPECT_LE(num_ranges.load(), task_nums);
+    }
+  }
+}
+
+TEST(TaskPoolTest, Nested) {
+  TaskPool pool(3);
+  std::atomic<size_t> count = 0;
+  TaskGroup outer(&pool);
+  for (size_t i = 0; i < 8; ++i) {
+    outer.Run([&pool, &count]() {
+      // The inner groups are waited for on the workers, which must run the
+      // pending tasks rather than block.
+      TaskGroup inner(&pool);
+      for (size_t j = 0; j < 8; ++j) {
+        inner.Run([&count]() { count.fetch_add(1); });
+      }
+      inner.Wait();
+    });
+  }
+  outer.Wait();
+  EXPECT_EQ(count.load(), size_t{64});
+}
+
+TEST(TaskPoolTest, WaitForRunningTask) {
+  TaskPool pool(1);
+  for (size_t i = 0; i < 100; ++i) {
+    absl::Notification started;
+    absl::Notification released;
+    std::atomic<bool> done = false;
+    TaskGroup group(&pool);
+    group.Run([&started, &released, &done]() {
+      started.Notify();
+      released.WaitForNotification();
+      done = true;
+    });
+    // The task is run by the worker, so |Wait()| has nothing to run and
+    // sleeps once it is done spinning.
+    started.WaitForNotification();
+    std::thread releaser([&released]() {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      released.Notify();
+    });
+    group.Wait();
+    EXPECT_TRUE(done);
+    releaser.join();
+  }
+}
+
+TEST(TaskPoolTest, GetCurrentWorkerIndex) {
+  TaskPool pool(2);
+  EXPECT_EQ(pool.GetCurrentWorkerIndex(), -1);
+
+  std::vector<int> indices(16, 0);
+  TaskGroup group(&pool);
+  for (size_t i = 0; i < indices.size(); ++i) {
+    group.Run([&pool, &indices, i]() {
+      indices[i] = pool.GetCurrentWorkerIndex();
+    });
+  }
+  group.Wait();
+  for (int index : indices) {
+    // -1 if it is run by the waiting thread.
+    EXPECT_GE(index, -1);
+    EXPECT_LT(index, 2);
+  }
+}
+
+}  // namespace tachyon::base
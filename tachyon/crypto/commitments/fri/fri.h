@@ -4,209 +4,415 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_H_
 #define TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_H_
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/crypto/commitments/fri/fri_proof.h"
 #include "tachyon/crypto/commitments/fri/fri_storage.h"
-#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 
 namespace tachyon::crypto {
+namespace internal {
+
+// Hashes a coset of evaluations into a single leaf hash. The leaf hash is the
+// root of the |Arity|-ary Merkle tree built over the evaluations using
+// |hasher|. Like |MerkleTree|, the leaf hashes are padded with zeros up to the
+// next power of |Arity|.
+template <typename F, size_t Arity>
+class FRICosetHasher : public MerkleHasher<absl::Span<const F>, F> {
+ public:
+  explicit FRICosetHasher(const MerkleHasher<F, F>* hasher) : hasher_(hasher) {}
+
+  // MerkleHasher<absl::Span<const F>, F> methods
+  F ComputeLeafHash(const absl::Span<const F>& coset) const override {
+    size_t size = 1;
+    while (size < coset.size()) {
+      size *= Arity;
+    }
+    std::vector<F> hashes(size);
+    for (size_t i = 0; i < coset.size(); ++i) {
+      hashes[i] = hasher_->ComputeLeafHash(coset[i]);
+    }
+    while (size > 1) {
+      size /= Arity;
+      for (size_t i = 0; i < size; ++i) {
+        hashes[i] = hasher_->ComputeParentHash(
+            absl::MakeConstSpan(&hashes[i * Arity], Arity));
+      }
+    }
+    return hashes[0];
+  }
+
+  F ComputeParentHash(absl::Span<const F> children) const override {
+    return hasher_->ComputeParentHash(children);
+  }
 
-template <typename F, size_t MaxDegree>
-class FRI final
-    : public UnivariatePolynomialCommitmentScheme<FRI<F, MaxDegree>> {
+ private:
+  // not owned
+  const MerkleHasher<F, F>* hasher_;
+};
+
+}  // namespace internal
+
+// |MerkleArity| is the arity of the Merkle trees that commit to the layers.
+template <typename F, size_t MaxDegree, size_t MerkleArity = 2>
+class FRI final : public UnivariatePolynomialCommitmentScheme<
+                      FRI<F, MaxDegree, MerkleArity>> {
  public:
-  using Base = UnivariatePolynomialCommitmentScheme<FRI<F, MaxDegree>>;
+  using Base =
+      UnivariatePolynomialCommitmentScheme<FRI<F, MaxDegree, MerkleArity>>;
   using Poly = typename Base::Poly;
   using Evals = typename Base::Evals;
   using Domain = typename Base::Domain;
 
+  constexpr static size_t kDefaultFoldingArity = 2;
+  constexpr static size_t kMaxFoldingArity = 16;
+
   FRI() = default;
-  FRI(const Domain* domain, FRIStorage<F>* storage,
-      BinaryMerkleHasher<F, F>* hasher)
+  // |folding_arity| is the number of evaluations that are folded into one
+  // evaluation of the next layer. It must be one of 2, 4, 8 and 16. The
+  // evaluations that are folded together are committed as a single Merkle
+  // leaf.
+  FRI(const Domain* domain, FRIStorage<F>* storage, MerkleHasher<F, F>* hasher,
+      size_t folding_arity = kDefaultFoldingArity)
       : domain_(domain), storage_(storage), hasher_(hasher) {
     // This ensures last folding process.
     CHECK_GE(domain->size(), size_t{2}) << "Domain size must be at least 2";
-    size_t k = domain->log_size_of_group();
-    if (k > 1) {
-      sub_domains_ = base::CreateVector(k - 1, [k](size_t i) {
-        return Domain::Create(size_t{1} << (k - i - 1));
-      });
+    CHECK(base::bits::IsPowerOfTwo(folding_arity));
+    CHECK_GE(folding_arity, size_t{2});
+    CHECK_LE(folding_arity, kMaxFoldingArity);
+    // If the size of the last layer is smaller than |folding_arity|, the last
+    // layer is folded by its size.
+    size_t size = domain->size();
+    while (size > 1) {
+      size_t arity = std::min(folding_arity, size);
+      layer_arities_.push_back(arity);
+      size /= arity;
+      if (size > 1) {
+        sub_domains_.push_back(Domain::Create(size));
+      }
     }
-    storage_->Allocate(k);
+    storage_->Allocate(layer_arities_.size());
   }
 
+  const std::vector<size_t>& layer_arities() const { return layer_arities_; }
+
   // UnivariatePolynomialCommitmentScheme methods
   size_t N() const { return domain_->size(); }
 
   [[nodiscard]] bool Commit(const Poly& poly, Transcript<F>* transcript) const {
-    size_t num_layers = domain_->log_size_of_group();
     TranscriptWriter<F>* writer = transcript->ToWriter();
-    BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(0), hasher_);
-    Evals evals = domain_->FFT(poly);
-    F root;
-    if (!tree.Commit(evals.evaluations(), &root)) return false;
-    if (!writer->WriteToProof(root)) return false;
     const Poly* cur_poly = &poly;
 
-    F beta;
     Poly folded_poly;
-    if (num_layers > 1) {
-      for (size_t i = 1; i < num_layers; ++i) {
-        // Pᵢ(X)   = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-        // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-        beta = writer->SqueezeChallenge();
-        folded_poly = cur_poly->template Fold<false>(beta);
-        BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(i),
-                                                   hasher_);
-        evals = sub_domains_[i - 1]->FFT(folded_poly);
-        if (!tree.Commit(evals.evaluations(), &root)) return false;
-        if (!writer->WriteToProof(root)) return false;
-        cur_poly = &folded_poly;
-      }
+    for (size_t i = 0; i < layer_arities_.size(); ++i) {
+      Evals evals = GetLayerDomain(i)->FFT(*cur_poly);
+      F root;
+      if (!CommitLayer(i, evals.evaluations(), &root)) return false;
+      if (!writer->WriteToProof(root)) return false;
+
+      // Pᵢ(X)   = Σⱼ Xʲ * Pᵢ,ⱼ(Xᵃ), where a is the folding arity.
+      // Pᵢ₊₁(X) = Σⱼ βʲ * Pᵢ,ⱼ(X)
+      F beta = writer->SqueezeChallenge();
+      folded_poly = FoldPoly(*cur_poly, beta, layer_arities_[i]);
+      cur_poly = &folded_poly;
     }
 
-    beta = writer->SqueezeChallenge();
-    folded_poly = cur_poly->template Fold<false>(beta);
     const F* constant = folded_poly[0];
-    root = constant ? *constant : F::Zero();
+    F root = constant ? *constant : F::Zero();
     return writer->WriteToProof(root);
   }
 
   [[nodiscard]] bool DoCreateOpeningProof(size_t index,
                                           FRIProof<F>* fri_proof) const {
-    size_t domain_size = domain_->size();
-    size_t num_layers = domain_->log_size_of_group();
-    for (size_t i = 0; i < num_layers; ++i) {
-      size_t leaf_index = index % domain_size;
-      BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
-      BinaryMerkleProof<F> proof;
-      if (!tree.CreateOpeningProof(leaf_index, &proof)) return false;
-      // Merkle proof for Pᵢ(ωʲ) against Cᵢ
-      fri_proof->paths.push_back(std::move(proof));
-      // Pᵢ(ωʲ)
-      fri_proof->evaluations.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index));
-
-      size_t half_domain_size = domain_size >> 1;
-      size_t leaf_index_sym = (index + half_domain_size) % domain_size;
-      BinaryMerkleProof<F> proof_sym;
-      if (!tree.CreateOpeningProof(leaf_index_sym, &proof_sym)) return false;
-      // Merkle proof for Pᵢ(-ωʲ) against Cᵢ
-      fri_proof->paths_sym.push_back(std::move(proof_sym));
-      // Pᵢ(-ωʲ)
-      fri_proof->evaluations_sym.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index_sym));
-
-      domain_size = half_domain_size;
-    }
-    return true;
+    return DoCreateOpeningProof(std::vector<size_t>{index}, fri_proof);
+  }
+
+  // Open all the |indices| at once. Each layer is opened in parallel.
+  [[nodiscard]] bool DoCreateOpeningProof(const std::vector<size_t>& indices,
+                                          FRIProof<F>* fri_proof) const {
+    if (!ValidateIndices(indices)) return false;
+
+    size_t num_layers = layer_arities_.size();
+    fri_proof->paths.resize(num_layers);
+    fri_proof->evaluations.resize(num_layers);
+    std::atomic<bool> success = true;
+    base::ParallelFor(num_layers, [this, &indices, fri_proof,
+                                   &success](size_t i) {
+      size_t arity = layer_arities_[i];
+      std::vector<size_t> leaf_indices = GetLeafIndices(i, indices);
+      Tree tree(storage_->GetLayer(i), nullptr);
+      // Merkle proof for Pᵢ({x * ζᵗ}) against Cᵢ, where ζ is a primitive
+      // a-th root of unity.
+      if (!tree.CreateOpeningProof(leaf_indices, &fri_proof->paths[i])) {
+        success.store(false, std::memory_order_relaxed);
+        return;
+      }
+      // Pᵢ({x * ζᵗ})
+      const std::vector<F>& layer_evaluations = storage_->GetEvaluations(i);
+      std::vector<F>& evaluations = fri_proof->evaluations[i];
+      evaluations.resize(leaf_indices.size() * arity);
+      for (size_t j = 0; j < leaf_indices.size(); ++j) {
+        std::copy_n(layer_evaluations.begin() + leaf_indices[j] * arity, arity,
+                    evaluations.begin() + j * arity);
+      }
+    });
+    return success.load(std::memory_order_relaxed);
   }
 
   [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
                                           size_t index,
                                           const FRIProof<F>& proof) const {
+    return DoVerifyOpeningProof(transcript, std::vector<size_t>{index}, proof);
+  }
+
+  // Verify all the |indices| at once. Each layer and then each query is
+  // verified in parallel.
+  [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
+                                          const std::vector<size_t>& indices,
+                                          const FRIProof<F>& proof) const {
+    if (!ValidateIndices(indices)) return false;
+
+    size_t num_layers = layer_arities_.size();
+    if (proof.paths.size() != num_layers ||
+        proof.evaluations.size() != num_layers) {
+      LOG(ERROR) << "The number of layers doesn't match";
+      return false;
+    }
+
     TranscriptReader<F>* reader = transcript.ToReader();
-    size_t domain_size = domain_->size();
-    size_t num_layers = domain_->log_size_of_group();
-    F root;
-    F x;
-    F beta;
-    F evaluation;
-    F evaluation_sym;
-    F two_inv = F(2).Inverse();
+    std::vector<F> roots(num_layers);
+    std::vector<F> betas(num_layers);
     for (size_t i = 0; i < num_layers; ++i) {
-      BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
+      if (!reader->ReadFromProof(&roots[i])) return false;
+      betas[i] = reader->SqueezeChallenge();
+    }
+    F constant;
+    if (!reader->ReadFromProof(&constant)) return false;
 
-      if (!reader->ReadFromProof(&root)) return false;
-      if (!tree.VerifyOpeningProof(root, proof.evaluations[i], proof.paths[i]))
-        return false;
+    std::vector<std::vector<size_t>> leaf_indices(num_layers);
+    std::atomic<bool> success = true;
+    base::ParallelFor(num_layers, [this, &indices, &roots, &proof,
+                                   &leaf_indices, &success](size_t i) {
+      leaf_indices[i] = GetLeafIndices(i, indices);
+      if (!VerifyLayer(i, roots[i], leaf_indices[i], proof)) {
+        success.store(false, std::memory_order_relaxed);
+      }
+    });
+    if (!success.load(std::memory_order_relaxed)) return false;
+
+    F two_inv = F(2).Inverse();
+    base::ParallelFor(indices.size(), [this, &indices, &leaf_indices, &betas,
+                                       &constant, &two_inv, &proof,
+                                       &success](size_t i) {
+      if (!VerifyQuery(indices[i], leaf_indices, betas, constant, two_inv,
+                       proof)) {
+        success.store(false, std::memory_order_relaxed);
+      }
+    });
+    return success.load(std::memory_order_relaxed);
+  }
+
+ private:
+  using Tree = MerkleTree<absl::Span<const F>, F, MerkleArity, MaxDegree + 1>;
+  using CosetHasher = internal::FRICosetHasher<F, MerkleArity>;
+
+  const Domain* GetLayerDomain(size_t i) const {
+    return i == 0 ? domain_ : sub_domains_[i - 1].get();
+  }
+
+  // Returns the number of Merkle leaves of the |i|-th layer.
+  size_t GetNumCosets(size_t i) const {
+    return GetLayerDomain(i)->size() / layer_arities_[i];
+  }
 
-      if (!tree.VerifyOpeningProof(root, proof.evaluations_sym[i],
-                                   proof.paths_sym[i]))
+  bool ValidateIndices(const std::vector<size_t>& indices) const {
+    if (indices.empty()) {
+      LOG(ERROR) << "No indices to open";
+      return false;
+    }
+    size_t domain_size = domain_->size();
+    for (size_t index : indices) {
+      if (index >= domain_size) {
+        LOG(ERROR) << "Index is out of range: " << index;
         return false;
+      }
+    }
+    return true;
+  }
 
-      // Given equations:
-      // Pᵢ(X)  = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-      // Pᵢ(-X) = Pᵢ_even(X²) - X * Pᵢ_odd(X²)
-      //
-      // Using Gaussian elimination, we derive:
-      // Pᵢ_even(X²) = (Pᵢ(X) + Pᵢ(-X)) / 2
-      // Pᵢ_odd(X²)  = (Pᵢ(X) - Pᵢ(-X)) / (2 * X)
-      //
-      // Next layer equation:
-      // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-      //
-      // If the domain of Pᵢ(X) is Dᵢ = {ω⁰, ω¹, ..., ωⁿ⁻¹},
-      // then the domain of Pᵢ₊₁(X) is Dᵢ₊₁ = {ω⁰, ω¹, ..., ωᵏ⁻¹},
-      // where k = n / 2.
-      //
-      // As per the definition:
-      // Pᵢ₊₁(ωʲ) = Pᵢ_even((ωʲ)²) + β * Pᵢ_odd((ωʲ)²)
-      //
-      // Substituting Pᵢ_even and Pᵢ_odd:
-      // Pᵢ₊₁(ωʲ) = (Pᵢ(ωʲ) + Pᵢ(-ωʲ)) / 2 + β * (Pᵢ(ωʲ) - Pᵢ(-ωʲ)) / (2 * ωʲ)
-      //           = ((1 + β * ω⁻ʲ) * Pᵢ(ωʲ) + (1 - β * ω⁻ʲ) * Pᵢ(-ωʲ)) / 2
-      size_t leaf_index = index % domain_size;
-      if (i == 0) {
-        evaluation = proof.evaluations[i];
-        evaluation_sym = proof.evaluations_sym[i];
-        x = domain_->GetElement(leaf_index);
-      } else {
-        evaluation *= (F::One() + beta);
-        evaluation_sym *= (F::One() - beta);
-        evaluation += evaluation_sym;
-        evaluation *= two_inv;
-
-        if (evaluation != proof.evaluations[i]) {
+  // Returns the sorted and deduplicated leaf indices of the |i|-th layer that
+  // are touched by |indices|.
+  std::vector<size_t> GetLeafIndices(size_t i,
+                                     const std::vector<size_t>& indices) const {
+    size_t num_cosets = GetNumCosets(i);
+    std::vector<size_t> ret = base::Map(
+        indices, [num_cosets](size_t index) { return index % num_cosets; });
+    std::sort(ret.begin(), ret.end());
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+    return ret;
+  }
+
+  static Poly FoldPoly(const Poly& poly, F beta, size_t arity) {
+    // Folding by a is equivalent to folding by 2 log₂(a) times with
+    // β, β², β⁴, ...
+    Poly ret = poly.template Fold<false>(beta);
+    for (size_t a = arity >> 1; a > 1; a >>= 1) {
+      beta.SquareInPlace();
+      ret = ret.template Fold<false>(beta);
+    }
+    return ret;
+  }
+
+  // Folds the evaluations of Pᵢ on the coset {x * ζᵗ | 0 ≤ t < a} into
+  // Pᵢ₊₁(xᵃ), where ζ is a primitive a-th root of unity and |y_invs| are the
+  // inverses of the first a / 2 points of the coset.
+  static F FoldCoset(absl::Span<const F> coset, std::vector<F> y_invs, F beta,
+                     const F& two_inv) {
+    std::vector<F> values(coset.begin(), coset.end());
+    size_t half = values.size() >> 1;
+    while (half > 0) {
+      for (size_t t = 0; t < half; ++t) {
+        // Pᵢ(y)  = Pᵢ_even(y²) + y * Pᵢ_odd(y²)
+        // Pᵢ(-y) = Pᵢ_even(y²) - y * Pᵢ_odd(y²)
+        //
+        // Pᵢ₊₁(y²) = Pᵢ_even(y²) + β * Pᵢ_odd(y²)
+        //          = (Pᵢ(y) + Pᵢ(-y)) / 2 + β * (Pᵢ(y) - Pᵢ(-y)) / (2 * y)
+        //
+        // Since ζ^(a / 2) = -1, -y is at t + a / 2.
+        F sum = values[t] + values[t + half];
+        F diff = values[t] - values[t + half];
+        diff *= beta;
+        diff *= y_invs[t];
+        values[t] = (sum + diff) * two_inv;
+        y_invs[t].SquareInPlace();
+      }
+      beta.SquareInPlace();
+      half >>= 1;
+    }
+    return values[0];
+  }
+
+  bool CommitLayer(size_t i, const std::vector<F>& evals, F* root) const {
+    size_t arity = layer_arities_[i];
+    size_t num_cosets = evals.size() / arity;
+    // Gather each coset {ωʲ⁺ᵗᵐ | 0 ≤ t < a}, where m = |num_cosets|, into a
+    // contiguous chunk so that it can be committed as a single leaf.
+    std::vector<F> layer_evaluations(evals.size());
+    base::ParallelForRange(num_cosets, [&layer_evaluations, &evals, arity,
+                                        num_cosets](size_t begin, size_t end) {
+      for (size_t j = begin; j < end; ++j) {
+        for (size_t t = 0; t < arity; ++t) {
+          layer_evaluations[j * arity + t] = evals[j + t * num_cosets];
+        }
+      }
+    });
+    std::vector<absl::Span<const F>> leaves =
+        base::CreateVector(num_cosets, [&layer_evaluations, arity](size_t j) {
+          return absl::MakeConstSpan(&layer_evaluations[j * arity], arity);
+        });
+    CosetHasher coset_hasher(hasher_);
+    Tree tree(storage_->GetLayer(i), &coset_hasher);
+    if (!tree.Commit(leaves, root)) return false;
+    storage_->SetEvaluations(i, std::move(layer_evaluations));
+    return true;
+  }
+
+  bool VerifyLayer(size_t i, F root,
+                   const std::vector<size_t>& leaf_indices,
+                   const FRIProof<F>& proof) const {
+    size_t arity = layer_arities_[i];
+    const std::vector<F>& evaluations = proof.evaluations[i];
+    if (evaluations.size() != leaf_indices.size() * arity) {
+      LOG(ERROR) << "The number of evaluations doesn't match at layer [" << i
+                 << "]";
+      return false;
+    }
+    CosetHasher coset_hasher(hasher_);
+    MerkleOpenings<F> openings;
+    openings.leaves_size = GetNumCosets(i);
+    openings.leaves = base::CreateVector(
+        leaf_indices.size(),
+        [&leaf_indices, &evaluations, &coset_hasher, arity](size_t j) {
+          return std::make_pair(
+              leaf_indices[j],
+              coset_hasher.ComputeLeafHash(
+                  absl::MakeConstSpan(&evaluations[j * arity], arity)));
+        });
+    Tree tree(nullptr, &coset_hasher);
+    if (!tree.VerifyOpeningProof(root, openings, proof.paths[i])) {
+      LOG(ERROR) << "Merkle proof doesn't match at layer [" << i << "]";
+      return false;
+    }
+    return true;
+  }
+
+  bool VerifyQuery(size_t index,
+                   const std::vector<std::vector<size_t>>& leaf_indices,
+                   const std::vector<F>& betas, const F& constant,
+                   const F& two_inv, const FRIProof<F>& proof) const {
+    F evaluation;
+    for (size_t i = 0; i < layer_arities_.size(); ++i) {
+      const Domain* domain = GetLayerDomain(i);
+      size_t arity = layer_arities_[i];
+      size_t num_cosets = GetNumCosets(i);
+      // The query lies at ωʲ⁺ᵗᵐ of the |i|-th layer, where m = |num_cosets|.
+      size_t j = index % num_cosets;
+      auto it = std::lower_bound(leaf_indices[i].begin(),
+                                 leaf_indices[i].end(), j);
+      size_t leaf_idx = static_cast<size_t>(it - leaf_indices[i].begin());
+      absl::Span<const F> coset =
+          absl::MakeConstSpan(&proof.evaluations[i][leaf_idx * arity], arity);
+      if (i > 0) {
+        size_t t = (index % domain->size()) / num_cosets;
+        if (coset[t] != evaluation) {
           LOG(ERROR)
               << "Proof doesn't match with expected evaluation at layer [" << i
               << "]";
           return false;
         }
-        evaluation_sym = proof.evaluations_sym[i];
-        x = sub_domains_[i - 1]->GetElement(leaf_index);
       }
-      beta = reader->SqueezeChallenge();
-      beta *= x.Inverse();
-      domain_size = domain_size >> 1;
+      // y⁻¹ = x⁻¹ * ζ⁻ᵗ, where x = ωʲ and ζ = ωᵐ.
+      std::vector<F> y_invs = F::GetSuccessivePowers(
+          arity >> 1, domain->GetElement(num_cosets).Inverse(),
+          domain->GetElement(j).Inverse());
+      evaluation = FoldCoset(coset, std::move(y_invs), betas[i], two_inv);
     }
 
-    evaluation *= (F::One() + beta);
-    evaluation_sym *= (F::One() - beta);
-    evaluation += evaluation_sym;
-    evaluation *= two_inv;
-
-    if (!reader->ReadFromProof(&root)) return false;
-    if (root != evaluation) {
+    if (constant != evaluation) {
       LOG(ERROR) << "Root doesn't match with expected evaluation";
       return false;
     }
     return true;
   }
 
- private:
   // not owned
   const Domain* domain_ = nullptr;
   // not owned
-  mutable FRIStorage<F>* storage_ = nullptr;
+  FRIStorage<F>* storage_ = nullptr;
   // not owned
-  BinaryMerkleHasher<F, F>* hasher_ = nullptr;
+  MerkleHasher<F, F>* hasher_ = nullptr;
   // not owned
   Transcript<F>* transcript_ = nullptr;
+  // Domains of the layers except the first one.
   std::vector<std::unique_ptr<Domain>> sub_domains_;
+  // Folding arity of each layer.
+  std::vector<size_t> layer_arities_;
 };
 
-template <typename F, size_t MaxDegree>
-struct VectorCommitmentSchemeTraits<FRI<F, MaxDegree>> {
+template <typename F, size_t MaxDegree, size_t MerkleArity>
+struct VectorCommitmentSchemeTraits<FRI<F, MaxDegree, MerkleArity>> {
  public:
   constexpr static size_t kMaxSize = MaxDegree + 1;
   constexpr static bool kIsTransparent = true;
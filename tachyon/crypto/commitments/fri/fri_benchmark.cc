@@ -0,0 +1,108 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/crypto/commitments/fri/fri.h"
+#include "tachyon/crypto/commitments/merkle_tree/simple_merkle_tree_storage.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t kMaxK = 20;
+constexpr size_t kMaxDegree = (size_t{1} << kMaxK) - 1;
+
+using F = math::Goldilocks;
+
+class SimpleHasher : public MerkleHasher<F, F> {
+ public:
+  // MerkleHasher<F, F> methods
+  F ComputeLeafHash(const F& leaf) const override { return leaf; }
+  F ComputeParentHash(absl::Span<const F> children) const override {
+    F ret = F::Zero();
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+      ret = ret.Double() + *it;
+    }
+    return ret;
+  }
+};
+
+class SimpleFRIStorage : public FRIStorage<F> {
+ public:
+  // FRIStorage<F> methods
+  void Allocate(size_t size) override {
+    layers_.resize(size);
+    evaluations_.resize(size);
+  }
+  MerkleTreeStorage<F>* GetLayer(size_t index) override {
+    return &layers_[index];
+  }
+  void SetEvaluations(size_t index,
+                      std::vector<F>&& evaluations) override {
+    evaluations_[index] = std::move(evaluations);
+  }
+  const std::vector<F>& GetEvaluations(size_t index) const override {
+    return evaluations_[index];
+  }
+
+ private:
+  std::vector<SimpleMerkleTreeStorage<F>> layers_;
+  std::vector<std::vector<F>> evaluations_;
+};
+
+}  // namespace
+
+// |state.range(0)|: log₂ of the domain size
+// |state.range(1)|: folding arity
+// |state.range(2)|: the number of queries
+template <size_t MerkleArity>
+void BM_FRIProve(benchmark::State& state) {
+  using PCS = FRI<F, kMaxDegree, MerkleArity>;
+
+  F::Init();
+  size_t k = state.range(0);
+  size_t folding_arity = state.range(1);
+  size_t num_queries = state.range(2);
+  size_t n = size_t{1} << k;
+
+  std::unique_ptr<typename PCS::Domain> domain = PCS::Domain::Create(n);
+  SimpleFRIStorage storage;
+  SimpleHasher hasher;
+  PCS pcs(domain.get(), &storage, &hasher, folding_arity);
+
+  typename PCS::Poly poly = PCS::Poly::Random(n - 1);
+  std::vector<size_t> indices = base::CreateVector(num_queries, [n]() {
+    return base::Uniform(base::Range<size_t>::Until(n));
+  });
+  FRIProof<F> proof;
+  for (auto _ : state) {
+    base::Uint8VectorBuffer write_buffer;
+    SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+    CHECK(pcs.Commit(poly, &writer));
+    CHECK(pcs.CreateOpeningProof(indices, &proof));
+  }
+  benchmark::DoNotOptimize(proof);
+  // Roots of every layer and the final constant are also written to the
+  // transcript.
+  state.counters["proof_size"] =
+      proof.GetNumElements() + pcs.layer_arities().size() + 1;
+}
+
+BENCHMARK_TEMPLATE(BM_FRIProve, 2)
+    ->ArgsProduct({{16, kMaxK}, {2, 4, 8, 16}, {30, 80}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FRIProve, 4)
+    ->ArgsProduct({{16, kMaxK}, {2, 4, 8, 16}, {30, 80}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_FRIProve, 8)
+    ->ArgsProduct({{16, kMaxK}, {2, 4, 8, 16}, {30, 80}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::crypto
@@ -4,18 +4,37 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_PROOF_H_
 #define TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_PROOF_H_
 
+#include <stddef.h>
+
 #include <vector>
 
-#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_proof.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_proof.h"
 
 namespace tachyon::crypto {
 
+// Proof that opens one or more queries against every FRI layer. Queries
+// that hit the same coset in a layer share the coset evaluations and the
+// Merkle path nodes of the layer.
 template <typename F>
 struct FRIProof {
-  std::vector<BinaryMerkleProof<F>> paths;
-  std::vector<BinaryMerkleProof<F>> paths_sym;
-  std::vector<F> evaluations;
-  std::vector<F> evaluations_sym;
+  // Merkle multi-opening proof of the opened cosets of each layer.
+  std::vector<MerkleMultiProof<F>> paths;
+  // Evaluations of the opened cosets of each layer. The cosets are ordered
+  // by their leaf index and each coset has as many evaluations as the
+  // folding arity of the layer.
+  std::vector<std::vector<F>> evaluations;
+
+  // Returns the number of field elements in the proof.
+  size_t GetNumElements() const {
+    size_t ret = 0;
+    for (const MerkleMultiProof<F>& path : paths) {
+      ret += path.hashes.size();
+    }
+    for (const std::vector<F>& layer_evaluations : evaluations) {
+      ret += layer_evaluations.size();
+    }
+    return ret;
+  }
 };
 
 }  // namespace tachyon::crypto
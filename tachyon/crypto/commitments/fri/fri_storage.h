@@ -4,7 +4,11 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_STORAGE_H_
 #define TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_STORAGE_H_
 
-#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+#include <stddef.h>
+
+#include <vector>
+
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree_storage.h"
 
 namespace tachyon::crypto {
 
@@ -14,7 +18,13 @@ class FRIStorage {
   virtual ~FRIStorage() = default;
 
   virtual void Allocate(size_t size) = 0;
-  virtual BinaryMerkleTreeStorage<Hash>* GetLayer(size_t index) = 0;
+  virtual MerkleTreeStorage<Hash>* GetLayer(size_t index) = 0;
+
+  // Stores the evaluations of the |index|-th layer gathered by cosets, which
+  // are opened by |FRI::CreateOpeningProof()|.
+  virtual void SetEvaluations(size_t index,
+                              std::vector<Hash>&& evaluations) = 0;
+  virtual const std::vector<Hash>& GetEvaluations(size_t index) const = 0;
 };
 
 }  // namespace tachyon::crypto
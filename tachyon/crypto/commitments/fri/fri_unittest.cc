@@ -3,10 +3,14 @@
 
 #include "tachyon/crypto/commitments/fri/fri.h"
 
+#include <utility>
+#include <vector>
+
+#include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
-#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/merkle_tree/simple_merkle_tree_storage.h"
 #include "tachyon/crypto/transcripts/simple_transcript.h"
 #include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
@@ -16,45 +20,60 @@ namespace tachyon::crypto {
 
 namespace {
 
-class SimpleHasher
-    : public BinaryMerkleHasher<math::Goldilocks, math::Goldilocks> {
+class SimpleHasher : public MerkleHasher<math::Goldilocks, math::Goldilocks> {
  public:
-  // BinaryMerkleHasher<math::Goldilocks, math::Goldilocks> methods
+  // MerkleHasher<math::Goldilocks, math::Goldilocks> methods
   math::Goldilocks ComputeLeafHash(
       const math::Goldilocks& leaf) const override {
     return leaf;
   }
   math::Goldilocks ComputeParentHash(
-      const math::Goldilocks& left,
-      const math::Goldilocks& right) const override {
-    return left + right.Double();
+      absl::Span<const math::Goldilocks> children) const override {
+    math::Goldilocks ret = math::Goldilocks::Zero();
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+      ret = ret.Double() + *it;
+    }
+    return ret;
   }
 };
 
 class SimpleFRIStorage : public FRIStorage<math::Goldilocks> {
  public:
-  const std::vector<SimpleBinaryMerkleTreeStorage<math::Goldilocks>>& layers()
-      const {
+  const std::vector<SimpleMerkleTreeStorage<math::Goldilocks>>& layers() const {
     return layers_;
   }
 
   // FRIStorage<math::Goldilocks> methods
-  void Allocate(size_t size) override { layers_.resize(size); }
-  BinaryMerkleTreeStorage<math::Goldilocks>* GetLayer(size_t index) override {
+  void Allocate(size_t size) override {
+    layers_.resize(size);
+    evaluations_.resize(size);
+  }
+  MerkleTreeStorage<math::Goldilocks>* GetLayer(size_t index) override {
     return &layers_[index];
   }
+  void SetEvaluations(size_t index,
+                      std::vector<math::Goldilocks>&& evaluations) override {
+    evaluations_[index] = std::move(evaluations);
+  }
+  const std::vector<math::Goldilocks>& GetEvaluations(
+      size_t index) const override {
+    return evaluations_[index];
+  }
 
  private:
-  std::vector<SimpleBinaryMerkleTreeStorage<math::Goldilocks>> layers_;
+  std::vector<SimpleMerkleTreeStorage<math::Goldilocks>> layers_;
+  std::vector<std::vector<math::Goldilocks>> evaluations_;
 };
 
 class FRITest : public testing::Test {
  public:
-  constexpr static size_t K = 3;
+  constexpr static size_t K = 5;
   constexpr static size_t N = size_t{1} << K;
   constexpr static size_t kMaxDegree = N - 1;
 
-  using PCS = FRI<math::Goldilocks, kMaxDegree>;
+  template <size_t MerkleArity>
+  using GenericPCS = FRI<math::Goldilocks, kMaxDegree, MerkleArity>;
+  using PCS = GenericPCS<2>;
   using F = PCS::Field;
   using Poly = PCS::Poly;
   using Commitment = PCS::Commitment;
@@ -67,6 +86,33 @@ class FRITest : public testing::Test {
     pcs_ = PCS(domain_.get(), &storage_, &hasher_);
   }
 
+  template <size_t MerkleArity>
+  void TestMultiQuery(size_t folding_arity) {
+    SimpleFRIStorage storage;
+    GenericPCS<MerkleArity> pcs(domain_.get(), &storage, &hasher_,
+                                folding_arity);
+
+    Poly poly = Poly::Random(kMaxDegree);
+    base::Uint8VectorBuffer write_buffer;
+    SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+    ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+    std::vector<size_t> indices = base::CreateVector(10, []() {
+      return base::Uniform(base::Range<size_t>::Until(kMaxDegree + 1));
+    });
+    FRIProof<math::Goldilocks> proof;
+    ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+    EXPECT_EQ(proof.paths.size(), pcs.layer_arities().size());
+
+    SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+    reader.buffer().set_buffer_offset(0);
+    ASSERT_TRUE(pcs.VerifyOpeningProof(reader, indices, proof));
+
+    proof.evaluations.back()[0] += F::One();
+    reader.buffer().set_buffer_offset(0);
+    EXPECT_FALSE(pcs.VerifyOpeningProof(reader, indices, proof));
+  }
+
  protected:
   std::unique_ptr<Domain> domain_;
   SimpleFRIStorage storage_;
@@ -91,4 +137,19 @@ TEST_F(FRITest, CommitAndVerify) {
   ASSERT_TRUE(pcs_.VerifyOpeningProof(reader, index, proof));
 }
 
+TEST_F(FRITest, CommitAndVerifyMultiQuery) {
+  for (size_t folding_arity : {2, 4, 8, 16}) {
+    SCOPED_TRACE(absl::Substitute("folding_arity: $0", folding_arity));
+    TestMultiQuery<2>(folding_arity);
+  }
+}
+
+TEST_F(FRITest, CommitAndVerifyWithHigherArityMerkleTrees) {
+  for (size_t folding_arity : {2, 4, 8, 16}) {
+    SCOPED_TRACE(absl::Substitute("folding_arity: $0", folding_arity));
+    TestMultiQuery<4>(folding_arity);
+    TestMultiQuery<8>(folding_arity);
+  }
+}
+
 }  // namespace tachyon::crypto
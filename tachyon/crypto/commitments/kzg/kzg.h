@@ -11,12 +11,16 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/crypto/commitments/kzg/memory_mapped_srs.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
@@ -43,11 +47,21 @@ class KZG {
     CHECK_LE(g1_powers_of_tau_.size(), kMaxDegree + 1);
   }
 
-  const std::vector<G1Point>& g1_powers_of_tau() const {
+  // Uses the bases of the memory mapped |srs| without copying them. The |srs|
+  // can be shared with the other |KZG|s, for example, the ones for smaller
+  // domains.
+  explicit KZG(std::shared_ptr<const MemoryMappedSRS<G1Point>> srs)
+      : srs_(std::move(srs)), srs_size_(srs_->size()) {
+    CHECK_LE(srs_size_, kMaxDegree + 1);
+  }
+
+  absl::Span<const G1Point> g1_powers_of_tau() const {
+    if (srs_) return srs_->g1_powers_of_tau().subspan(0, srs_size_);
     return g1_powers_of_tau_;
   }
 
-  const std::vector<G1Point>& g1_powers_of_tau_lagrange() const {
+  absl::Span<const G1Point> g1_powers_of_tau_lagrange() const {
+    if (srs_) return srs_->g1_powers_of_tau_lagrange().subspan(0, srs_size_);
     return g1_powers_of_tau_lagrange_;
   }
 
@@ -66,7 +80,7 @@ class KZG {
     return batch_commitments;
   }
 
-  size_t N() const { return g1_powers_of_tau_.size(); }
+  size_t N() const { return g1_powers_of_tau().size(); }
 
   [[nodiscard]] bool UnsafeSetup(size_t size) {
     return UnsafeSetup(size, Field::Random());
@@ -76,6 +90,9 @@ class KZG {
     using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
     using Domain = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
 
+    srs_.reset();
+    srs_size_ = 0;
+
     // |g1_powers_of_tau_| = [𝜏⁰g₁, 𝜏¹g₁, ... , 𝜏ⁿ⁻¹g₁]
     G1Point g1 = G1Point::Generator();
     std::vector<Field> powers_of_tau = Field::GetSuccessivePowers(size, tau);
@@ -98,9 +115,14 @@ class KZG {
                                                &g1_powers_of_tau_lagrange_);
   }
 
-  // Return false if |n| >= |N()|.
+  // Return false if |n| >= |N()|. If the bases are memory mapped, only the
+  // first |n| of them are used from now on without a copy.
   [[nodiscard]] bool Downsize(size_t n) {
     if (n >= N()) return false;
+    if (srs_) {
+      srs_size_ = n;
+      return true;
+    }
     g1_powers_of_tau_.resize(n);
     g1_powers_of_tau_lagrange_.resize(n);
     return true;
@@ -108,34 +130,34 @@ class KZG {
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v, Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_, v, out);
+    return DoMSM(g1_powers_of_tau(), v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v,
                             BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_, v, state, index);
+    return DoMSM(g1_powers_of_tau(), v, state, index);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, out);
+    return DoMSM(g1_powers_of_tau_lagrange(), v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, state, index);
+    return DoMSM(g1_powers_of_tau_lagrange(), v, state, index);
   }
 
  private:
-  template <typename BaseContainer, typename ScalarContainer>
-  static bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
-                    Commitment* out) {
+  template <typename ScalarContainer>
+  static bool DoMSM(absl::Span<const G1Point> bases,
+                    const ScalarContainer& scalars, Commitment* out) {
     math::VariableBaseMSM<G1Point> msm;
-    absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
-        bases.data(), std::min(bases.size(), scalars.size()));
+    absl::Span<const G1Point> bases_span =
+        bases.subspan(0, std::min(bases.size(), scalars.size()));
     if constexpr (std::is_same_v<Commitment, Bucket>) {
       return msm.Run(bases_span, scalars, out);
     } else {
@@ -146,17 +168,21 @@ class KZG {
     }
   }
 
-  template <typename BaseContainer, typename ScalarContainer>
-  bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
+  template <typename ScalarContainer>
+  bool DoMSM(absl::Span<const G1Point> bases, const ScalarContainer& scalars,
              BatchCommitmentState& state, size_t index) {
     math::VariableBaseMSM<G1Point> msm;
-    absl::Span<const G1Point> bases_span = absl::Span<const G1Point>(
-        bases.data(), std::min(bases.size(), scalars.size()));
+    absl::Span<const G1Point> bases_span =
+        bases.subspan(0, std::min(bases.size(), scalars.size()));
     return msm.Run(bases_span, scalars, &batch_commitments_[index]);
   }
 
   std::vector<G1Point> g1_powers_of_tau_;
   std::vector<G1Point> g1_powers_of_tau_lagrange_;
+  // If set, the bases are the first |srs_size_| points of |srs_| instead of
+  // the vectors above.
+  std::shared_ptr<const MemoryMappedSRS<G1Point>> srs_;
+  size_t srs_size_ = 0;
   std::vector<Bucket> batch_commitments_;
 };
 
@@ -170,8 +196,8 @@ class Copyable<crypto::KZG<G1Point, MaxDegree, Commitment>> {
   using PCS = crypto::KZG<G1Point, MaxDegree, Commitment>;
 
   static bool WriteTo(const PCS& pcs, Buffer* buffer) {
-    return buffer->WriteMany(pcs.g1_powers_of_tau(),
-                             pcs.g1_powers_of_tau_lagrange());
+    return WritePoints(pcs.g1_powers_of_tau(), buffer) &&
+           WritePoints(pcs.g1_powers_of_tau_lagrange(), buffer);
   }
 
   static bool ReadFrom(const Buffer& buffer, PCS* pcs) {
@@ -187,8 +213,26 @@ class Copyable<crypto::KZG<G1Point, MaxDegree, Commitment>> {
   }
 
   static size_t EstimateSize(const PCS& pcs) {
-    return base::EstimateSize(pcs.g1_powers_of_tau()) +
-           base::EstimateSize(pcs.g1_powers_of_tau_lagrange());
+    return EstimatePointsSize(pcs.g1_powers_of_tau()) +
+           EstimatePointsSize(pcs.g1_powers_of_tau_lagrange());
+  }
+
+ private:
+  // Same as |Copyable<std::vector<G1Point>>|, so that the memory mapped bases
+  // are written in the same format.
+  static bool WritePoints(absl::Span<const G1Point> points, Buffer* buffer) {
+    if (!buffer->Write(points.size())) return false;
+    for (const G1Point& point : points) {
+      if (!buffer->Write(point)) return false;
+    }
+    return true;
+  }
+
+  static size_t EstimatePointsSize(absl::Span<const G1Point> points) {
+    return std::accumulate(points.begin(), points.end(), sizeof(size_t),
+                           [](size_t total, const G1Point& point) {
+                             return total + base::EstimateSize(point);
+                           });
   }
 };
 
@@ -0,0 +1,187 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_MEMORY_MAPPED_SRS_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_MEMORY_MAPPED_SRS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <new>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::crypto {
+
+// The structured reference string of |KZG| backed by a memory mapped file.
+//
+// | Section                   | Contents                                  |
+// |---------------------------|-------------------------------------------|
+// | header                    | magic, version, the size of a point and n |
+// | g1_powers_of_tau          | n raw points                              |
+// | g1_powers_of_tau_lagrange | n raw points                              |
+//
+// The points are stored as they are in memory, that is, affine points whose
+// coordinates are in the Montgomery form, and each array starts at an offset
+// aligned to |kAlignment|. So the bases are handed to the MSM without any
+// copy or conversion, and the pages of the file are read lazily by the kernel
+// when they are touched first. A proof at a smaller k only touches the prefix
+// of the arrays it needs. See |KZG::Downsize()|.
+template <typename G1Point>
+class MemoryMappedSRS {
+ public:
+  static_assert(base::IsTriviallySerializable<G1Point>::value);
+
+  // "TACHSRS\0" in the little endian.
+  constexpr static uint64_t kMagic = 0x0053525348434154;
+  // Bump this whenever the layout of the file changes.
+  constexpr static uint32_t kVersion = 1;
+  // The page size, so that the arrays don't share a page with the header.
+  constexpr static size_t kAlignment = 4096;
+
+  MemoryMappedSRS() = default;
+  MemoryMappedSRS(const MemoryMappedSRS& other) = delete;
+  MemoryMappedSRS& operator=(const MemoryMappedSRS& other) = delete;
+
+  absl::Span<const G1Point> g1_powers_of_tau() const {
+    return g1_powers_of_tau_;
+  }
+
+  absl::Span<const G1Point> g1_powers_of_tau_lagrange() const {
+    return g1_powers_of_tau_lagrange_;
+  }
+
+  size_t size() const { return g1_powers_of_tau_.size(); }
+
+  // Writes the bases in the format described above.
+  [[nodiscard]] static bool Write(
+      absl::Span<const G1Point> g1_powers_of_tau,
+      absl::Span<const G1Point> g1_powers_of_tau_lagrange,
+      base::Buffer* buffer) {
+    if (g1_powers_of_tau.size() != g1_powers_of_tau_lagrange.size()) {
+      LOG(ERROR) << "The sizes of the bases don't match";
+      return false;
+    }
+    if (!buffer->WriteMany(kMagic, kVersion, uint64_t{sizeof(G1Point)},
+                           uint64_t{g1_powers_of_tau.size()})) {
+      return false;
+    }
+    return WritePoints(g1_powers_of_tau, buffer) &&
+           WritePoints(g1_powers_of_tau_lagrange, buffer);
+  }
+
+  // Maps the file at |path| written by |Write()|. If |use_huge_pages| is
+  // true, the kernel is asked to back the bases with huge pages, which is
+  // ignored if it isn't supported.
+  [[nodiscard]] bool Load(const base::FilePath& path, bool use_huge_pages) {
+    if (!file_.Initialize(path)) return false;
+    const base::Buffer buffer =
+        base::Buffer::CreateReadOnly(file_.data(), file_.length());
+
+    uint64_t magic;
+    uint32_t version;
+    uint64_t point_size;
+    uint64_t n;
+    if (!buffer.ReadMany(&magic, &version, &point_size, &n)) return false;
+    if (magic != kMagic) {
+      LOG(ERROR) << "Not an SRS file or written in a different byte order";
+      return false;
+    }
+    if (version != kVersion) {
+      LOG(ERROR) << "Unsupported SRS file version: " << version
+                 << " (expected " << kVersion << ")";
+      return false;
+    }
+    if (point_size != sizeof(G1Point)) {
+      LOG(ERROR) << "The SRS file is for a point of size " << point_size
+                 << ", not " << sizeof(G1Point);
+      return false;
+    }
+    if (!ReadPoints(buffer, n, &g1_powers_of_tau_) ||
+        !ReadPoints(buffer, n, &g1_powers_of_tau_lagrange_)) {
+      return false;
+    }
+
+    if (use_huge_pages && size() > 0) {
+      size_t offset = GetOffset(g1_powers_of_tau_.data());
+      if (!file_.Advise(offset, file_.length() - offset,
+                        base::MemoryMappedFile::Advice::kHugePage)) {
+        LOG(WARNING) << "Huge pages are not used for the SRS";
+      }
+    }
+    return true;
+  }
+
+  // Asks the kernel to read the first |n| bases of both arrays ahead, so that
+  // the first MSMs don't stall on the page faults.
+  [[nodiscard]] bool Prefetch(size_t n) const {
+    n = std::min(n, size());
+    return file_.Advise(GetOffset(g1_powers_of_tau_.data()),
+                        n * sizeof(G1Point),
+                        base::MemoryMappedFile::Advice::kWillNeed) &&
+           file_.Advise(GetOffset(g1_powers_of_tau_lagrange_.data()),
+                        n * sizeof(G1Point),
+                        base::MemoryMappedFile::Advice::kWillNeed);
+  }
+
+ private:
+  static size_t GetPadding(size_t offset) {
+    return (kAlignment - offset % kAlignment) % kAlignment;
+  }
+
+  // The padding of a point isn't initialized, so the points are constructed
+  // again from their coordinates in zeroed chunks. Otherwise the same bases
+  // would be written to the files that differ in their padding.
+  static bool WritePoints(absl::Span<const G1Point> points,
+                          base::Buffer* buffer) {
+    constexpr size_t kChunkSize = 1024;
+
+    uint8_t zeros[kAlignment] = {0};
+    if (!buffer->Write(zeros, GetPadding(buffer->buffer_offset()))) {
+      return false;
+    }
+    std::vector<uint8_t> chunk(kChunkSize * sizeof(G1Point));
+    for (size_t i = 0; i < points.size(); i += kChunkSize) {
+      size_t size = std::min(kChunkSize, points.size() - i);
+      std::fill(chunk.begin(), chunk.end(), 0);
+      for (size_t j = 0; j < size; ++j) {
+        const G1Point& point = points[i + j];
+        new (&chunk[j * sizeof(G1Point)])
+            G1Point(point.x(), point.y(), point.infinity());
+      }
+      if (!buffer->Write(chunk.data(), size * sizeof(G1Point))) return false;
+    }
+    return true;
+  }
+
+  // The points aren't validated. Checking that they are on the curve, or even
+  // that their infinity flags are 0 or 1, would touch every page of the file,
+  // which is what the lazy mapping avoids, so the file is trusted.
+  static bool ReadPoints(const base::Buffer& buffer, uint64_t n,
+                         absl::Span<const G1Point>* points) {
+    size_t offset = buffer.buffer_offset();
+    buffer.set_buffer_offset(
+        std::min(offset + GetPadding(offset), buffer.buffer_len()));
+    if (!buffer.ReadRawView(n, points)) {
+      LOG(ERROR) << "The SRS file is truncated";
+      return false;
+    }
+    return true;
+  }
+
+  size_t GetOffset(const G1Point* point) const {
+    return reinterpret_cast<const uint8_t*>(point) - file_.data();
+  }
+
+  base::MemoryMappedFile file_;
+  absl::Span<const G1Point> g1_powers_of_tau_;
+  absl::Span<const G1Point> g1_powers_of_tau_lagrange_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_MEMORY_MAPPED_SRS_H_
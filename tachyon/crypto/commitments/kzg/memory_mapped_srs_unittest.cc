@@ -0,0 +1,124 @@
+#include "tachyon/crypto/commitments/kzg/memory_mapped_srs.h"
+
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/crypto/commitments/kzg/kzg.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t K = 3;
+constexpr size_t N = size_t{1} << K;
+constexpr size_t kMaxDegree = N - 1;
+
+class MemoryMappedSRSTest : public testing::Test {
+ public:
+  using SRS = MemoryMappedSRS<math::bn254::G1AffinePoint>;
+  using PCS =
+      KZG<math::bn254::G1AffinePoint, kMaxDegree, math::bn254::G1AffinePoint>;
+  using Poly = math::UnivariateDensePolynomial<math::bn254::Fr, kMaxDegree>;
+
+  static void SetUpTestSuite() { math::bn254::G1Curve::Init(); }
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    ASSERT_TRUE(pcs_.UnsafeSetup(N));
+
+    srs_path_ = temp_dir_.GetPath().Append("srs");
+    base::Uint8VectorBuffer buffer;
+    ASSERT_TRUE(SRS::Write(pcs_.g1_powers_of_tau(),
+                           pcs_.g1_powers_of_tau_lagrange(), &buffer));
+    ASSERT_TRUE(base::WriteFile(srs_path_, buffer.owned_buffer()));
+  }
+
+ protected:
+  base::ScopedTempDir temp_dir_;
+  base::FilePath srs_path_;
+  PCS pcs_;
+};
+
+}  // namespace
+
+TEST_F(MemoryMappedSRSTest, Load) {
+  for (bool use_huge_pages : {false, true}) {
+    SRS srs;
+    ASSERT_TRUE(srs.Load(srs_path_, use_huge_pages));
+    EXPECT_EQ(srs.size(), N);
+    EXPECT_EQ(srs.g1_powers_of_tau(), pcs_.g1_powers_of_tau());
+    EXPECT_EQ(srs.g1_powers_of_tau_lagrange(),
+              pcs_.g1_powers_of_tau_lagrange());
+    EXPECT_TRUE(srs.Prefetch(N / 2));
+  }
+}
+
+TEST_F(MemoryMappedSRSTest, WriteZeroesPadding) {
+  using G1Point = math::bn254::G1AffinePoint;
+
+  // Copies the bases into memory whose padding is not zero.
+  auto copy_with_garbage = [](absl::Span<const G1Point> points,
+                              std::vector<uint8_t>* bytes) {
+    bytes->assign(points.size() * sizeof(G1Point), 0xff);
+    for (size_t i = 0; i < points.size(); ++i) {
+      new (&(*bytes)[i * sizeof(G1Point)])
+          G1Point(points[i].x(), points[i].y(), points[i].infinity());
+    }
+    return absl::MakeConstSpan(reinterpret_cast<const G1Point*>(bytes->data()),
+                               points.size());
+  };
+  std::vector<uint8_t> g1_powers_of_tau;
+  std::vector<uint8_t> g1_powers_of_tau_lagrange;
+
+  base::Uint8VectorBuffer expected;
+  ASSERT_TRUE(SRS::Write(pcs_.g1_powers_of_tau(),
+                         pcs_.g1_powers_of_tau_lagrange(), &expected));
+  base::Uint8VectorBuffer buffer;
+  ASSERT_TRUE(SRS::Write(
+      copy_with_garbage(pcs_.g1_powers_of_tau(), &g1_powers_of_tau),
+      copy_with_garbage(pcs_.g1_powers_of_tau_lagrange(),
+                        &g1_powers_of_tau_lagrange),
+      &buffer));
+  EXPECT_EQ(buffer.owned_buffer(), expected.owned_buffer());
+}
+
+TEST_F(MemoryMappedSRSTest, LoadInvalidFile) {
+  base::FilePath path = temp_dir_.GetPath().Append("invalid");
+  ASSERT_TRUE(base::WriteFile(path, "not an srs file"));
+
+  SRS srs;
+  EXPECT_FALSE(srs.Load(path, false));
+}
+
+TEST_F(MemoryMappedSRSTest, Commit) {
+  auto srs = std::make_shared<SRS>();
+  ASSERT_TRUE(srs->Load(srs_path_, false));
+  PCS pcs(srs);
+  EXPECT_EQ(pcs.N(), N);
+
+  Poly poly = Poly::Random(N - 1);
+  math::bn254::G1AffinePoint expected;
+  ASSERT_TRUE(pcs_.Commit(poly.coefficients().coefficients(), &expected));
+  math::bn254::G1AffinePoint commitment;
+  ASSERT_TRUE(pcs.Commit(poly.coefficients().coefficients(), &commitment));
+  EXPECT_EQ(commitment, expected);
+
+  // The smaller domain shares the same mapping.
+  PCS small_pcs(srs);
+  ASSERT_TRUE(small_pcs.Downsize(N / 2));
+  ASSERT_TRUE(pcs_.Downsize(N / 2));
+  EXPECT_EQ(small_pcs.N(), N / 2);
+  EXPECT_EQ(small_pcs.g1_powers_of_tau(), pcs_.g1_powers_of_tau());
+  EXPECT_EQ(small_pcs.g1_powers_of_tau_lagrange(),
+            pcs_.g1_powers_of_tau_lagrange());
+  EXPECT_EQ(pcs.N(), N);
+}
+
+}  // namespace tachyon::crypto
@@ -4,6 +4,12 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+
 namespace tachyon::crypto {
 
 template <typename Leaf, typename Hash>
@@ -14,6 +20,16 @@ class BinaryMerkleHasher {
   virtual Hash ComputeLeafHash(const Leaf& leaf) const = 0;
 
   virtual Hash ComputeParentHash(const Hash& left, const Hash& right) const = 0;
+
+  // Computes |parents[i]| from |children[2 * i]| and |children[2 * i + 1]|.
+  // Hashers that can hash several nodes at once should override this.
+  virtual void ComputeParentHashes(absl::Span<const Hash> children,
+                                   absl::Span<Hash> parents) const {
+    DCHECK_EQ(children.size(), parents.size() * 2);
+    for (size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = ComputeParentHash(children[i << 1], children[(i << 1) + 1]);
+    }
+  }
 };
 
 }  // namespace tachyon::crypto
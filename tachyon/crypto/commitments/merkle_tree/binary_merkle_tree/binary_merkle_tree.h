@@ -5,9 +5,11 @@
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_TREE_H_
 
 #include <algorithm>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/bits.h"
@@ -15,22 +17,32 @@
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/range.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_proof.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/flat_binary_merkle_tree_storage.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
 
 namespace tachyon::crypto {
 
-template <typename Leaf, typename Hash, size_t MaxSize>
+// |Storage| is either |BinaryMerkleTreeStorage<Hash>| or a final class
+// derived from it. If it is |FlatBinaryMerkleTreeStorage<Hash>|, the tree is
+// built layer by layer directly on its buffer.
+template <typename Leaf, typename Hash, size_t MaxSize,
+          typename Storage = BinaryMerkleTreeStorage<Hash>>
 class BinaryMerkleTree final
-    : public VectorCommitmentScheme<BinaryMerkleTree<Leaf, Hash, MaxSize>> {
+    : public VectorCommitmentScheme<
+          BinaryMerkleTree<Leaf, Hash, MaxSize, Storage>> {
  public:
+  static_assert(std::is_base_of_v<BinaryMerkleTreeStorage<Hash>, Storage>);
+
   constexpr static size_t kDefaultLeavesSizeForParallelization = 1024;
+  constexpr static bool kIsFlatStorage =
+      std::is_same_v<Storage, FlatBinaryMerkleTreeStorage<Hash>>;
 
   BinaryMerkleTree() = default;
-  BinaryMerkleTree(BinaryMerkleTreeStorage<Hash>* storage,
-                   BinaryMerkleHasher<Leaf, Hash>* hasher)
+  BinaryMerkleTree(Storage* storage, BinaryMerkleHasher<Leaf, Hash>* hasher)
       : storage_(storage), hasher_(hasher) {}
 
   size_t leaves_size_for_parallelization() const {
@@ -46,7 +58,8 @@ class BinaryMerkleTree final
   FRIEND_TEST(BinaryMerkleTreeTest, FillLeaves);
   FRIEND_TEST(BinaryMerkleTreeTest, BuildTreeFromLeaves);
 
-  friend class VectorCommitmentScheme<BinaryMerkleTree<Leaf, Hash, MaxSize>>;
+  friend class VectorCommitmentScheme<
+      BinaryMerkleTree<Leaf, Hash, MaxSize, Storage>>;
 
   // VectorCommitmentScheme methods
   size_t N() const { return MaxSize; }
@@ -55,6 +68,13 @@ class BinaryMerkleTree final
   [[nodiscard]] bool DoCommit(const Container& leaves, Hash* out) const {
     if (!FillLeaves(leaves)) return false;
 
+    size_t leaves_size = std::size(leaves);
+    if constexpr (kIsFlatStorage) {
+      BuildTreeByLayers(leaves_size);
+      *out = storage_->GetHash(0);
+      return true;
+    }
+
     // For instance, if |leaves_size_for_parallelization_| equals 4, the
     // subtrees with root indices 1 and 2 will be constructed.
     //
@@ -64,7 +84,6 @@ class BinaryMerkleTree final
     // 7 8 9 10 11 12 13 14
     //
     // Finally, the remaining tree should be constructed from leaves 1 and 2.
-    size_t leaves_size = std::size(leaves);
     if (leaves_size > leaves_size_for_parallelization_) {
       OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size;
                           i += leaves_size_for_parallelization_) {
@@ -76,7 +95,7 @@ class BinaryMerkleTree final
                  base::bits::Log2Floor(leaves_size_for_parallelization_);
       BuildTreeFromLeaves(
           base::Range<size_t>((1 << i) - 1, (1 << (i + 1)) - 1));
-    } else {
+    } else if (leaves_size > 1) {
       BuildTreeFromLeaves(
           base::Range<size_t>(leaves_size - 1, (leaves_size << 1) - 1));
     }
@@ -151,16 +170,39 @@ class BinaryMerkleTree final
     }
   }
 
+  // Builds the tree from the leaves to the root one layer at a time. Layers
+  // that have more than |leaves_size_for_parallelization_| nodes are split
+  // into chunks of at least that many nodes that are hashed in parallel.
+  void BuildTreeByLayers(size_t leaves_size) const {
+    absl::Span<Hash> hashes = storage_->hashes();
+    size_t size = leaves_size;
+    while (size > 1) {
+      size_t parents_size = size >> 1;
+      absl::Span<const Hash> children = hashes.subspan(size - 1, size);
+      absl::Span<Hash> parents = hashes.subspan(parents_size - 1, parents_size);
+      base::ParallelForRange(
+          parents_size,
+          [this, children, parents](size_t begin, size_t end) {
+            hasher_->ComputeParentHashes(
+                children.subspan(begin << 1, (end - begin) << 1),
+                parents.subspan(begin, end - begin));
+          },
+          leaves_size_for_parallelization_);
+      size = parents_size;
+    }
+  }
+
   // not owned
-  mutable BinaryMerkleTreeStorage<Hash>* storage_ = nullptr;
+  mutable Storage* storage_ = nullptr;
   // not owned
   BinaryMerkleHasher<Leaf, Hash>* hasher_ = nullptr;
   size_t leaves_size_for_parallelization_ =
       kDefaultLeavesSizeForParallelization;
 };
 
-template <typename Leaf, typename Hash, size_t MaxSize>
-struct VectorCommitmentSchemeTraits<BinaryMerkleTree<Leaf, Hash, MaxSize>> {
+template <typename Leaf, typename Hash, size_t MaxSize, typename Storage>
+struct VectorCommitmentSchemeTraits<
+    BinaryMerkleTree<Leaf, Hash, MaxSize, Storage>> {
  public:
   constexpr static size_t kMaxSize = MaxSize;
   constexpr static bool kIsTransparent = true;
@@ -0,0 +1,62 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/flat_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t kMaxK = 26;
+constexpr size_t kMaxSize = size_t{1} << kMaxK;
+
+using F = math::Goldilocks;
+
+class SimpleHasher : public BinaryMerkleHasher<F, F> {
+ public:
+  // BinaryMerkleHasher<F, F> methods
+  F ComputeLeafHash(const F& leaf) const override { return leaf; }
+  F ComputeParentHash(const F& left, const F& right) const override {
+    return left + right.Double();
+  }
+};
+
+}  // namespace
+
+// |state.range(0)|: log₂ of the number of leaves
+template <typename Storage, typename VCSStorage>
+void BM_BinaryMerkleTreeCommit(benchmark::State& state) {
+  F::Init();
+  size_t n = size_t{1} << state.range(0);
+
+  using VCS = BinaryMerkleTree<F, F, kMaxSize, VCSStorage>;
+  Storage storage;
+  SimpleHasher hasher;
+  VCS vcs(&storage, &hasher);
+
+  std::vector<F> leaves = base::CreateVector(n, []() { return F::Random(); });
+  F commitment;
+  for (auto _ : state) {
+    CHECK(vcs.Commit(leaves, &commitment));
+  }
+  benchmark::DoNotOptimize(commitment);
+}
+
+// Every call to the storage and the hasher goes through a vtable and
+// subtrees are built node by node.
+BENCHMARK_TEMPLATE(BM_BinaryMerkleTreeCommit, SimpleBinaryMerkleTreeStorage<F>,
+                   BinaryMerkleTreeStorage<F>)
+    ->DenseRange(20, kMaxK, 2)
+    ->Unit(benchmark::kMillisecond);
+// The tree is built layer by layer on a single contiguous buffer.
+BENCHMARK_TEMPLATE(BM_BinaryMerkleTreeCommit, FlatBinaryMerkleTreeStorage<F>,
+                   FlatBinaryMerkleTreeStorage<F>)
+    ->DenseRange(20, kMaxK, 2)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::crypto
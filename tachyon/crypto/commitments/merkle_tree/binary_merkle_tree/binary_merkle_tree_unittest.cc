@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/flat_binary_merkle_tree_storage.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
 
 namespace tachyon::crypto {
@@ -111,4 +112,33 @@ TEST_F(BinaryMerkleTreeTest, CommitAndVerify) {
   ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, leaf_hash, proof));
 }
 
+TEST_F(BinaryMerkleTreeTest, CommitWithFlatStorage) {
+  CreateLeaves();
+
+  int commitment;
+  ASSERT_TRUE(vcs_.Commit(leaves_, &commitment));
+
+  using FlatVCS =
+      BinaryMerkleTree<int, int, N, FlatBinaryMerkleTreeStorage<int>>;
+  FlatBinaryMerkleTreeStorage<int> flat_storage;
+  FlatVCS flat_vcs(&flat_storage, &hasher_);
+  flat_vcs.set_leaves_size_for_parallelization(N >> 2);
+
+  int flat_commitment;
+  ASSERT_TRUE(flat_vcs.Commit(leaves_, &flat_commitment));
+  EXPECT_EQ(flat_commitment, commitment);
+  EXPECT_EQ(flat_storage.hashes(), absl::MakeConstSpan(storage_.hashes()));
+
+  std::vector<int> expected_layer = {2, 8, 14, 20};
+  EXPECT_EQ(flat_storage.GetLayer(2), absl::MakeConstSpan(expected_layer));
+
+  BinaryMerkleProof<int> proof;
+  ASSERT_TRUE(vcs_.CreateOpeningProof(3, &proof));
+  BinaryMerkleProof<int> flat_proof;
+  ASSERT_TRUE(flat_vcs.CreateOpeningProof(3, &flat_proof));
+  EXPECT_EQ(flat_proof, proof);
+  ASSERT_TRUE(flat_vcs.VerifyOpeningProof(
+      flat_commitment, hasher_.ComputeLeafHash(leaves_[3]), flat_proof));
+}
+
 }  // namespace tachyon::crypto
@@ -0,0 +1,47 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_FLAT_BINARY_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_FLAT_BINARY_MERKLE_TREE_STORAGE_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+// Stores the nodes in a single contiguous buffer, layer by layer from the
+// root to the leaves. The nodes of the layer at depth d are at
+// [2ᵈ - 1, 2ᵈ⁺¹ - 1). Since this is final, |BinaryMerkleTree| that is
+// instantiated with this calls the methods without virtual dispatch and builds
+// the tree layer by layer through |BinaryMerkleHasher::ComputeParentHashes()|.
+template <typename Hash>
+class FlatBinaryMerkleTreeStorage final : public BinaryMerkleTreeStorage<Hash> {
+ public:
+  absl::Span<Hash> hashes() { return absl::MakeSpan(hashes_); }
+  absl::Span<const Hash> hashes() const { return absl::MakeConstSpan(hashes_); }
+
+  // Returns the nodes of the layer at |depth|.
+  absl::Span<Hash> GetLayer(size_t depth) {
+    return absl::MakeSpan(&hashes_[(size_t{1} << depth) - 1],
+                          size_t{1} << depth);
+  }
+  absl::Span<const Hash> GetLayer(size_t depth) const {
+    return absl::MakeConstSpan(&hashes_[(size_t{1} << depth) - 1],
+                               size_t{1} << depth);
+  }
+
+  // BinaryMerkleTreeStorage<Hash> methods
+  void Allocate(size_t size) override { hashes_.resize(size); }
+  size_t GetSize() const override { return hashes_.size(); }
+  const Hash& GetHash(size_t i) const override { return hashes_[i]; }
+  void SetHash(size_t i, const Hash& hash) override { hashes_[i] = hash; }
+
+ private:
+  std::vector<Hash> hashes_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_FLAT_BINARY_MERKLE_TREE_STORAGE_H_
@@ -0,0 +1,46 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON_BINARY_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON_BINARY_MERKLE_HASHER_H_
+
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_batch_hasher.h"
+
+namespace tachyon::crypto {
+
+// Hashes a leaf by absorbing it into a Poseidon sponge, and a parent by
+// absorbing its left and right children. A whole layer of parents is hashed
+// at once with |PoseidonBatchHasher|.
+template <typename F, size_t Width>
+class PoseidonBinaryMerkleHasher final : public BinaryMerkleHasher<F, F> {
+ public:
+  static_assert(Width >= 3, "Two children must fit into the rate");
+
+  explicit PoseidonBinaryMerkleHasher(
+      const OptimizedPoseidonConfig<F, Width>* config)
+      : hasher_(config) {}
+
+  // BinaryMerkleHasher<F, F> methods
+  F ComputeLeafHash(const F& leaf) const override {
+    return hasher_.Hash(absl::MakeConstSpan(&leaf, 1));
+  }
+
+  F ComputeParentHash(const F& left, const F& right) const override {
+    F children[] = {left, right};
+    return hasher_.Hash(absl::MakeConstSpan(children));
+  }
+
+  void ComputeParentHashes(absl::Span<const F> children,
+                           absl::Span<F> parents) const override {
+    hasher_.Hash(children, 2, parents);
+  }
+
+ private:
+  PoseidonBatchHasher<F, Width> hasher_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON_BINARY_MERKLE_HASHER_H_
@@ -0,0 +1,80 @@
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/poseidon_binary_merkle_hasher.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/flat_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/optimized_poseidon.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class PoseidonBinaryMerkleHasherTest : public testing::Test {
+ public:
+  constexpr static size_t kWidth = 3;
+  constexpr static size_t N = 32;
+
+  using F = math::bn254::Fr;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  void SetUp() override {
+    config_ = OptimizedPoseidonConfig<F, kWidth>::Create(
+        PoseidonConfig<F>::CreateDefault(kWidth - 1, false));
+  }
+
+  F Hash(const std::vector<F>& inputs) const {
+    OptimizedPoseidonSponge<F, kWidth> sponge(config_);
+    CHECK(sponge.Absorb(inputs));
+    return sponge.SqueezeNativeFieldElements(1)[0];
+  }
+
+ protected:
+  OptimizedPoseidonConfig<F, kWidth> config_;
+};
+
+}  // namespace
+
+TEST_F(PoseidonBinaryMerkleHasherTest, ComputeHashes) {
+  PoseidonBinaryMerkleHasher<F, kWidth> hasher(&config_);
+  F a = F::Random();
+  F b = F::Random();
+  EXPECT_EQ(hasher.ComputeLeafHash(a), Hash({a}));
+  EXPECT_EQ(hasher.ComputeParentHash(a, b), Hash({a, b}));
+
+  std::vector<F> children =
+      base::CreateVector(2 * N, []() { return F::Random(); });
+  std::vector<F> parents(N);
+  hasher.ComputeParentHashes(children, absl::MakeSpan(parents));
+  for (size_t i = 0; i < N; ++i) {
+    EXPECT_EQ(parents[i],
+              hasher.ComputeParentHash(children[2 * i], children[2 * i + 1]));
+  }
+}
+
+TEST_F(PoseidonBinaryMerkleHasherTest, Commit) {
+  PoseidonBinaryMerkleHasher<F, kWidth> hasher(&config_);
+  std::vector<F> leaves = base::CreateVector(N, []() { return F::Random(); });
+
+  SimpleBinaryMerkleTreeStorage<F> storage;
+  BinaryMerkleTree<F, F, N> tree(&storage, &hasher);
+  tree.set_leaves_size_for_parallelization(4);
+  F commitment;
+  ASSERT_TRUE(tree.Commit(leaves, &commitment));
+
+  FlatBinaryMerkleTreeStorage<F> flat_storage;
+  BinaryMerkleTree<F, F, N, FlatBinaryMerkleTreeStorage<F>> flat_tree(
+      &flat_storage, &hasher);
+  flat_tree.set_leaves_size_for_parallelization(4);
+  F flat_commitment;
+  ASSERT_TRUE(flat_tree.Commit(leaves, &flat_commitment));
+  EXPECT_EQ(flat_commitment, commitment);
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,38 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_HASHER_H_
+
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::crypto {
+
+template <typename Leaf, typename Hash>
+class MerkleHasher {
+ public:
+  virtual ~MerkleHasher() = default;
+
+  virtual Hash ComputeLeafHash(const Leaf& leaf) const = 0;
+
+  // Computes the hash of a parent from the hashes of its |children|. The size
+  // of |children| is always the arity of the tree.
+  virtual Hash ComputeParentHash(absl::Span<const Hash> children) const = 0;
+
+  // Computes |parents[i]| from the i-th group of the arity hashes in
+  // |children|. Hashers that hash several nodes faster at once than one by one
+  // should override this.
+  virtual void ComputeParentHashes(absl::Span<const Hash> children,
+                                   absl::Span<Hash> parents) const {
+    size_t arity = children.size() / parents.size();
+    DCHECK_EQ(children.size(), arity * parents.size());
+    for (size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = ComputeParentHash(children.subspan(i * arity, arity));
+    }
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_HASHER_H_
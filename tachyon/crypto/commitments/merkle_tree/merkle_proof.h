@@ -0,0 +1,39 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_PROOF_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_PROOF_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+namespace tachyon::crypto {
+
+// Proof that opens one or more leaves of a Merkle tree at once. Sibling
+// hashes that are shared by the opened leaves or can be computed from them
+// are included only once.
+template <typename Hash>
+struct MerkleMultiProof {
+  // Sibling hashes ordered by level from the leaves to the root, and then by
+  // node index within the same level.
+  std::vector<Hash> hashes;
+
+  bool operator==(const MerkleMultiProof& other) const {
+    return hashes == other.hashes;
+  }
+  bool operator!=(const MerkleMultiProof& other) const {
+    return hashes != other.hashes;
+  }
+};
+
+// Leaves that are claimed to be opened by a |MerkleMultiProof|.
+template <typename Hash>
+struct MerkleOpenings {
+  // The number of leaves of the tree.
+  size_t leaves_size = 0;
+  // Pairs of a leaf index and its leaf hash.
+  std::vector<std::pair<size_t, Hash>> leaves;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_PROOF_H_
@@ -0,0 +1,265 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/checked_math.h"
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_hasher.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_proof.h"
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree_storage.h"
+#include "tachyon/crypto/commitments/vector_commitment_scheme.h"
+
+namespace tachyon::crypto {
+
+// Merkle tree where every inner node has |Arity| children. The nodes are
+// stored in level order, so the children of the node i are
+// [|Arity| * i + 1, |Arity| * i + |Arity|] and the root is at 0.
+//
+// If the number of leaves is not a power of |Arity|, the leaves are padded
+// with the default value of |Hash| up to the next power of |Arity|. The
+// padding is used as a leaf hash as it is.
+template <typename Leaf, typename Hash, size_t Arity, size_t MaxSize>
+class MerkleTree final
+    : public VectorCommitmentScheme<MerkleTree<Leaf, Hash, Arity, MaxSize>> {
+ public:
+  static_assert(Arity >= 2, "Arity must be at least 2");
+
+  constexpr static size_t kArity = Arity;
+  constexpr static size_t kDefaultLayerSizeForParallelization = 1024;
+
+  MerkleTree() = default;
+  MerkleTree(MerkleTreeStorage<Hash>* storage,
+             MerkleHasher<Leaf, Hash>* hasher)
+      : storage_(storage), hasher_(hasher) {}
+
+  void set_layer_size_for_parallelization(
+      size_t layer_size_for_parallelization) {
+    layer_size_for_parallelization_ = layer_size_for_parallelization;
+  }
+
+  // Returns the smallest power of |Arity| that is not less than
+  // |leaves_size|.
+  static size_t GetPaddedLeavesSize(size_t leaves_size) {
+    base::CheckedNumeric<size_t> ret = 1;
+    while (ret.ValueOrDie() < leaves_size) {
+      ret *= Arity;
+    }
+    return ret.ValueOrDie();
+  }
+
+ private:
+  friend class VectorCommitmentScheme<MerkleTree<Leaf, Hash, Arity, MaxSize>>;
+
+  // VectorCommitmentScheme methods
+  size_t N() const { return MaxSize; }
+
+  template <typename Container>
+  [[nodiscard]] bool DoCommit(const Container& leaves, Hash* out) const {
+    size_t leaves_size = std::size(leaves);
+    if (leaves_size == 0) {
+      LOG(ERROR) << "No leaves to commit";
+      return false;
+    }
+    if (leaves_size > MaxSize) {
+      LOG(ERROR) << "Too many leaves";
+      return false;
+    }
+
+    size_t padded_leaves_size = GetPaddedLeavesSize(leaves_size);
+    size_t offset = GetNumInnerNodes(padded_leaves_size);
+    storage_->Allocate(offset + padded_leaves_size, leaves_size);
+    absl::Span<Hash> hashes = storage_->GetHashes();
+    base::ParallelForRange(
+        padded_leaves_size,
+        [this, &leaves, hashes, offset, leaves_size](size_t begin,
+                                                     size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            hashes[offset + i] =
+                i < leaves_size ? hasher_->ComputeLeafHash(leaves[i]) : Hash();
+          }
+        },
+        /*min_elements_per_range=*/1);
+    BuildTreeByLayers(hashes, padded_leaves_size);
+    *out = hashes[0];
+    return true;
+  }
+
+  // Open all the leaves at |indices| at once. |indices| may be unsorted and
+  // may contain duplicates.
+  [[nodiscard]] bool DoCreateOpeningProof(const std::vector<size_t>& indices,
+                                          MerkleMultiProof<Hash>* proof) const {
+    if (indices.empty()) {
+      LOG(ERROR) << "No indices to open";
+      return false;
+    }
+    absl::Span<const Hash> hashes = storage_->GetHashes();
+    // The padding is not a leaf, so it can't be opened. Otherwise, the
+    // verifier would reject the proof since it only knows the real leaves.
+    size_t leaves_size = storage_->GetLeavesSize();
+    size_t offset = GetNumInnerNodes(GetPaddedLeavesSize(leaves_size));
+    std::vector<size_t> nodes;
+    nodes.reserve(indices.size());
+    for (size_t index : indices) {
+      if (index >= leaves_size) {
+        LOG(ERROR) << "Index is out of range: " << index;
+        return false;
+      }
+      nodes.push_back(offset + index);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+    proof->hashes.clear();
+    std::vector<size_t> parents;
+    // All the |nodes| are at the same level, so the root is reached once the
+    // first one is the root.
+    while (nodes.front() != 0) {
+      for (size_t i = 0; i < nodes.size();) {
+        size_t parent = (nodes[i] - 1) / Arity;
+        size_t first_child = parent * Arity + 1;
+        for (size_t j = first_child; j < first_child + Arity; ++j) {
+          if (i < nodes.size() && nodes[i] == j) {
+            // This sibling is computed from the opened leaves.
+            ++i;
+          } else {
+            proof->hashes.push_back(hashes[j]);
+          }
+        }
+        parents.push_back(parent);
+      }
+      std::swap(nodes, parents);
+      parents.clear();
+    }
+    return true;
+  }
+
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Hash& root, const MerkleOpenings<Hash>& openings,
+      const MerkleMultiProof<Hash>& proof) const {
+    size_t leaves_size = openings.leaves_size;
+    if (leaves_size == 0 || leaves_size > MaxSize) {
+      LOG(ERROR) << "Invalid number of leaves: " << leaves_size;
+      return false;
+    }
+    if (openings.leaves.empty()) {
+      LOG(ERROR) << "No leaves to verify";
+      return false;
+    }
+
+    size_t offset = GetNumInnerNodes(GetPaddedLeavesSize(leaves_size));
+    std::vector<std::pair<size_t, Hash>> nodes;
+    nodes.reserve(openings.leaves.size());
+    for (const auto& [index, hash] : openings.leaves) {
+      if (index >= leaves_size) {
+        LOG(ERROR) << "Index is out of range: " << index;
+        return false;
+      }
+      nodes.emplace_back(offset + index, hash);
+    }
+    std::stable_sort(
+        nodes.begin(), nodes.end(),
+        [](const std::pair<size_t, Hash>& a, const std::pair<size_t, Hash>& b) {
+          return a.first < b.first;
+        });
+    for (size_t i = 1; i < nodes.size(); ++i) {
+      if (nodes[i - 1].first == nodes[i].first &&
+          nodes[i - 1].second != nodes[i].second) {
+        LOG(ERROR) << "Leaf hashes at the same index don't match";
+        return false;
+      }
+    }
+    nodes.erase(
+        std::unique(nodes.begin(), nodes.end(),
+                    [](const std::pair<size_t, Hash>& a,
+                       const std::pair<size_t, Hash>& b) {
+                      return a.first == b.first;
+                    }),
+        nodes.end());
+
+    size_t proof_idx = 0;
+    std::array<Hash, Arity> children;
+    std::vector<std::pair<size_t, Hash>> parents;
+    while (nodes.front().first != 0) {
+      for (size_t i = 0; i < nodes.size();) {
+        size_t parent = (nodes[i].first - 1) / Arity;
+        size_t first_child = parent * Arity + 1;
+        for (size_t j = 0; j < Arity; ++j) {
+          if (i < nodes.size() && nodes[i].first == first_child + j) {
+            children[j] = std::move(nodes[i++].second);
+          } else {
+            if (proof_idx == proof.hashes.size()) {
+              LOG(ERROR) << "Proof is too short";
+              return false;
+            }
+            children[j] = proof.hashes[proof_idx++];
+          }
+        }
+        parents.emplace_back(
+            parent, hasher_->ComputeParentHash(absl::MakeConstSpan(children)));
+      }
+      std::swap(nodes, parents);
+      parents.clear();
+    }
+    return proof_idx == proof.hashes.size() && nodes.front().second == root;
+  }
+
+  // Returns the number of inner nodes of a tree with |padded_leaves_size|
+  // leaves, which is also the index of the first leaf.
+  static size_t GetNumInnerNodes(size_t padded_leaves_size) {
+    return (padded_leaves_size - 1) / (Arity - 1);
+  }
+
+  // Builds the tree from the leaves to the root one layer at a time. Layers
+  // that have more than |layer_size_for_parallelization_| nodes are split
+  // into chunks of at least that many nodes that are hashed in parallel.
+  void BuildTreeByLayers(absl::Span<Hash> hashes,
+                         size_t padded_leaves_size) const {
+    size_t size = padded_leaves_size;
+    while (size > 1) {
+      size_t parents_size = size / Arity;
+      absl::Span<const Hash> children =
+          hashes.subspan(GetNumInnerNodes(size), size);
+      absl::Span<Hash> parents =
+          hashes.subspan(GetNumInnerNodes(parents_size), parents_size);
+      base::ParallelForRange(
+          parents_size,
+          [this, children, parents](size_t begin, size_t end) {
+            hasher_->ComputeParentHashes(
+                children.subspan(begin * Arity, (end - begin) * Arity),
+                parents.subspan(begin, end - begin));
+          },
+          layer_size_for_parallelization_);
+      size = parents_size;
+    }
+  }
+
+  // not owned
+  mutable MerkleTreeStorage<Hash>* storage_ = nullptr;
+  // not owned
+  MerkleHasher<Leaf, Hash>* hasher_ = nullptr;
+  size_t layer_size_for_parallelization_ = kDefaultLayerSizeForParallelization;
+};
+
+template <typename Leaf, typename Hash, size_t Arity, size_t MaxSize>
+struct VectorCommitmentSchemeTraits<MerkleTree<Leaf, Hash, Arity, MaxSize>> {
+ public:
+  constexpr static size_t kMaxSize = MaxSize;
+  constexpr static bool kIsTransparent = true;
+  constexpr static bool kSupportsBatchMode = false;
+
+  using Field = Hash;
+  using Commitment = Hash;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_H_
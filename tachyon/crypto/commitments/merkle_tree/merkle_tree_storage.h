@@ -0,0 +1,27 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_STORAGE_H_
+
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+namespace tachyon::crypto {
+
+// Storage of the nodes of a |MerkleTree|. The nodes are kept in a contiguous
+// buffer in level order, so that the tree is built a layer at a time.
+template <typename Hash>
+class MerkleTreeStorage {
+ public:
+  virtual ~MerkleTreeStorage() = default;
+
+  // Allocates |size| nodes for a tree of |leaves_size| leaves before they are
+  // padded.
+  virtual void Allocate(size_t size, size_t leaves_size) = 0;
+  virtual size_t GetLeavesSize() const = 0;
+  virtual absl::Span<Hash> GetHashes() = 0;
+  virtual absl::Span<const Hash> GetHashes() const = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MERKLE_TREE_STORAGE_H_
@@ -0,0 +1,164 @@
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/simple_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class SimpleHasher : public MerkleHasher<int, int> {
+ public:
+  // MerkleHasher<int, int> methods
+  int ComputeLeafHash(const int& leaf) const override { return leaf; }
+  int ComputeParentHash(absl::Span<const int> children) const override {
+    int ret = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      ret += children[i] << i;
+    }
+    return ret;
+  }
+};
+
+class MerkleTreeTest : public testing::Test {
+ public:
+  constexpr static size_t kMaxSize = 64;
+
+  template <size_t Arity>
+  using VCS = MerkleTree<int, int, Arity, kMaxSize>;
+
+  template <size_t Arity>
+  VCS<Arity> CreateVCS() {
+    VCS<Arity> vcs(&storage_, &hasher_);
+    vcs.set_layer_size_for_parallelization(2);
+    return vcs;
+  }
+
+  MerkleOpenings<int> CreateOpenings(const std::vector<size_t>& indices,
+                                     const std::vector<int>& leaves) {
+    MerkleOpenings<int> openings;
+    openings.leaves_size = leaves.size();
+    openings.leaves = base::Map(indices, [this, &leaves](size_t index) {
+      return std::make_pair(index, hasher_.ComputeLeafHash(leaves[index]));
+    });
+    return openings;
+  }
+
+ protected:
+  SimpleMerkleTreeStorage<int> storage_;
+  SimpleHasher hasher_;
+};
+
+}  // namespace
+
+TEST_F(MerkleTreeTest, GetPaddedLeavesSize) {
+  EXPECT_EQ(VCS<2>::GetPaddedLeavesSize(1), size_t{1});
+  EXPECT_EQ(VCS<2>::GetPaddedLeavesSize(5), size_t{8});
+  EXPECT_EQ(VCS<4>::GetPaddedLeavesSize(4), size_t{4});
+  EXPECT_EQ(VCS<4>::GetPaddedLeavesSize(5), size_t{16});
+  EXPECT_EQ(VCS<8>::GetPaddedLeavesSize(9), size_t{64});
+}
+
+TEST_F(MerkleTreeTest, CommitBinary) {
+  VCS<2> vcs = CreateVCS<2>();
+  std::vector<int> leaves = base::CreateRangedVector<int>(0, 8);
+
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(leaves, &commitment));
+  // Same as the root of the |BinaryMerkleTree| with the same hasher.
+  EXPECT_EQ(commitment, 126);
+}
+
+TEST_F(MerkleTreeTest, CommitAndVerifyBinaryMultiOpenings) {
+  VCS<2> vcs = CreateVCS<2>();
+  std::vector<int> leaves = base::CreateRangedVector<int>(0, 8);
+
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(leaves, &commitment));
+
+  std::vector<size_t> indices = {5, 1, 0, 1};
+  MerkleMultiProof<int> proof;
+  ASSERT_TRUE(vcs.CreateOpeningProof(indices, &proof));
+
+  // The siblings of the leaf 0 and the node 1 are computed from the opened
+  // leaves, so they are omitted.
+  MerkleMultiProof<int> expected_proof;
+  expected_proof.hashes = {4, 8, 20};
+  EXPECT_EQ(proof, expected_proof);
+
+  MerkleOpenings<int> openings = CreateOpenings(indices, leaves);
+  ASSERT_TRUE(vcs.VerifyOpeningProof(commitment, openings, proof));
+
+  openings.leaves[0].second += 1;
+  EXPECT_FALSE(vcs.VerifyOpeningProof(commitment, openings, proof));
+}
+
+TEST_F(MerkleTreeTest, CommitAndVerifyMultiOpenings) {
+  VCS<4> vcs = CreateVCS<4>();
+  std::vector<int> leaves = base::CreateRangedVector<int>(0, 16);
+
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(leaves, &commitment));
+  // clang-format off
+  std::vector<int> expected_nodes = {
+    2550,
+    34, 94, 154, 214,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  };
+  // clang-format on
+  EXPECT_EQ(storage_.hashes(), expected_nodes);
+  EXPECT_EQ(commitment, 2550);
+
+  std::vector<size_t> indices = {5, 1, 0, 6, 1};
+  MerkleMultiProof<int> proof;
+  ASSERT_TRUE(vcs.CreateOpeningProof(indices, &proof));
+
+  // Leaves 0 and 1 share their siblings 2 and 3, and leaves 5 and 6 share
+  // their siblings 4 and 7. The first two nodes of the second level are
+  // computed from the opened leaves.
+  MerkleMultiProof<int> expected_proof;
+  expected_proof.hashes = {2, 3, 4, 7, 154, 214};
+  EXPECT_EQ(proof, expected_proof);
+
+  MerkleOpenings<int> openings = CreateOpenings(indices, leaves);
+  ASSERT_TRUE(vcs.VerifyOpeningProof(commitment, openings, proof));
+
+  openings.leaves[0].second += 1;
+  EXPECT_FALSE(vcs.VerifyOpeningProof(commitment, openings, proof));
+}
+
+TEST_F(MerkleTreeTest, CommitAndVerifyWithPadding) {
+  VCS<8> vcs = CreateVCS<8>();
+  std::vector<int> leaves = base::CreateRangedVector<int>(0, 10);
+
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(leaves, &commitment));
+  EXPECT_EQ(storage_.hashes().size(), size_t{1 + 8 + 64});
+
+  std::vector<size_t> indices = {9, 3};
+  MerkleMultiProof<int> proof;
+  ASSERT_TRUE(vcs.CreateOpeningProof(indices, &proof));
+  MerkleOpenings<int> openings = CreateOpenings(indices, leaves);
+  ASSERT_TRUE(vcs.VerifyOpeningProof(commitment, openings, proof));
+
+  proof.hashes.pop_back();
+  EXPECT_FALSE(vcs.VerifyOpeningProof(commitment, openings, proof));
+}
+
+TEST_F(MerkleTreeTest, CannotOpenPadding) {
+  VCS<4> vcs = CreateVCS<4>();
+  std::vector<int> leaves = base::CreateRangedVector<int>(0, 5);
+
+  int commitment;
+  ASSERT_TRUE(vcs.Commit(leaves, &commitment));
+
+  MerkleMultiProof<int> proof;
+  EXPECT_TRUE(vcs.CreateOpeningProof(std::vector<size_t>{4}, &proof));
+  // The leaves are padded up to 16, but only the first 5 can be opened.
+  EXPECT_FALSE(vcs.CreateOpeningProof(std::vector<size_t>{5}, &proof));
+  EXPECT_FALSE(vcs.CreateOpeningProof(std::vector<size_t>{2, 15}, &proof));
+}
+
+}  // namespace tachyon::crypto
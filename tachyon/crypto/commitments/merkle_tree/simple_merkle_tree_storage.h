@@ -0,0 +1,33 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_SIMPLE_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_SIMPLE_MERKLE_TREE_STORAGE_H_
+
+#include <vector>
+
+#include "tachyon/crypto/commitments/merkle_tree/merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+template <typename T>
+class SimpleMerkleTreeStorage : public MerkleTreeStorage<T> {
+ public:
+  const std::vector<T>& hashes() const { return hashes_; }
+
+  // MerkleTreeStorage<T> methods
+  void Allocate(size_t size, size_t leaves_size) override {
+    hashes_.resize(size);
+    leaves_size_ = leaves_size;
+  }
+  size_t GetLeavesSize() const override { return leaves_size_; }
+  absl::Span<T> GetHashes() override { return absl::MakeSpan(hashes_); }
+  absl::Span<const T> GetHashes() const override {
+    return absl::MakeConstSpan(hashes_);
+  }
+
+ private:
+  std::vector<T> hashes_;
+  size_t leaves_size_ = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_SIMPLE_MERKLE_TREE_STORAGE_H_
@@ -0,0 +1,112 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_OPTIMIZED_POSEIDON_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_OPTIMIZED_POSEIDON_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <utility>
+
+#include "tachyon/crypto/hashes/sponge/poseidon/optimized_poseidon_config.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_sponge_base.h"
+
+namespace tachyon::crypto {
+
+// Poseidon Sponge Hash whose state has a fixed |Width|. It produces the same
+// output as |PoseidonSponge| with the |PoseidonConfig| that
+// |OptimizedPoseidonConfig| is created from, but a partial round multiplies
+// the state by a |PoseidonSparseMatrix| instead of the MDS matrix.
+template <typename PrimeField, size_t Width>
+struct OptimizedPoseidonSponge
+    : public PoseidonSpongeBase<OptimizedPoseidonSponge<PrimeField, Width>> {
+  using F = PrimeField;
+
+  struct State {
+    // Current sponge's state (current elements in the permutation block)
+    std::array<F, Width> elements;
+
+    // Current mode (whether its absorbing or squeezing)
+    DuplexSpongeMode mode = DuplexSpongeMode::Absorbing();
+
+    State() {
+      for (F& element : elements) {
+        element = F::Zero();
+      }
+    }
+
+    constexpr size_t size() const { return Width; }
+
+    F& operator[](size_t idx) { return elements[idx]; }
+    const F& operator[](size_t idx) const { return elements[idx]; }
+  };
+
+  // Sponge Config
+  OptimizedPoseidonConfig<F, Width> config;
+
+  // Sponge State
+  State state;
+
+  OptimizedPoseidonSponge() = default;
+  explicit OptimizedPoseidonSponge(
+      const OptimizedPoseidonConfig<F, Width>& config)
+      : config(config) {}
+  OptimizedPoseidonSponge(const OptimizedPoseidonConfig<F, Width>& config,
+                          const State& state)
+      : config(config), state(state) {}
+
+  void ApplyFullRound(const std::array<F, Width>& constants) {
+    for (size_t i = 0; i < Width; ++i) {
+      state[i] += constants[i];
+      state[i] = state[i].Pow(config.alpha);
+    }
+    std::array<F, Width> elements;
+    for (size_t i = 0; i < Width; ++i) {
+      elements[i] = config.mds[i][0] * state[0];
+      for (size_t j = 1; j < Width; ++j) {
+        elements[i] += config.mds[i][j] * state[j];
+      }
+    }
+    state.elements = std::move(elements);
+  }
+
+  void ApplyPartialRound(size_t round_number) {
+    state[0] += config.partial_round_constants[round_number];
+    state[0] = state[0].Pow(config.alpha);
+    config.sparse_matrices[round_number].Apply(state.elements);
+  }
+
+  void ApplyPostPartialMatrix() {
+    std::array<F, Width - 1> elements;
+    for (size_t i = 0; i < Width - 1; ++i) {
+      elements[i] = config.post_partial_matrix[i][0] * state[1];
+      for (size_t j = 1; j < Width - 1; ++j) {
+        elements[i] += config.post_partial_matrix[i][j] * state[j + 1];
+      }
+    }
+    for (size_t i = 0; i < Width - 1; ++i) {
+      state[i + 1] = std::move(elements[i]);
+    }
+  }
+
+  void Permute() {
+    size_t full_rounds_over_2 = config.full_rounds / 2;
+    for (size_t i = 0; i < full_rounds_over_2; ++i) {
+      ApplyFullRound(config.full_round_constants[i]);
+    }
+    for (size_t i = 0; i < config.partial_rounds; ++i) {
+      ApplyPartialRound(i);
+    }
+    ApplyPostPartialMatrix();
+    for (size_t i = full_rounds_over_2; i < config.full_rounds; ++i) {
+      ApplyFullRound(config.full_round_constants[i]);
+    }
+  }
+};
+
+template <typename PrimeField, size_t Width>
+struct CryptographicSpongeTraits<OptimizedPoseidonSponge<PrimeField, Width>> {
+  using F = PrimeField;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_OPTIMIZED_POSEIDON_H_
@@ -0,0 +1,240 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_OPTIMIZED_POSEIDON_CONFIG_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_OPTIMIZED_POSEIDON_CONFIG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
+
+namespace tachyon::crypto {
+
+// Sparse matrix that replaces the MDS matrix in a partial round. It has the
+// following form, where I is the identity matrix.
+//
+//   | m₀₀ row |
+//   | col  I  |
+template <typename F, size_t Width>
+struct PoseidonSparseMatrix {
+  F m00;
+  std::array<F, Width - 1> row;
+  std::array<F, Width - 1> col;
+
+  void Apply(std::array<F, Width>& state) const {
+    F first = m00 * state[0];
+    for (size_t i = 1; i < Width; ++i) {
+      first += row[i - 1] * state[i];
+      state[i] += col[i - 1] * state[0];
+    }
+    state[0] = std::move(first);
+  }
+};
+
+// Round constants and matrices of Poseidon that are transformed so that a
+// partial round costs one S-Box, one constant addition and a
+// |PoseidonSparseMatrix| multiplication instead of a full MDS multiplication.
+// See Appendix B of https://eprint.iacr.org/2019/458.
+//
+// Let M = | m₀₀ v |. Since a partial round touches only the first element of
+//         | w   M̂ |
+// the state with the S-Box and the first element of the round constants,
+// 1. The round constants except the first element are moved forward through
+//    the MDS matrix into the next round.
+// 2. M is factored into | 1 0 | * | m₀₀  v  | and the left factor is moved
+//                       | 0 M̂ |   | M̂⁻¹w I |
+//    forward into the next round. After the k-th partial round, the moved
+//    factor is | 1  0 |, which is applied once after the last partial round.
+//              | 0 M̂ᵏ |
+template <typename PrimeField, size_t Width>
+struct OptimizedPoseidonConfig {
+  using F = PrimeField;
+
+  static_assert(Width >= 2, "Width must be at least 2");
+
+  // Number of rounds in a full-round operation.
+  size_t full_rounds = 0;
+
+  // Number of rounds in a partial-round operation.
+  size_t partial_rounds = 0;
+
+  // Exponent used in S-boxes.
+  uint64_t alpha = 0;
+
+  // The rate (in terms of number of field elements).
+  size_t rate = 0;
+
+  // The capacity (in terms of number of field elements).
+  size_t capacity = 0;
+
+  // Round constants of the full rounds.
+  std::vector<std::array<F, Width>> full_round_constants;
+
+  // Round constants of the partial rounds, which are added to the first
+  // element of the state.
+  std::vector<F> partial_round_constants;
+
+  // Maximally Distance Separating (MDS) Matrix.
+  std::array<std::array<F, Width>, Width> mds;
+
+  // Matrices that replace the MDS matrix in the partial rounds.
+  std::vector<PoseidonSparseMatrix<F, Width>> sparse_matrices;
+
+  // M̂ᴿ, where R is |partial_rounds|. It is applied to the state except the
+  // first element after the last partial round.
+  std::array<std::array<F, Width - 1>, Width - 1> post_partial_matrix;
+
+  static OptimizedPoseidonConfig Create(const PoseidonConfig<F>& config) {
+    CHECK(config.IsValid());
+    CHECK_EQ(config.rate + config.capacity, Width);
+    CHECK_EQ(config.full_rounds % 2, size_t{0});
+
+    OptimizedPoseidonConfig ret;
+    ret.full_rounds = config.full_rounds;
+    ret.partial_rounds = config.partial_rounds;
+    ret.alpha = config.alpha;
+    ret.rate = config.rate;
+    ret.capacity = config.capacity;
+
+    for (size_t i = 0; i < Width; ++i) {
+      for (size_t j = 0; j < Width; ++j) {
+        ret.mds[i][j] = config.mds(i, j);
+      }
+    }
+
+    size_t full_rounds_over_2 = config.full_rounds / 2;
+    size_t num_rounds = config.full_rounds + config.partial_rounds;
+    std::vector<std::array<F, Width>> constants(num_rounds);
+    for (size_t r = 0; r < num_rounds; ++r) {
+      for (size_t i = 0; i < Width; ++i) {
+        constants[r][i] = config.ark(r, i);
+      }
+    }
+    ret.partial_round_constants.reserve(config.partial_rounds);
+    for (size_t r = full_rounds_over_2;
+         r < full_rounds_over_2 + config.partial_rounds; ++r) {
+      // M * (0, c₁, ..., cₜ₋₁) is added to the constants of the next round.
+      for (size_t i = 0; i < Width; ++i) {
+        for (size_t j = 1; j < Width; ++j) {
+          constants[r + 1][i] += ret.mds[i][j] * constants[r][j];
+        }
+      }
+      ret.partial_round_constants.push_back(constants[r][0]);
+    }
+    ret.full_round_constants.reserve(config.full_rounds);
+    for (size_t r = 0; r < full_rounds_over_2; ++r) {
+      ret.full_round_constants.push_back(constants[r]);
+    }
+    for (size_t r = full_rounds_over_2 + config.partial_rounds; r < num_rounds;
+         ++r) {
+      ret.full_round_constants.push_back(constants[r]);
+    }
+
+    SubMatrix m_hat;
+    std::array<F, Width - 1> v;
+    std::array<F, Width - 1> w;
+    for (size_t i = 0; i < Width - 1; ++i) {
+      v[i] = ret.mds[0][i + 1];
+      w[i] = ret.mds[i + 1][0];
+      for (size_t j = 0; j < Width - 1; ++j) {
+        m_hat[i][j] = ret.mds[i + 1][j + 1];
+      }
+    }
+    SubMatrix m_hat_inv = Invert(m_hat);
+
+    // In the k-th partial round, the sparse matrix is
+    // | m₀₀      v * M̂ᵏ   |
+    // | M̂⁻⁽ᵏ⁺¹⁾w     I    |.
+    ret.sparse_matrices.reserve(config.partial_rounds);
+    SubMatrix m_hat_pow = Identity();
+    for (size_t k = 0; k < config.partial_rounds; ++k) {
+      w = Multiply(m_hat_inv, w);
+      PoseidonSparseMatrix<F, Width> sparse_matrix;
+      sparse_matrix.m00 = ret.mds[0][0];
+      sparse_matrix.col = w;
+      for (size_t j = 0; j < Width - 1; ++j) {
+        sparse_matrix.row[j] = F::Zero();
+        for (size_t i = 0; i < Width - 1; ++i) {
+          sparse_matrix.row[j] += v[i] * m_hat_pow[i][j];
+        }
+      }
+      ret.sparse_matrices.push_back(std::move(sparse_matrix));
+      m_hat_pow = Multiply(m_hat_pow, m_hat);
+    }
+    ret.post_partial_matrix = m_hat_pow;
+    return ret;
+  }
+
+ private:
+  using SubMatrix = std::array<std::array<F, Width - 1>, Width - 1>;
+
+  static SubMatrix Identity() {
+    SubMatrix ret;
+    for (size_t i = 0; i < Width - 1; ++i) {
+      for (size_t j = 0; j < Width - 1; ++j) {
+        ret[i][j] = i == j ? F::One() : F::Zero();
+      }
+    }
+    return ret;
+  }
+
+  static SubMatrix Multiply(const SubMatrix& a, const SubMatrix& b) {
+    SubMatrix ret;
+    for (size_t i = 0; i < Width - 1; ++i) {
+      for (size_t j = 0; j < Width - 1; ++j) {
+        ret[i][j] = F::Zero();
+        for (size_t k = 0; k < Width - 1; ++k) {
+          ret[i][j] += a[i][k] * b[k][j];
+        }
+      }
+    }
+    return ret;
+  }
+
+  static std::array<F, Width - 1> Multiply(const SubMatrix& a,
+                                           const std::array<F, Width - 1>& b) {
+    std::array<F, Width - 1> ret;
+    for (size_t i = 0; i < Width - 1; ++i) {
+      ret[i] = F::Zero();
+      for (size_t j = 0; j < Width - 1; ++j) {
+        ret[i] += a[i][j] * b[j];
+      }
+    }
+    return ret;
+  }
+
+  // Inverts |m| with Gauss-Jordan elimination. Every square submatrix of a
+  // Cauchy matrix, which the MDS matrix is, is invertible.
+  static SubMatrix Invert(SubMatrix m) {
+    SubMatrix ret = Identity();
+    for (size_t i = 0; i < Width - 1; ++i) {
+      size_t pivot = i;
+      while (pivot < Width - 1 && m[pivot][i].IsZero()) ++pivot;
+      CHECK_LT(pivot, Width - 1) << "MDS submatrix is not invertible";
+      std::swap(m[i], m[pivot]);
+      std::swap(ret[i], ret[pivot]);
+
+      F inv = m[i][i].Inverse();
+      for (size_t j = 0; j < Width - 1; ++j) {
+        m[i][j] *= inv;
+        ret[i][j] *= inv;
+      }
+      for (size_t k = 0; k < Width - 1; ++k) {
+        if (k == i || m[k][i].IsZero()) continue;
+        F factor = m[k][i];
+        for (size_t j = 0; j < Width - 1; ++j) {
+          m[k][j] -= factor * m[i][j];
+          ret[k][j] -= factor * ret[i][j];
+        }
+      }
+    }
+    return ret;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_OPTIMIZED_POSEIDON_CONFIG_H_
@@ -0,0 +1,72 @@
+#include "tachyon/crypto/hashes/sponge/poseidon/optimized_poseidon.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class OptimizedPoseidonTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    math::bls12_381::Fr::Init();
+    math::bn254::Fr::Init();
+  }
+};
+
+template <size_t Width, typename F>
+void TestPermute(const PoseidonConfig<F>& config) {
+  PoseidonSponge<F> sponge(config);
+  OptimizedPoseidonSponge<F, Width> optimized_sponge(
+      OptimizedPoseidonConfig<F, Width>::Create(config));
+  for (size_t i = 0; i < Width; ++i) {
+    sponge.state[i] = F::Random();
+    optimized_sponge.state[i] = sponge.state[i];
+  }
+
+  sponge.Permute();
+  optimized_sponge.Permute();
+  for (size_t i = 0; i < Width; ++i) {
+    EXPECT_EQ(optimized_sponge.state[i], sponge.state[i]);
+  }
+}
+
+}  // namespace
+
+TEST_F(OptimizedPoseidonTest, Permute) {
+  using F = math::bn254::Fr;
+
+  TestPermute<3>(PoseidonConfig<F>::CreateDefault(2, false));
+  TestPermute<5>(PoseidonConfig<F>::CreateDefault(4, false));
+  TestPermute<9>(PoseidonConfig<F>::CreateDefault(8, true));
+  TestPermute<12>(PoseidonConfig<F>::CreateCustom(11, 5, 8, 57, 0));
+}
+
+TEST_F(OptimizedPoseidonTest, AbsorbSqueeze) {
+  using Fr = math::bls12_381::Fr;
+
+  PoseidonConfig<Fr> config = PoseidonConfig<Fr>::CreateDefault(2, false);
+  OptimizedPoseidonSponge<Fr, 3> sponge(
+      OptimizedPoseidonConfig<Fr, 3>::Create(config));
+  std::vector<Fr> inputs = {Fr(0), Fr(1), Fr(2)};
+  ASSERT_TRUE(sponge.Absorb(inputs));
+  std::vector<Fr> result = sponge.SqueezeNativeFieldElements(3);
+  // Same as the result of |PoseidonSponge|.
+  std::vector<Fr> expected = {
+      Fr::FromDecString("404427934635713040283377530022421867103101638970489622"
+                        "78675457993207843616876"),
+      Fr::FromDecString("266437446169989800029115314522409928771122402171620296"
+                        "0480903840045233645301"),
+      Fr::FromDecString("501910788280669236620702282565306929518015040434228440"
+                        "38937334196346054068797"),
+  };
+  EXPECT_EQ(result, expected);
+}
+
+}  // namespace tachyon::crypto
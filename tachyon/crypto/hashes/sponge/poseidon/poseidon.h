@@ -10,10 +10,8 @@
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
-#include "tachyon/base/logging.h"
-#include "tachyon/crypto/hashes/prime_field_serializable.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
-#include "tachyon/crypto/hashes/sponge/sponge.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_sponge_base.h"
 
 namespace tachyon::crypto {
 
@@ -30,8 +28,7 @@ namespace tachyon::crypto {
 // child class that inherits this. See
 // `tachyon/zk/plonk/halo2/poseidon_sponge.h`.
 template <typename PrimeField>
-struct PoseidonSponge
-    : public FieldBasedCryptographicSponge<PoseidonSponge<PrimeField>> {
+struct PoseidonSponge : public PoseidonSpongeBase<PoseidonSponge<PrimeField>> {
   using F = PrimeField;
 
   struct State {
@@ -108,94 +105,12 @@ struct PoseidonSponge
     }
   }
 
-  // Absorbs everything in |elements|, this does not end in an absorbing.
-  void AbsorbInternal(size_t rate_start_index, const std::vector<F>& elements) {
-    size_t elements_idx = 0;
-    while (true) {
-      size_t remaining_size = elements.size() - elements_idx;
-      // if we can finish in this call
-      if (rate_start_index + remaining_size <= config.rate) {
-        for (size_t i = 0; i < remaining_size; ++i, ++elements_idx) {
-          state[config.capacity + i + rate_start_index] +=
-              elements[elements_idx];
-        }
-        state.mode.type = DuplexSpongeMode::Type::kAbsorbing;
-        state.mode.next_index = rate_start_index + remaining_size;
-        break;
-      }
-      // otherwise absorb (|config.rate| - |rate_start_index|) elements
-      size_t num_elements_absorbed = config.rate - rate_start_index;
-      for (size_t i = 0; i < num_elements_absorbed; ++i, ++elements_idx) {
-        state[config.capacity + i + rate_start_index] += elements[elements_idx];
-      }
-      Permute();
-      rate_start_index = 0;
-    }
-  }
-
-  // Squeeze |output| many elements. This does not end in a squeezing.
-  void SqueezeInternal(size_t rate_start_index, std::vector<F>* output) {
-    size_t output_size = output->size();
-    size_t output_idx = 0;
-    while (true) {
-      size_t output_remaining_size = output_size - output_idx;
-      // if we can finish in this call
-      if (rate_start_index + output_remaining_size <= config.rate) {
-        for (size_t i = 0; i < output_remaining_size; ++i) {
-          (*output)[output_idx + i] =
-              state[config.capacity + rate_start_index + i];
-        }
-        state.mode.type = DuplexSpongeMode::Type::kSqueezing;
-        state.mode.next_index = rate_start_index + output_remaining_size;
-        return;
-      }
-
-      // otherwise squeeze (|config.rate| - |rate_start_index|) elements
-      size_t num_elements_squeezed = config.rate - rate_start_index;
-      for (size_t i = 0; i < num_elements_squeezed; ++i) {
-        (*output)[output_idx + i] =
-            state[config.capacity + rate_start_index + i];
-      }
-
-      if (output_remaining_size != config.rate) {
-        Permute();
-      }
-      output_idx += num_elements_squeezed;
-      rate_start_index = 0;
-    }
-  }
-
-  // CryptographicSponge methods
-  template <typename T>
-  bool Absorb(const T& input) {
-    std::vector<F> elements;
-    if (!SerializeToFieldElements(input, &elements)) return false;
-
-    switch (state.mode.type) {
-      case DuplexSpongeMode::Type::kAbsorbing: {
-        size_t absorb_index = state.mode.next_index;
-        if (absorb_index == config.rate) {
-          Permute();
-          absorb_index = 0;
-        }
-        AbsorbInternal(absorb_index, elements);
-        return true;
-      }
-      case DuplexSpongeMode::Type::kSqueezing: {
-        Permute();
-        AbsorbInternal(0, elements);
-        return true;
-      }
-    }
-    NOTREACHED();
-    return false;
-  }
-
   std::vector<uint8_t> SqueezeBytes(size_t num_bytes) {
     size_t usable_bytes = (F::kModulusBits - 1) / 8;
 
     size_t num_elements = (num_bytes + usable_bytes - 1) / usable_bytes;
-    std::vector<F> src_elements = SqueezeNativeFieldElements(num_elements);
+    std::vector<F> src_elements =
+        this->SqueezeNativeFieldElements(num_elements);
 
     std::vector<F> bytes;
     bytes.reserve(usable_bytes * num_elements);
@@ -212,7 +127,8 @@ struct PoseidonSponge
     size_t usable_bits = F::kModulusBits - 1;
 
     size_t num_elements = (num_bits + usable_bits - 1) / usable_bits;
-    std::vector<F> src_elements = SqueezeNativeFieldElements(num_elements);
+    std::vector<F> src_elements =
+        this->SqueezeNativeFieldElements(num_elements);
 
     std::vector<bool> bits;
     for (const F& elem : src_elements) {
@@ -237,38 +153,12 @@ struct PoseidonSponge
   template <typename F2 = F>
   std::vector<F2> SqueezeFieldElements(size_t num_elements) {
     if constexpr (std::is_same_v<F, F2>) {
-      return SqueezeNativeFieldElements(num_elements);
+      return this->SqueezeNativeFieldElements(num_elements);
     } else {
       return SqueezeFieldElementsWithSizes<F2>(base::CreateVector(
           num_elements, []() { return FieldElementSize::Full(); }));
     }
   }
-
-  // FieldBasedCryptographicSponge methods
-  // NOTE(TomTaehoonKim): If you ever update this, please update
-  // |Halo2PoseidonSponge| for consistency.
-  std::vector<F> SqueezeNativeFieldElements(size_t num_elements) {
-    std::vector<F> ret =
-        base::CreateVector(num_elements, []() { return F::Zero(); });
-    switch (state.mode.type) {
-      case DuplexSpongeMode::Type::kAbsorbing: {
-        Permute();
-        SqueezeInternal(0, &ret);
-        return ret;
-      }
-      case DuplexSpongeMode::Type::kSqueezing: {
-        size_t squeeze_index = state.mode.next_index;
-        if (squeeze_index == config.rate) {
-          Permute();
-          squeeze_index = 0;
-        }
-        SqueezeInternal(squeeze_index, &ret);
-        return ret;
-      }
-    }
-    NOTREACHED();
-    return {};
-  }
 };
 
 template <typename PrimeField>
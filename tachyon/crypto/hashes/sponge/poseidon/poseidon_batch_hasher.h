@@ -0,0 +1,196 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_BATCH_HASHER_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_BATCH_HASHER_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <array>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/optimized_poseidon_config.h"
+
+namespace tachyon::crypto {
+
+// Hashes many independent inputs of the same length at once. Each hash is
+// the same as the first element squeezed from an |OptimizedPoseidonSponge|
+// that absorbed the input.
+//
+// The inputs are processed |kNumLanes| at a time in lockstep. The states of
+// the lanes are stored in structure of arrays layout, so that every step of a
+// round runs the same operation over |kNumLanes| contiguous field elements,
+// which the compiler can vectorize for packed fields.
+//
+// This runs on the calling thread. The callers already split their work
+// across threads, e.g. |BinaryMerkleTree| hashes each chunk of a layer on its
+// own thread, and a nested parallel loop here would oversubscribe them.
+template <typename PrimeField, size_t Width>
+class PoseidonBatchHasher {
+ public:
+  using F = PrimeField;
+
+  constexpr static size_t kNumLanes = 8;
+
+  PoseidonBatchHasher() = default;
+  explicit PoseidonBatchHasher(const OptimizedPoseidonConfig<F, Width>* config)
+      : config_(config) {}
+
+  const OptimizedPoseidonConfig<F, Width>* config() const { return config_; }
+
+  // Hashes a single |input|.
+  F Hash(absl::Span<const F> input) const {
+    F ret;
+    HashChunk<1>(input, input.size(), absl::MakeSpan(&ret, 1));
+    return ret;
+  }
+
+  // Hashes the |outputs.size()| inputs in |inputs| into |outputs|. The i-th
+  // input is |inputs[i * input_size, (i + 1) * input_size)|.
+  void Hash(absl::Span<const F> inputs, size_t input_size,
+            absl::Span<F> outputs) const {
+    CHECK_EQ(inputs.size(), outputs.size() * input_size);
+    size_t num_chunks = (outputs.size() + kNumLanes - 1) / kNumLanes;
+    for (size_t i = 0; i < num_chunks; ++i) {
+      size_t from = i * kNumLanes;
+      size_t num_lanes = std::min(kNumLanes, outputs.size() - from);
+      HashChunk<kNumLanes>(
+          inputs.subspan(from * input_size, num_lanes * input_size),
+          input_size, outputs.subspan(from, num_lanes));
+    }
+  }
+
+ private:
+  // |state[i][l]| is the i-th element of the state of the l-th lane.
+  template <size_t NumLanes>
+  using State = std::array<std::array<F, NumLanes>, Width>;
+
+  // Hashes at most |NumLanes| inputs. If there are fewer inputs than
+  // |NumLanes|, the remaining lanes are permuted but discarded.
+  template <size_t NumLanes>
+  void HashChunk(absl::Span<const F> inputs, size_t input_size,
+                 absl::Span<F> outputs) const {
+    size_t num_lanes = outputs.size();
+    State<NumLanes> state;
+    for (std::array<F, NumLanes>& elements : state) {
+      for (F& element : elements) {
+        element = F::Zero();
+      }
+    }
+
+    // Absorb: a permutation is applied each time the rate is filled up and
+    // there are elements left to absorb.
+    size_t rate = config_->rate;
+    size_t capacity = config_->capacity;
+    for (size_t offset = 0; offset < input_size; offset += rate) {
+      if (offset > 0) Permute(state);
+      size_t size = std::min(rate, input_size - offset);
+      for (size_t i = 0; i < size; ++i) {
+        for (size_t l = 0; l < num_lanes; ++l) {
+          state[capacity + i][l] += inputs[l * input_size + offset + i];
+        }
+      }
+    }
+
+    // Squeeze
+    Permute(state);
+    for (size_t l = 0; l < num_lanes; ++l) {
+      outputs[l] = state[capacity][l];
+    }
+  }
+
+  template <size_t NumLanes>
+  void ApplySBox(std::array<F, NumLanes>& elements) const {
+    for (F& element : elements) {
+      element = element.Pow(config_->alpha);
+    }
+  }
+
+  template <size_t NumLanes>
+  void ApplyFullRound(const std::array<F, Width>& constants,
+                      State<NumLanes>& state) const {
+    for (size_t i = 0; i < Width; ++i) {
+      for (F& element : state[i]) {
+        element += constants[i];
+      }
+      ApplySBox(state[i]);
+    }
+    State<NumLanes> new_state;
+    for (size_t i = 0; i < Width; ++i) {
+      for (size_t l = 0; l < NumLanes; ++l) {
+        new_state[i][l] = config_->mds[i][0] * state[0][l];
+      }
+      for (size_t j = 1; j < Width; ++j) {
+        const F& m = config_->mds[i][j];
+        for (size_t l = 0; l < NumLanes; ++l) {
+          new_state[i][l] += m * state[j][l];
+        }
+      }
+    }
+    state = new_state;
+  }
+
+  template <size_t NumLanes>
+  void ApplyPartialRound(size_t round_number, State<NumLanes>& state) const {
+    const F& constant = config_->partial_round_constants[round_number];
+    for (F& element : state[0]) {
+      element += constant;
+    }
+    ApplySBox(state[0]);
+
+    const PoseidonSparseMatrix<F, Width>& sparse_matrix =
+        config_->sparse_matrices[round_number];
+    std::array<F, NumLanes> first;
+    for (size_t l = 0; l < NumLanes; ++l) {
+      first[l] = sparse_matrix.m00 * state[0][l];
+    }
+    for (size_t i = 1; i < Width; ++i) {
+      const F& row = sparse_matrix.row[i - 1];
+      const F& col = sparse_matrix.col[i - 1];
+      for (size_t l = 0; l < NumLanes; ++l) {
+        first[l] += row * state[i][l];
+        state[i][l] += col * state[0][l];
+      }
+    }
+    state[0] = first;
+  }
+
+  template <size_t NumLanes>
+  void ApplyPostPartialMatrix(State<NumLanes>& state) const {
+    std::array<std::array<F, NumLanes>, Width - 1> new_elements;
+    for (size_t i = 0; i < Width - 1; ++i) {
+      for (size_t l = 0; l < NumLanes; ++l) {
+        new_elements[i][l] = config_->post_partial_matrix[i][0] * state[1][l];
+      }
+      for (size_t j = 1; j < Width - 1; ++j) {
+        const F& m = config_->post_partial_matrix[i][j];
+        for (size_t l = 0; l < NumLanes; ++l) {
+          new_elements[i][l] += m * state[j + 1][l];
+        }
+      }
+    }
+    std::copy(new_elements.begin(), new_elements.end(), state.begin() + 1);
+  }
+
+  template <size_t NumLanes>
+  void Permute(State<NumLanes>& state) const {
+    size_t full_rounds_over_2 = config_->full_rounds / 2;
+    for (size_t i = 0; i < full_rounds_over_2; ++i) {
+      ApplyFullRound(config_->full_round_constants[i], state);
+    }
+    for (size_t i = 0; i < config_->partial_rounds; ++i) {
+      ApplyPartialRound(i, state);
+    }
+    ApplyPostPartialMatrix(state);
+    for (size_t i = full_rounds_over_2; i < config_->full_rounds; ++i) {
+      ApplyFullRound(config_->full_round_constants[i], state);
+    }
+  }
+
+  // not owned
+  const OptimizedPoseidonConfig<F, Width>* config_ = nullptr;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_BATCH_HASHER_H_
@@ -0,0 +1,59 @@
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_batch_hasher.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/optimized_poseidon.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class PoseidonBatchHasherTest : public testing::Test {
+ public:
+  constexpr static size_t kWidth = 3;
+
+  using F = math::bn254::Fr;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  void SetUp() override {
+    config_ = OptimizedPoseidonConfig<F, kWidth>::Create(
+        PoseidonConfig<F>::CreateDefault(kWidth - 1, false));
+  }
+
+ protected:
+  OptimizedPoseidonConfig<F, kWidth> config_;
+};
+
+}  // namespace
+
+TEST_F(PoseidonBatchHasherTest, Hash) {
+  PoseidonBatchHasher<F, kWidth> hasher(&config_);
+
+  // Inputs of size 0 and 4 need a single permutation and two permutations to
+  // be absorbed respectively. 19 inputs are not a multiple of the lanes.
+  for (size_t input_size : {0, 1, 2, 4, 5}) {
+    SCOPED_TRACE(input_size);
+    size_t num_inputs = 19;
+    std::vector<F> inputs = base::CreateVector(num_inputs * input_size,
+                                               []() { return F::Random(); });
+    std::vector<F> outputs(num_inputs);
+    hasher.Hash(inputs, input_size, absl::MakeSpan(outputs));
+
+    for (size_t i = 0; i < num_inputs; ++i) {
+      std::vector<F> input(inputs.begin() + i * input_size,
+                           inputs.begin() + (i + 1) * input_size);
+      OptimizedPoseidonSponge<F, kWidth> sponge(config_);
+      ASSERT_TRUE(sponge.Absorb(input));
+      F expected = sponge.SqueezeNativeFieldElements(1)[0];
+      EXPECT_EQ(outputs[i], expected);
+      EXPECT_EQ(hasher.Hash(input), expected);
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,88 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/optimized_poseidon.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_batch_hasher.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+template <size_t Width>
+PoseidonConfig<F> CreateConfig() {
+  // There is no default config for the rate 11.
+  if constexpr (Width == 12) {
+    return PoseidonConfig<F>::CreateCustom(11, 5, 8, 57, 0);
+  } else {
+    return PoseidonConfig<F>::CreateDefault(Width - 1, false);
+  }
+}
+
+}  // namespace
+
+template <size_t Width>
+void BM_PoseidonPermute(benchmark::State& state) {
+  F::Init();
+  PoseidonSponge<F> sponge(CreateConfig<Width>());
+  for (size_t i = 0; i < Width; ++i) {
+    sponge.state[i] = F::Random();
+  }
+  for (auto _ : state) {
+    sponge.Permute();
+  }
+  benchmark::DoNotOptimize(sponge.state);
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <size_t Width>
+void BM_OptimizedPoseidonPermute(benchmark::State& state) {
+  F::Init();
+  OptimizedPoseidonSponge<F, Width> sponge(
+      OptimizedPoseidonConfig<F, Width>::Create(CreateConfig<Width>()));
+  for (size_t i = 0; i < Width; ++i) {
+    sponge.state[i] = F::Random();
+  }
+  for (auto _ : state) {
+    sponge.Permute();
+  }
+  benchmark::DoNotOptimize(sponge.state);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// |state.range(0)|: the number of inputs
+template <size_t Width>
+void BM_PoseidonBatchHash(benchmark::State& state) {
+  F::Init();
+  OptimizedPoseidonConfig<F, Width> config =
+      OptimizedPoseidonConfig<F, Width>::Create(CreateConfig<Width>());
+  PoseidonBatchHasher<F, Width> hasher(&config);
+  size_t num_inputs = state.range(0);
+  // Each input fills up the rate, so hashing it takes a single permutation.
+  std::vector<F> inputs = base::CreateVector(num_inputs * config.rate,
+                                             []() { return F::Random(); });
+  std::vector<F> outputs(num_inputs);
+  for (auto _ : state) {
+    hasher.Hash(inputs, config.rate, absl::MakeSpan(outputs));
+  }
+  benchmark::DoNotOptimize(outputs);
+  state.SetItemsProcessed(state.iterations() * num_inputs);
+}
+
+BENCHMARK_TEMPLATE(BM_PoseidonPermute, 3);
+BENCHMARK_TEMPLATE(BM_OptimizedPoseidonPermute, 3);
+BENCHMARK_TEMPLATE(BM_PoseidonPermute, 5);
+BENCHMARK_TEMPLATE(BM_OptimizedPoseidonPermute, 5);
+BENCHMARK_TEMPLATE(BM_PoseidonPermute, 9);
+BENCHMARK_TEMPLATE(BM_OptimizedPoseidonPermute, 9);
+BENCHMARK_TEMPLATE(BM_PoseidonPermute, 12);
+BENCHMARK_TEMPLATE(BM_OptimizedPoseidonPermute, 12);
+BENCHMARK_TEMPLATE(BM_PoseidonBatchHash, 3)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_PoseidonBatchHash, 9)->Arg(1 << 10)->Arg(1 << 14);
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,143 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_SPONGE_BASE_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_SPONGE_BASE_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/prime_field_serializable.h"
+#include "tachyon/crypto/hashes/sponge/sponge.h"
+
+namespace tachyon::crypto {
+
+// The duplex construction shared by the Poseidon sponges. |Derived| has the
+// |config| with |rate| and |capacity|, the |state|, and |Permute()|, which is
+// the only thing that differs between them.
+template <typename Derived>
+struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
+  using F = typename CryptographicSpongeTraits<Derived>::F;
+
+  // Absorbs everything in |elements|, this does not end in an absorbing.
+  void AbsorbInternal(size_t rate_start_index, const std::vector<F>& elements) {
+    Derived& derived = GetDerived();
+    size_t elements_idx = 0;
+    while (true) {
+      size_t remaining_size = elements.size() - elements_idx;
+      // if we can finish in this call
+      if (rate_start_index + remaining_size <= derived.config.rate) {
+        for (size_t i = 0; i < remaining_size; ++i, ++elements_idx) {
+          derived.state[derived.config.capacity + i + rate_start_index] +=
+              elements[elements_idx];
+        }
+        derived.state.mode.type = DuplexSpongeMode::Type::kAbsorbing;
+        derived.state.mode.next_index = rate_start_index + remaining_size;
+        break;
+      }
+      // otherwise absorb (|config.rate| - |rate_start_index|) elements
+      size_t num_elements_absorbed = derived.config.rate - rate_start_index;
+      for (size_t i = 0; i < num_elements_absorbed; ++i, ++elements_idx) {
+        derived.state[derived.config.capacity + i + rate_start_index] +=
+            elements[elements_idx];
+      }
+      derived.Permute();
+      rate_start_index = 0;
+    }
+  }
+
+  // Squeeze |output| many elements. This does not end in a squeezing.
+  void SqueezeInternal(size_t rate_start_index, std::vector<F>* output) {
+    Derived& derived = GetDerived();
+    size_t output_size = output->size();
+    size_t output_idx = 0;
+    while (true) {
+      size_t output_remaining_size = output_size - output_idx;
+      // if we can finish in this call
+      if (rate_start_index + output_remaining_size <= derived.config.rate) {
+        for (size_t i = 0; i < output_remaining_size; ++i) {
+          (*output)[output_idx + i] =
+              derived.state[derived.config.capacity + rate_start_index + i];
+        }
+        derived.state.mode.type = DuplexSpongeMode::Type::kSqueezing;
+        derived.state.mode.next_index =
+            rate_start_index + output_remaining_size;
+        return;
+      }
+
+      // otherwise squeeze (|config.rate| - |rate_start_index|) elements
+      size_t num_elements_squeezed = derived.config.rate - rate_start_index;
+      for (size_t i = 0; i < num_elements_squeezed; ++i) {
+        (*output)[output_idx + i] =
+            derived.state[derived.config.capacity + rate_start_index + i];
+      }
+
+      if (output_remaining_size != derived.config.rate) {
+        derived.Permute();
+      }
+      output_idx += num_elements_squeezed;
+      rate_start_index = 0;
+    }
+  }
+
+  // CryptographicSponge methods
+  template <typename T>
+  bool Absorb(const T& input) {
+    std::vector<F> elements;
+    if (!SerializeToFieldElements(input, &elements)) return false;
+
+    Derived& derived = GetDerived();
+    switch (derived.state.mode.type) {
+      case DuplexSpongeMode::Type::kAbsorbing: {
+        size_t absorb_index = derived.state.mode.next_index;
+        if (absorb_index == derived.config.rate) {
+          derived.Permute();
+          absorb_index = 0;
+        }
+        AbsorbInternal(absorb_index, elements);
+        return true;
+      }
+      case DuplexSpongeMode::Type::kSqueezing: {
+        derived.Permute();
+        AbsorbInternal(0, elements);
+        return true;
+      }
+    }
+    NOTREACHED();
+    return false;
+  }
+
+  // FieldBasedCryptographicSponge methods
+  // NOTE(TomTaehoonKim): If you ever update this, please update
+  // |Halo2PoseidonSponge| for consistency.
+  std::vector<F> SqueezeNativeFieldElements(size_t num_elements) {
+    std::vector<F> ret =
+        base::CreateVector(num_elements, []() { return F::Zero(); });
+    Derived& derived = GetDerived();
+    switch (derived.state.mode.type) {
+      case DuplexSpongeMode::Type::kAbsorbing: {
+        derived.Permute();
+        SqueezeInternal(0, &ret);
+        return ret;
+      }
+      case DuplexSpongeMode::Type::kSqueezing: {
+        size_t squeeze_index = derived.state.mode.next_index;
+        if (squeeze_index == derived.config.rate) {
+          derived.Permute();
+          squeeze_index = 0;
+        }
+        SqueezeInternal(squeeze_index, &ret);
+        return ret;
+      }
+    }
+    NOTREACHED();
+    return {};
+  }
+
+ private:
+  Derived& GetDerived() { return static_cast<Derived&>(*this); }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_SPONGE_BASE_H_
@@ -0,0 +1,249 @@
+#ifndef TACHYON_DEVICE_BUFFER_POOL_H_
+#define TACHYON_DEVICE_BUFFER_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/device/allocator.h"
+
+namespace tachyon::device {
+
+// A pool of the |std::vector<T>|s whose storage is recycled instead of being
+// freed. A proof allocates and frees many buffers of the size of a domain,
+// and a freshly allocated one is page faulted in again every time. With this,
+// the buffers released by a proof are acquired by the next one, so that the
+// proofs in the steady state don't allocate any large buffer.
+//
+// The buffers are kept in the size classes of the powers of two. A buffer
+// acquired for n elements has the capacity of at least the smallest power of
+// two not less than n. The buffers smaller than |kMinPooledBytes| are not
+// pooled, since the allocator handles them well.
+//
+// The pool holds at most |max_pool_bytes()| bytes, which is unlimited by
+// default, since a proof releases the buffers of the same sizes that the next
+// one acquires. A buffer released beyond the limit is freed instead of being
+// pooled. Call |set_max_pool_bytes()| to bound the memory kept between the
+// proofs, or |Trim()| to give it back once the proofs are done.
+template <typename T>
+class BufferPool {
+ public:
+  constexpr static size_t kMinPooledBytes = size_t{1} << 16;
+
+  BufferPool() = default;
+  BufferPool(const BufferPool& other) = delete;
+  BufferPool& operator=(const BufferPool& other) = delete;
+
+  // Returns the pool shared in the process.
+  static BufferPool& GetInstance() {
+    static base::NoDestructor<BufferPool> pool;
+    return *pool;
+  }
+
+  int64_t max_pool_bytes() const {
+    absl::MutexLock lock(&mutex_);
+    return max_pool_bytes_;
+  }
+  // Sets the limit of the bytes of the buffers in this pool, and frees the
+  // buffers over it.
+  void set_max_pool_bytes(int64_t max_pool_bytes) {
+    {
+      absl::MutexLock lock(&mutex_);
+      max_pool_bytes_ = max_pool_bytes;
+    }
+    Trim(max_pool_bytes);
+  }
+
+  // Returns a buffer of |size| elements. The elements of a recycled buffer
+  // are left as its previous user left them, so the caller must overwrite all
+  // of them. The buffer is counted in |bytes_in_use| until it is released with
+  // |Release()|, so it must not be reallocated until then. If it is freed
+  // without being released, it is counted until the allocator returns its
+  // address for another buffer of this pool.
+  std::vector<T> Acquire(size_t size) {
+    return DoAcquire(size, /*tracked=*/true);
+  }
+
+  // Same as above, but every element is |value|.
+  std::vector<T> Acquire(size_t size, const T& value) {
+    std::vector<T> buffer = Acquire(size);
+    std::fill(buffer.begin(), buffer.end(), value);
+    return buffer;
+  }
+
+  // Same as |Acquire()|, but the buffer is not counted in |bytes_in_use|. Use
+  // this for the buffers handed over to the callers that may free them
+  // without releasing them, like the results of an FFT.
+  std::vector<T> AcquireUntracked(size_t size) {
+    return DoAcquire(size, /*tracked=*/false);
+  }
+
+  // Returns |buffer| to this pool. A buffer not acquired with |Acquire()| is
+  // taken over as well, and then it is only counted in |pool_bytes|.
+  void Release(std::vector<T>&& buffer) {
+    int64_t bytes = GetBytes(buffer);
+    if (bytes < static_cast<int64_t>(kMinPooledBytes)) {
+      std::vector<T>().swap(buffer);
+      return;
+    }
+
+    size_t size_class = base::bits::Log2Floor(buffer.capacity());
+    // Destroyed after |lock|, so that a buffer over the limit is freed out of
+    // the lock.
+    std::vector<T> freed;
+    absl::MutexLock lock(&mutex_);
+    Untrack(buffer.data());
+    if (pool_bytes_ + bytes > max_pool_bytes_) {
+      freed = std::move(buffer);
+      return;
+    }
+    pool_bytes_ += bytes;
+    UpdatePeaks();
+    if (size_class >= free_buffers_.size()) {
+      free_buffers_.resize(size_class + 1);
+    }
+    free_buffers_[size_class].push_back(std::move(buffer));
+  }
+
+  // Frees the buffers in this pool, the largest ones first, until it holds at
+  // most |max_bytes| bytes.
+  void Trim(int64_t max_bytes) {
+    std::vector<std::vector<T>> freed;
+    absl::MutexLock lock(&mutex_);
+    for (size_t i = free_buffers_.size(); i > 0 && pool_bytes_ > max_bytes;
+         --i) {
+      std::vector<std::vector<T>>& buffers = free_buffers_[i - 1];
+      while (!buffers.empty() && pool_bytes_ > max_bytes) {
+        pool_bytes_ -= GetBytes(buffers.back());
+        freed.push_back(std::move(buffers.back()));
+        buffers.pop_back();
+      }
+    }
+  }
+
+  // Frees all the buffers in this pool.
+  void Clear() { Trim(0); }
+
+  // Returns the statistics of this pool, where
+  // - |num_allocs|: the number of the buffers allocated since no buffer of
+  //   the size class was in the pool.
+  // - |bytes_in_use|: the bytes of the buffers acquired with |Acquire()| and
+  //   not released.
+  // - |pool_bytes|: the bytes of the buffers in the pool.
+  // - |bytes_reserved|: the sum of the two above.
+  // The peaks are the high-water marks since the last |ClearStats()|.
+  AllocatorStats GetStats() const {
+    absl::MutexLock lock(&mutex_);
+    AllocatorStats stats;
+    stats.num_allocs = num_allocs_;
+    stats.bytes_in_use = bytes_in_use_;
+    stats.peak_bytes_in_use = peak_bytes_in_use_;
+    stats.largest_alloc_size = largest_alloc_size_;
+    stats.bytes_reserved = bytes_in_use_ + pool_bytes_;
+    stats.peak_bytes_reserved = peak_bytes_reserved_;
+    stats.pool_bytes = pool_bytes_;
+    stats.peak_pool_bytes = peak_pool_bytes_;
+    return stats;
+  }
+
+  // Clears the statistics and resets the peaks to the current bytes. Call
+  // this before a proof to get the high-water marks of the proof.
+  void ClearStats() {
+    absl::MutexLock lock(&mutex_);
+    num_allocs_ = 0;
+    largest_alloc_size_ = 0;
+    peak_bytes_in_use_ = bytes_in_use_;
+    peak_bytes_reserved_ = bytes_in_use_ + pool_bytes_;
+    peak_pool_bytes_ = pool_bytes_;
+  }
+
+ private:
+  std::vector<T> DoAcquire(size_t size, bool tracked) {
+    if (size * sizeof(T) < kMinPooledBytes) return std::vector<T>(size);
+
+    size_t size_class = base::bits::Log2Ceiling(size);
+    std::vector<T> buffer;
+    bool recycled = false;
+    {
+      absl::MutexLock lock(&mutex_);
+      if (size_class < free_buffers_.size() &&
+          !free_buffers_[size_class].empty()) {
+        buffer = std::move(free_buffers_[size_class].back());
+        free_buffers_[size_class].pop_back();
+        pool_bytes_ -= GetBytes(buffer);
+        recycled = true;
+      }
+    }
+    if (!recycled) buffer.reserve(size_t{1} << size_class);
+    // The capacity is kept, and the elements are not touched if the buffer
+    // has been at least as large as |size|.
+    buffer.resize(size);
+
+    absl::MutexLock lock(&mutex_);
+    int64_t bytes = GetBytes(buffer);
+    if (!recycled) {
+      ++num_allocs_;
+      largest_alloc_size_ = std::max(largest_alloc_size_, bytes);
+      // A tracked buffer at the same address has been freed without being
+      // released, so it isn't in use anymore.
+      Untrack(buffer.data());
+    }
+    if (tracked) {
+      tracked_bytes_[buffer.data()] = bytes;
+      bytes_in_use_ += bytes;
+    }
+    UpdatePeaks();
+    return buffer;
+  }
+
+  // Stops counting the buffer at |data| in |bytes_in_use_| if it is tracked.
+  void Untrack(const T* data) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    auto it = tracked_bytes_.find(data);
+    if (it == tracked_bytes_.end()) return;
+    bytes_in_use_ -= it->second;
+    tracked_bytes_.erase(it);
+  }
+
+  static int64_t GetBytes(const std::vector<T>& buffer) {
+    return static_cast<int64_t>(buffer.capacity() * sizeof(T));
+  }
+
+  void UpdatePeaks() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    peak_bytes_in_use_ = std::max(peak_bytes_in_use_, bytes_in_use_);
+    peak_bytes_reserved_ =
+        std::max(peak_bytes_reserved_, bytes_in_use_ + pool_bytes_);
+    peak_pool_bytes_ = std::max(peak_pool_bytes_, pool_bytes_);
+  }
+
+  mutable absl::Mutex mutex_;
+  // The i-th element has the buffers whose capacities are in [2ⁱ, 2ⁱ⁺¹).
+  std::vector<std::vector<std::vector<T>>> free_buffers_
+      ABSL_GUARDED_BY(mutex_);
+  // The bytes of the buffers acquired with |Acquire()| and not released,
+  // keyed by their data.
+  absl::flat_hash_map<const T*, int64_t> tracked_bytes_
+      ABSL_GUARDED_BY(mutex_);
+  int64_t max_pool_bytes_ ABSL_GUARDED_BY(mutex_) =
+      std::numeric_limits<int64_t>::max();
+  int64_t num_allocs_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t largest_alloc_size_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t bytes_in_use_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t peak_bytes_in_use_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t pool_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t peak_pool_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  int64_t peak_bytes_reserved_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace tachyon::device
+
+#endif  // TACHYON_DEVICE_BUFFER_POOL_H_
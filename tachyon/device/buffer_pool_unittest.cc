@@ -0,0 +1,158 @@
+#include "tachyon/device/buffer_pool.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+#include "gtest/gtest.h"
+
+namespace tachyon::device {
+
+namespace {
+
+constexpr size_t kPooledSize = BufferPool<uint64_t>::kMinPooledBytes;
+
+}  // namespace
+
+TEST(BufferPoolTest, Recycle) {
+  BufferPool<uint64_t> pool;
+  std::vector<uint64_t> buffer = pool.Acquire(kPooledSize, 1);
+  EXPECT_EQ(buffer.size(), kPooledSize);
+  EXPECT_EQ(buffer, std::vector<uint64_t>(kPooledSize, 1));
+  const uint64_t* data = buffer.data();
+  pool.Release(std::move(buffer));
+
+  // A buffer of the same size class is recycled.
+  std::vector<uint64_t> buffer2 = pool.Acquire(kPooledSize - 1, 2);
+  EXPECT_EQ(buffer2.data(), data);
+  EXPECT_EQ(buffer2, std::vector<uint64_t>(kPooledSize - 1, 2));
+
+  // A buffer of another size class is not.
+  std::vector<uint64_t> buffer3 = pool.Acquire(kPooledSize * 2);
+  EXPECT_NE(buffer3.data(), data);
+  EXPECT_GE(buffer3.capacity(), kPooledSize * 2);
+}
+
+TEST(BufferPoolTest, SmallBuffersAreNotPooled) {
+  BufferPool<uint64_t> pool;
+  std::vector<uint64_t> buffer = pool.Acquire(1, 1);
+  EXPECT_EQ(buffer, std::vector<uint64_t>({1}));
+  pool.Release(std::move(buffer));
+
+  AllocatorStats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocs, 0);
+  EXPECT_EQ(stats.bytes_reserved, 0);
+}
+
+TEST(BufferPoolTest, Stats) {
+  BufferPool<uint64_t> pool;
+  constexpr int64_t kBytes = kPooledSize * sizeof(uint64_t);
+
+  std::vector<uint64_t> buffer = pool.Acquire(kPooledSize);
+  std::vector<uint64_t> buffer2 = pool.Acquire(kPooledSize);
+  AllocatorStats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocs, 2);
+  EXPECT_EQ(stats.bytes_in_use, 2 * kBytes);
+  EXPECT_EQ(stats.largest_alloc_size, kBytes);
+  EXPECT_EQ(stats.bytes_reserved, 2 * kBytes);
+  EXPECT_EQ(stats.pool_bytes, 0);
+
+  pool.Release(std::move(buffer));
+  pool.Release(std::move(buffer2));
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_EQ(stats.peak_bytes_in_use, 2 * kBytes);
+  EXPECT_EQ(stats.pool_bytes, 2 * kBytes);
+  EXPECT_EQ(stats.bytes_reserved, 2 * kBytes);
+  EXPECT_EQ(stats.peak_bytes_reserved, 2 * kBytes);
+
+  // The second round is served by the pool and doesn't raise the high-water
+  // mark.
+  pool.ClearStats();
+  buffer = pool.Acquire(kPooledSize);
+  buffer2 = pool.Acquire(kPooledSize);
+  pool.Release(std::move(buffer));
+  pool.Release(std::move(buffer2));
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocs, 0);
+  EXPECT_EQ(stats.peak_bytes_reserved, 2 * kBytes);
+
+  pool.Clear();
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.pool_bytes, 0);
+  EXPECT_EQ(stats.bytes_reserved, 0);
+}
+
+TEST(BufferPoolTest, Untracked) {
+  BufferPool<uint64_t> pool;
+  constexpr int64_t kBytes = kPooledSize * sizeof(uint64_t);
+
+  // An untracked buffer isn't in use, and it may be freed without being
+  // released.
+  std::vector<uint64_t> buffer = pool.AcquireUntracked(kPooledSize);
+  pool.AcquireUntracked(kPooledSize);
+  AllocatorStats stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocs, 2);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+
+  // Releasing it doesn't take the bytes of a tracked one off.
+  std::vector<uint64_t> tracked = pool.Acquire(kPooledSize);
+  pool.Release(std::move(buffer));
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.bytes_in_use, kBytes);
+  EXPECT_EQ(stats.pool_bytes, kBytes);
+
+  pool.Release(std::move(tracked));
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_EQ(stats.pool_bytes, 2 * kBytes);
+}
+
+TEST(BufferPoolTest, TrackedBufferFreedWithoutRelease) {
+  BufferPool<uint64_t> pool;
+  constexpr int64_t kBytes = kPooledSize * sizeof(uint64_t);
+
+  // The buffers are freed without being released. Once the allocator reuses
+  // the address of a freed one, it isn't counted anymore, so only one buffer
+  // per distinct address is in use.
+  absl::flat_hash_set<const uint64_t*> addresses;
+  for (size_t i = 0; i < 16; ++i) {
+    std::vector<uint64_t> buffer = pool.Acquire(kPooledSize);
+    addresses.insert(buffer.data());
+  }
+  EXPECT_EQ(pool.GetStats().bytes_in_use,
+            static_cast<int64_t>(addresses.size()) * kBytes);
+}
+
+TEST(BufferPoolTest, MaxPoolBytes) {
+  BufferPool<uint64_t> pool;
+  constexpr int64_t kBytes = kPooledSize * sizeof(uint64_t);
+
+  std::vector<uint64_t> small = pool.Acquire(kPooledSize);
+  std::vector<uint64_t> large = pool.Acquire(kPooledSize * 2);
+  std::vector<uint64_t> large2 = pool.Acquire(kPooledSize * 2);
+  pool.Release(std::move(small));
+  pool.Release(std::move(large));
+  pool.Release(std::move(large2));
+  EXPECT_EQ(pool.GetStats().pool_bytes, 5 * kBytes);
+
+  // The largest buffers are freed first.
+  pool.Trim(2 * kBytes);
+  EXPECT_EQ(pool.GetStats().pool_bytes, kBytes);
+
+  // A buffer released over the limit is freed.
+  pool.set_max_pool_bytes(2 * kBytes);
+  EXPECT_EQ(pool.max_pool_bytes(), 2 * kBytes);
+  pool.Release(pool.Acquire(kPooledSize * 2));
+  EXPECT_EQ(pool.GetStats().pool_bytes, kBytes);
+  pool.Release(pool.Acquire(kPooledSize * 2));
+  EXPECT_EQ(pool.GetStats().pool_bytes, kBytes);
+
+  pool.set_max_pool_bytes(0);
+  AllocatorStats stats = pool.GetStats();
+  EXPECT_EQ(stats.pool_bytes, 0);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+}
+
+}  // namespace tachyon::device
@@ -7,6 +7,9 @@
 #include "tachyon/build/build_config.h"
 
 #if defined(TACHYON_USE_NUMA)
+#include <stdint.h>
+#include <unistd.h>
+
 // NOLINTNEXTLINE(build/include_subdir)
 #include "hwloc.h"  // from @hwloc
 #endif
@@ -34,6 +37,10 @@ void NUMAFree(void* ptr, size_t size) { tsl::port::Free(ptr); }
 
 int NUMAGetMemAffinity(const void* addr) { return kNUMANoAffinity; }
 
+bool NUMABindMem(const void* ptr, size_t size, int node) { return false; }
+
+bool NUMAInterleaveMem(const void* ptr, size_t size) { return false; }
+
 #else
 
 #if defined(TACHYON_USE_NUMA)
@@ -68,13 +75,23 @@ hwloc_obj_t GetHWLocTypeIndex(hwloc_obj_type_t tp, int index) {
   }
   return obj;
 }
+
+// Expands [ptr, ptr + size) to the start of the page it begins in, since the
+// memory binding works on whole pages.
+void AlignToPage(const void** ptr, size_t* size) {
+  uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  uintptr_t begin = reinterpret_cast<uintptr_t>(*ptr);
+  uintptr_t aligned_begin = begin & ~(page_size - 1);
+  *ptr = reinterpret_cast<const void*>(aligned_begin);
+  *size += begin - aligned_begin;
+}
 }  // namespace
 #endif  // defined(TACHYON_USE_NUMA)
 
 bool NUMAEnabled() { return (NUMANumNodes() > 1); }
 
 int NUMANumNodes() {
-#if defined(TENSORFLOW_USE_NUMA)
+#if defined(TACHYON_USE_NUMA)
   if (HaveHWLocTopology()) {
     int num_numanodes =
         hwloc_get_nbobjs_by_type(hwloc_topology_handle, HWLOC_OBJ_NUMANODE);
@@ -84,7 +101,7 @@ int NUMANumNodes() {
   }
 #else
   return 1;
-#endif  // defined(TENSORFLOW_USE_NUMA)
+#endif  // defined(TACHYON_USE_NUMA)
 }
 
 void NUMASetThreadNodeAffinity(int node) {
@@ -175,5 +192,45 @@ int NUMAGetMemAffinity(const void* addr) {
   return node;
 }
 
+bool NUMABindMem(const void* ptr, size_t size, int node) {
+#if defined(TACHYON_USE_NUMA)
+  if (HaveHWLocTopology() && size > 0) {
+    hwloc_obj_t numa_node = GetHWLocTypeIndex(HWLOC_OBJ_NUMANODE, node);
+    if (!numa_node) {
+      LOG(ERROR) << "Failed to find hwloc NUMA node " << node;
+      return false;
+    }
+    AlignToPage(&ptr, &size);
+    if (hwloc_set_area_membind(
+            hwloc_topology_handle, ptr, size, numa_node->nodeset,
+            HWLOC_MEMBIND_BIND,
+            HWLOC_MEMBIND_MIGRATE | HWLOC_MEMBIND_BYNODESET)) {
+      LOG(ERROR) << "Failed call to hwloc_set_area_membind.";
+      return false;
+    }
+    return true;
+  }
+#endif  // defined(TACHYON_USE_NUMA)
+  return false;
+}
+
+bool NUMAInterleaveMem(const void* ptr, size_t size) {
+#if defined(TACHYON_USE_NUMA)
+  if (HaveHWLocTopology() && size > 0) {
+    AlignToPage(&ptr, &size);
+    if (hwloc_set_area_membind(
+            hwloc_topology_handle, ptr, size,
+            hwloc_topology_get_topology_nodeset(hwloc_topology_handle),
+            HWLOC_MEMBIND_INTERLEAVE,
+            HWLOC_MEMBIND_MIGRATE | HWLOC_MEMBIND_BYNODESET)) {
+      LOG(ERROR) << "Failed call to hwloc_set_area_membind.";
+      return false;
+    }
+    return true;
+  }
+#endif  // defined(TACHYON_USE_NUMA)
+  return false;
+}
+
 #endif
 }  // namespace tachyon::device
@@ -40,6 +40,15 @@ void NUMAFree(void* ptr, size_t size);
 // Returns NUMA node affinity of memory address, kNUMANoAffinity if none.
 int NUMAGetMemAffinity(const void* ptr);
 
+// If possible binds the pages of [ptr, ptr + size) to the specified NUMA node,
+// migrating the ones already touched. Returns false if it is not supported.
+bool NUMABindMem(const void* ptr, size_t size, int node);
+
+// If possible interleaves the pages of [ptr, ptr + size) across all the NUMA
+// nodes, migrating the ones already touched. Returns false if it is not
+// supported.
+bool NUMAInterleaveMem(const void* ptr, size_t size);
+
 }  // namespace tachyon::device
 
 #endif  // TACHYON_DEVICE_NUMA_H_
@@ -0,0 +1,55 @@
+#include "tachyon/device/numa_placement.h"
+
+#include <stdint.h>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/device/numa.h"
+
+namespace tachyon::device {
+
+std::string_view NUMAPlacementToString(NUMAPlacement placement) {
+  switch (placement) {
+    case NUMAPlacement::kFirstTouch:
+      return "FirstTouch";
+    case NUMAPlacement::kInterleaved:
+      return "Interleaved";
+    case NUMAPlacement::kPartitioned:
+      return "Partitioned";
+  }
+  NOTREACHED();
+  return "";
+}
+
+bool PlaceOnNUMANodes(const void* ptr, size_t size, NUMAPlacement placement) {
+  if (placement == NUMAPlacement::kFirstTouch ||
+      size < kMinNUMAPlacementSize) {
+    return true;
+  }
+  if (!NUMAEnabled()) return false;
+
+  switch (placement) {
+    case NUMAPlacement::kFirstTouch:
+      return true;
+    case NUMAPlacement::kInterleaved:
+      return NUMAInterleaveMem(ptr, size);
+    case NUMAPlacement::kPartitioned: {
+      // The parts are split the same way as |GetNUMAPartitionNode()| splits
+      // the chunks, so that a chunk is read on the node its memory is bound
+      // to except for the pages at the boundaries.
+      size_t num_nodes = static_cast<size_t>(NUMANumNodes());
+      const uint8_t* bytes = reinterpret_cast<const uint8_t*>(ptr);
+      for (size_t i = 0; i < num_nodes; ++i) {
+        size_t begin = size * i / num_nodes;
+        size_t end = size * (i + 1) / num_nodes;
+        if (!NUMABindMem(bytes + begin, end - begin, static_cast<int>(i))) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+  NOTREACHED();
+  return false;
+}
+
+}  // namespace tachyon::device
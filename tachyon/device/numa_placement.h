@@ -0,0 +1,56 @@
+#ifndef TACHYON_DEVICE_NUMA_PLACEMENT_H_
+#define TACHYON_DEVICE_NUMA_PLACEMENT_H_
+
+#include <stddef.h>
+
+#include <string_view>
+
+#include "absl/types/span.h"
+
+#include "tachyon/export.h"
+
+namespace tachyon::device {
+
+// How the pages of a large buffer are placed on the NUMA nodes.
+enum class NUMAPlacement {
+  // Leaves them on the node of the thread that touches them first.
+  kFirstTouch,
+  // Interleaves them across all the nodes page by page. This suits the
+  // buffers that every worker reads all over, like the input of an FFT or the
+  // bases of an MSM whose windows run in parallel.
+  kInterleaved,
+  // Splits the buffer into |NUMANumNodes()| contiguous parts of the same size
+  // and binds the i-th one to the i-th node. This suits the buffers processed
+  // in contiguous chunks by |base::ParallelForPartitioned()|, which runs the
+  // chunks that fall in the i-th part on the workers of the i-th node. See
+  // |GetNUMAPartitionNode()|.
+  kPartitioned,
+};
+
+TACHYON_EXPORT std::string_view NUMAPlacementToString(NUMAPlacement placement);
+
+// The buffers smaller than this are not placed, since moving their pages
+// costs more than the remote accesses to them save.
+constexpr size_t kMinNUMAPlacementSize = size_t{1} << 21;
+
+// Returns the node that holds the |index|-th of the |n| chunks of a buffer
+// placed with |NUMAPlacement::kPartitioned| on |num_nodes| nodes.
+constexpr int GetNUMAPartitionNode(size_t index, size_t n, size_t num_nodes) {
+  return static_cast<int>(index * num_nodes / n);
+}
+
+// Places the pages of [|ptr|, |ptr| + |size|) by |placement|, migrating the
+// ones already touched. Returns false if NUMA is not enabled or the placement
+// fails. Nothing is done for |NUMAPlacement::kFirstTouch| or a buffer smaller
+// than |kMinNUMAPlacementSize|, which is not a failure.
+TACHYON_EXPORT bool PlaceOnNUMANodes(const void* ptr, size_t size,
+                                     NUMAPlacement placement);
+
+template <typename T>
+bool PlaceOnNUMANodes(absl::Span<const T> values, NUMAPlacement placement) {
+  return PlaceOnNUMANodes(values.data(), values.size() * sizeof(T), placement);
+}
+
+}  // namespace tachyon::device
+
+#endif  // TACHYON_DEVICE_NUMA_PLACEMENT_H_
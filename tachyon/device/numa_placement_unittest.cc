@@ -0,0 +1,45 @@
+#include "tachyon/device/numa_placement.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/device/numa.h"
+
+namespace tachyon::device {
+
+TEST(NUMAPlacementTest, GetNUMAPartitionNode) {
+  constexpr size_t kNumNodes = 4;
+  int prev_node = 0;
+  for (size_t i = 0; i < 64; ++i) {
+    int node = GetNUMAPartitionNode(i, 64, kNumNodes);
+    EXPECT_GE(node, prev_node);
+    EXPECT_LT(node, static_cast<int>(kNumNodes));
+    prev_node = node;
+  }
+  EXPECT_EQ(GetNUMAPartitionNode(0, 64, kNumNodes), 0);
+  EXPECT_EQ(GetNUMAPartitionNode(16, 64, kNumNodes), 1);
+  EXPECT_EQ(GetNUMAPartitionNode(63, 64, kNumNodes), 3);
+  // The chunks fewer than the nodes skip some of them.
+  EXPECT_EQ(GetNUMAPartitionNode(1, 2, kNumNodes), 2);
+}
+
+TEST(NUMAPlacementTest, PlaceOnNUMANodes) {
+  std::vector<uint8_t> small(kMinNUMAPlacementSize / 2, 0);
+  EXPECT_TRUE(PlaceOnNUMANodes<uint8_t>(small, NUMAPlacement::kPartitioned));
+
+  std::vector<uint8_t> large(kMinNUMAPlacementSize * 4, 0);
+  EXPECT_TRUE(PlaceOnNUMANodes<uint8_t>(large, NUMAPlacement::kFirstTouch));
+  if (!NUMAEnabled()) {
+    EXPECT_FALSE(PlaceOnNUMANodes<uint8_t>(large, NUMAPlacement::kPartitioned));
+    return;
+  }
+  ASSERT_TRUE(PlaceOnNUMANodes<uint8_t>(large, NUMAPlacement::kPartitioned));
+  EXPECT_EQ(NUMAGetMemAffinity(large.data()), 0);
+  EXPECT_EQ(NUMAGetMemAffinity(&large.back()), NUMANumNodes() - 1);
+  EXPECT_TRUE(PlaceOnNUMANodes<uint8_t>(large, NUMAPlacement::kInterleaved));
+}
+
+}  // namespace tachyon::device
@@ -1016,6 +1016,12 @@ class Copyable<math::BigInt<N>> {
   }
 };
 
+template <size_t N>
+class TriviallySerializable<math::BigInt<N>> {
+ public:
+  static bool IsValid(const math::BigInt<N>& bigint) { return true; }
+};
+
 template <size_t N>
 class RapidJsonValueConverter<math::BigInt<N>> {
  public:
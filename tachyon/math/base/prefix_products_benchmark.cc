@@ -0,0 +1,39 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::math {
+
+template <typename F>
+void BM_PrefixProductsSerial(benchmark::State& state) {
+  std::vector<F> fields =
+      base::CreateVector(state.range(0), []() { return F::Random(); });
+  for (auto _ : state) {
+    for (size_t i = 1; i < fields.size(); ++i) {
+      fields[i] *= fields[i - 1];
+    }
+  }
+  benchmark::DoNotOptimize(fields);
+}
+
+template <typename F>
+void BM_PrefixProducts(benchmark::State& state) {
+  std::vector<F> fields =
+      base::CreateVector(state.range(0), []() { return F::Random(); });
+  for (auto _ : state) {
+    F::PrefixProductsInPlace(fields);
+  }
+  benchmark::DoNotOptimize(fields);
+}
+
+BENCHMARK_TEMPLATE(BM_PrefixProductsSerial, bn254::Fr)
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PrefixProducts, bn254::Fr)
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 22);
+
+}  // namespace tachyon::math
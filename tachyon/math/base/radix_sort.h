@@ -0,0 +1,113 @@
+#ifndef TACHYON_MATH_BASE_RADIX_SORT_H_
+#define TACHYON_MATH_BASE_RADIX_SORT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+
+// Sorts |values| in ascending order with a single pass of MSD radix sort: the
+// values are scattered into 2^|kRadixBits| buckets by their |kRadixBits| most
+// significant bits, skipping the leading bits that are zero in all of the
+// values, and then each bucket is sorted by comparing the limbs. Both the
+// scattering and the sorting of the buckets run in parallel. Skipping the
+// leading zero bits keeps the buckets small for small values, e.g, range check
+// tables, as well as for the uniformly distributed ones.
+template <size_t N>
+void RadixSortInPlace(absl::Span<BigInt<N>> values) {
+  constexpr size_t kRadixBits = 12;
+  constexpr size_t kNumBuckets = size_t{1} << kRadixBits;
+
+  size_t size = values.size();
+  if (size <= kNumBuckets) {
+    std::sort(values.begin(), values.end());
+    return;
+  }
+
+  size_t num_elems_per_chunk = base::GetNumElementsPerRange(size);
+  size_t num_chunks = (size + num_elems_per_chunk - 1) / num_elems_per_chunk;
+
+  // Find the bit length of the biggest value.
+  std::vector<BigInt<N>> chunk_ors(num_chunks);
+  base::ParallelFor(num_chunks, [values, size, num_elems_per_chunk,
+                                 &chunk_ors](size_t i) {
+    size_t end = std::min((i + 1) * num_elems_per_chunk, size);
+    for (size_t j = i * num_elems_per_chunk; j < end; ++j) {
+      for (size_t k = 0; k < N; ++k) {
+        chunk_ors[i].limbs[k] |= values[j].limbs[k];
+      }
+    }
+  });
+  size_t bit_length = 0;
+  for (size_t k = N; k > 0; --k) {
+    uint64_t limb = 0;
+    for (const BigInt<N>& chunk_or : chunk_ors) {
+      limb |= chunk_or.limbs[k - 1];
+    }
+    if (limb != 0) {
+      bit_length = (k - 1) * 64 + base::bits::Log2Floor(limb) + 1;
+      break;
+    }
+  }
+  size_t bit_offset = bit_length > kRadixBits ? bit_length - kRadixBits : 0;
+
+  // |offsets[i * kNumBuckets + b]| is where the values of the i-th chunk in
+  // the b-th bucket are scattered to.
+  std::vector<size_t> offsets(num_chunks * kNumBuckets, 0);
+  base::ParallelFor(num_chunks, [values, size, num_elems_per_chunk,
+                                 bit_offset, &offsets](size_t i) {
+    size_t* counts = &offsets[i * kNumBuckets];
+    size_t end = std::min((i + 1) * num_elems_per_chunk, size);
+    for (size_t j = i * num_elems_per_chunk; j < end; ++j) {
+      ++counts[values[j].ExtractBits32(bit_offset, kRadixBits)];
+    }
+  });
+  std::vector<size_t> bucket_offsets(kNumBuckets + 1);
+  size_t offset = 0;
+  for (size_t b = 0; b < kNumBuckets; ++b) {
+    bucket_offsets[b] = offset;
+    for (size_t i = 0; i < num_chunks; ++i) {
+      size_t count = offsets[i * kNumBuckets + b];
+      offsets[i * kNumBuckets + b] = offset;
+      offset += count;
+    }
+  }
+  bucket_offsets[kNumBuckets] = offset;
+
+  std::vector<BigInt<N>> scattered(size);
+  base::ParallelFor(num_chunks, [values, size, num_elems_per_chunk,
+                                 bit_offset, &offsets, &scattered](size_t i) {
+    size_t* chunk_offsets = &offsets[i * kNumBuckets];
+    size_t end = std::min((i + 1) * num_elems_per_chunk, size);
+    for (size_t j = i * num_elems_per_chunk; j < end; ++j) {
+      scattered[chunk_offsets[values[j].ExtractBits32(bit_offset,
+                                                      kRadixBits)]++] =
+          values[j];
+    }
+  });
+
+  base::ParallelForRange(
+      kNumBuckets,
+      [values, &bucket_offsets, &scattered](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b) {
+          auto first = scattered.begin() + bucket_offsets[b];
+          auto last = scattered.begin() + bucket_offsets[b + 1];
+          std::sort(first, last);
+          std::copy(first, last, values.begin() + bucket_offsets[b]);
+        }
+      },
+      /*min_elements_per_range=*/1);
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_BASE_RADIX_SORT_H_
@@ -0,0 +1,31 @@
+#include "tachyon/math/base/radix_sort.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+
+namespace tachyon::math {
+
+TEST(RadixSortTest, Sort) {
+  // Small enough to be sorted by comparisons, uniformly distributed, small
+  // and with many duplicates.
+  std::vector<std::vector<BigInt<4>>> tests = {
+      base::CreateVector(100, []() { return BigInt<4>::Random(); }),
+      base::CreateVector(100000, []() { return BigInt<4>::Random(); }),
+      base::CreateVector(
+          100000, [](size_t i) { return BigInt<4>((i * 7919) % 65536); }),
+      base::CreateVector(100000, [](size_t i) { return BigInt<4>(i % 3); }),
+  };
+  for (std::vector<BigInt<4>>& values : tests) {
+    std::vector<BigInt<4>> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    RadixSortInPlace(absl::MakeSpan(values));
+    EXPECT_EQ(values, expected);
+  }
+}
+
+}  // namespace tachyon::math
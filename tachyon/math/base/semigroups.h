@@ -14,6 +14,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/base/types/always_false.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/bit_iterator.h"
@@ -182,6 +183,50 @@ class MultiplicativeSemigroup {
     return ret;
   }
 
+  // values: [a₀, a₁, ..., aₙ₋₁]
+  // return: [a₀, a₀ * a₁, ..., a₀ * a₁ * ... * aₙ₋₁]
+  // The |values| are split into a chunk per task of |base::TaskPool|, which
+  // works from inside a task as well. The first pass computes
+  // the running products of each chunk in parallel. Then the last products of
+  // the chunks are scanned into the carries, and the second pass multiplies
+  // the carry of the previous chunks into each chunk in parallel.
+  // The multiplication must be commutative.
+  template <typename Container>
+  constexpr static void PrefixProductsInPlace(Container& values) {
+    size_t size = std::size(values);
+    if (size == 0) return;
+    size_t num_elems_per_chunk = base::GetNumElementsPerRange(size);
+    size_t num_chunks = (size + num_elems_per_chunk - 1) / num_elems_per_chunk;
+    base::ParallelFor(num_chunks, [&values, size,
+                                   num_elems_per_chunk](size_t i) {
+      size_t begin = i * num_elems_per_chunk;
+      size_t end = std::min(begin + num_elems_per_chunk, size);
+      for (size_t j = begin + 1; j < end; ++j) {
+        values[j] *= values[j - 1];
+      }
+    });
+    if (num_chunks == 1) return;
+
+    // |carries[i]| is the product of the first i + 1 chunks.
+    std::vector<G> carries;
+    carries.reserve(num_chunks - 1);
+    carries.push_back(values[num_elems_per_chunk - 1]);
+    for (size_t i = 1; i < num_chunks - 1; ++i) {
+      carries.push_back(carries.back() *
+                        values[(i + 1) * num_elems_per_chunk - 1]);
+    }
+
+    base::ParallelFor(num_chunks - 1, [&values, &carries, size,
+                                       num_elems_per_chunk](size_t i) {
+      size_t begin = (i + 1) * num_elems_per_chunk;
+      size_t end = std::min(begin + num_elems_per_chunk, size);
+      const G& carry = carries[i];
+      for (size_t j = begin; j < end; ++j) {
+        values[j] *= carry;
+      }
+    });
+  }
+
  private:
   constexpr static size_t kDefaultParallelThreshold = 1024;
 
@@ -4,8 +4,11 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/adapters.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
 #include "tachyon/math/elliptic_curves/short_weierstrass/test/sw_curve_config.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
 
 namespace tachyon::math {
 
@@ -113,6 +116,30 @@ TEST(SemigroupsTest, AddOverAddInPlace) {
   static_cast<void>(d);
 }
 
+TEST(SemigroupsTest, PrefixProductsInPlace) {
+  GF7::Init();
+
+  std::vector<GF7> values;
+  GF7::PrefixProductsInPlace(values);
+  EXPECT_TRUE(values.empty());
+
+  size_t task_nums = base::TaskPool::GetInstance().concurrency();
+  // Small enough to be computed in a single chunk, and large enough to be
+  // split into a chunk per task.
+  for (size_t size : {size_t{1}, size_t{10}, task_nums * 1024 + 3}) {
+    values = base::CreateVector(size, [](size_t i) {
+      return GF7(static_cast<uint32_t>(i % 6 + 1));
+    });
+    std::vector<GF7> expected = values;
+    for (size_t i = 1; i < size; ++i) {
+      expected[i] *= expected[i - 1];
+    }
+
+    GF7::PrefixProductsInPlace(values);
+    EXPECT_EQ(values, expected);
+  }
+}
+
 namespace {
 
 class MultiScalarMulTest : public testing::Test {
@@ -13,7 +13,7 @@
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
-#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
@@ -58,17 +58,10 @@ class Pippenger : public PippengerBase<Point> {
 
   constexpr static size_t N = ScalarField::N;
 
-  Pippenger() : use_msm_window_naf_(Point::kNegationIsCheap) {
-#if defined(TACHYON_HAS_OPENMP)
-    parallel_windows_ = true;
-#endif  // defined(TACHYON_HAS_OPENMP)
-  }
+  Pippenger() : use_msm_window_naf_(Point::kNegationIsCheap) {}
 
   void SetParallelWindows(bool parallel_windows) {
     parallel_windows_ = parallel_windows;
-#if !defined(TACHYON_HAS_OPENMP)
-    LOG_IF(WARNING, parallel_windows) << "Set parallel windows without openmp";
-#endif  // !defined(TACHYON_HAS_OPENMP)
   }
 
   void SetUseMSMWindowNAForTesting(bool use_msm_window_naf) {
@@ -150,11 +143,11 @@ class Pippenger : public PippengerBase<Point> {
       FillDigits(scalars[i], ctx_.window_bits, &scalar_digits[i]);
     }
     if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
+      base::ParallelFor(ctx_.window_count, [&](size_t i) {
         AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
                                      &(*window_sums)[i],
                                      i == ctx_.window_count - 1);
-      }
+      });
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
         AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
@@ -211,10 +204,10 @@ class Pippenger : public PippengerBase<Point> {
                             absl::Span<const BigInt<N>> scalars,
                             std::vector<Bucket>* window_sums) {
     if (parallel_windows_) {
-      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
+      base::ParallelFor(ctx_.window_count, [&](size_t i) {
         AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
                                   &(*window_sums)[i]);
-      }
+      });
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
         AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
@@ -224,7 +217,8 @@ class Pippenger : public PippengerBase<Point> {
   }
 
   bool use_msm_window_naf_ = false;
-  bool parallel_windows_ = false;
+  // The windows are run as the tasks of the |TaskPool|.
+  bool parallel_windows_ = true;
   PippengerCtx ctx_;
 };
 
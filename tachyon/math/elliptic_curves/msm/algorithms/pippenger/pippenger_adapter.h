@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
 
 namespace tachyon::math {
@@ -31,6 +32,19 @@ class PippengerAdapter {
                            PippengerParallelStrategy::kParallelWindow, ret);
   }
 
+  // Splits |scalars_size| scalars into at most |task_nums| terms of |*size|
+  // scalars, except for the last one which may be shorter, and returns the
+  // number of the terms. Every term gets at least a scalar. Rounding |*size|
+  // up may leave fewer terms than |task_nums|, e.g., 5 scalars in 4 terms are
+  // split into 3 terms of 2, 2 and 1 scalars.
+  static size_t ComputeTermNums(size_t scalars_size, size_t task_nums,
+                                size_t* size) {
+    task_nums = std::max(std::min(task_nums, scalars_size), size_t{1});
+    *size = (scalars_size + task_nums - 1) / task_nums;
+    if (*size == 0) return task_nums;
+    return (scalars_size + *size - 1) / *size;
+  }
+
   template <typename BaseInputIterator, typename ScalarInputIterator>
   bool RunWithStrategy(BaseInputIterator bases_first,
                        BaseInputIterator bases_last,
@@ -53,42 +67,42 @@ class PippengerAdapter {
         return false;
       }
 
-#if defined(TACHYON_HAS_OPENMP)
-      int thread_nums = omp_get_max_threads();
+      // With |kParallelWindowAndTerm|, the windows of each term are run in
+      // parallel as well. They are nested tasks of the |TaskPool|, so the
+      // cores are not oversubscribed.
+      size_t task_nums = base::TaskPool::GetInstance().concurrency();
       if (strategy == PippengerParallelStrategy::kParallelWindowAndTerm) {
         size_t window_bits = PippengerCtx::ComputeWindowsBits(scalars_size);
         size_t window_size =
             PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits);
-        thread_nums = std::max(thread_nums / static_cast<int>(window_size), 2);
+        task_nums = std::max(task_nums / window_size, size_t{2});
       }
-#else
-      int thread_nums = 1;
-#endif  // defined(TACHYON_HAS_OPENMP)
+      size_t size;
+      task_nums = ComputeTermNums(scalars_size, task_nums, &size);
       struct Result {
         Bucket value;
         bool valid;
       };
 
       std::vector<Result> results;
-      results.resize(thread_nums);
-      size_t size = (scalars_size + thread_nums - 1) / thread_nums;
-#if defined(TACHYON_HAS_OPENMP)
-      omp_set_num_threads(thread_nums);
-#endif
-      OPENMP_PARALLEL_FOR(int i = 0; i < thread_nums; ++i) {
+      results.resize(task_nums);
+      // Each term reads a contiguous chunk of the bases, so it is run on the
+      // NUMA node that holds the chunk if the bases are placed with
+      // |device::NUMAPlacement::kPartitioned|.
+      base::ParallelForPartitioned(task_nums, [&](size_t i) {
         Pippenger<Point> pippenger;
         pippenger.SetParallelWindows(
             strategy == PippengerParallelStrategy::kParallelWindowAndTerm);
         auto bases_start = bases_first + size * i;
         auto bases_end =
-            i == thread_nums - 1 ? bases_last : bases_first + size * (i + 1);
+            i == task_nums - 1 ? bases_last : bases_first + size * (i + 1);
         auto scalars_start = scalars_first + size * i;
-        auto scalars_end = i == thread_nums - 1
+        auto scalars_end = i == task_nums - 1
                                ? scalars_last
                                : scalars_first + size * (i + 1);
         results[i].valid = pippenger.Run(bases_start, bases_end, scalars_start,
                                          scalars_end, &results[i].value);
-      }
+      });
 
       bool all_good =
           std::all_of(results.begin(), results.end(),
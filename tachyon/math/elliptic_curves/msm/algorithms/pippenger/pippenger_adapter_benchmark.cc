@@ -1,5 +1,8 @@
+#include <string>
+
 #include "benchmark/benchmark.h"
 
+#include "tachyon/device/numa_placement.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
 
@@ -65,6 +68,30 @@ void BM_PippengerAdapterNonUniformWithParallelWindowAndTerm(
                       PippengerParallelStrategy::kParallelWindowAndTerm>(state);
 }
 
+// Each term reads a contiguous chunk of the bases, so the bases partitioned on
+// the NUMA nodes are read locally. See |base::ParallelForPartitioned()|.
+template <typename Point, device::NUMAPlacement Placement>
+void BM_PippengerAdapterRandomWithParallelTermOnNUMANodes(
+    benchmark::State& state) {
+  Point::Curve::Init();
+  MSMTestSet<Point> test_set =
+      MSMTestSet<Point>::Random(state.range(0), MSMMethod::kNone);
+  if (!device::PlaceOnNUMANodes<Point>(test_set.bases, Placement)) {
+    state.SkipWithError("NUMA is not enabled");
+    return;
+  }
+  state.SetLabel(std::string(device::NUMAPlacementToString(Placement)));
+  PippengerAdapter<Point> pippenger;
+  using Bucket = typename PippengerAdapter<Point>::Bucket;
+  Bucket ret;
+  for (auto _ : state) {
+    pippenger.RunWithStrategy(test_set.bases.begin(), test_set.bases.end(),
+                              test_set.scalars.begin(), test_set.scalars.end(),
+                              PippengerParallelStrategy::kParallelTerm, &ret);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
 BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelWindow,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
@@ -89,6 +116,18 @@ BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelWindowAndTerm,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelTermOnNUMANodes,
+                   bn254::G1AffinePoint, device::NUMAPlacement::kFirstTouch)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelTermOnNUMANodes,
+                   bn254::G1AffinePoint, device::NUMAPlacement::kInterleaved)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelTermOnNUMANodes,
+                   bn254::G1AffinePoint, device::NUMAPlacement::kPartitioned)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 22);
 
 }  // namespace tachyon::math
 
@@ -46,4 +46,49 @@ TEST_F(PippengerAdapterTest, RunWithStrategy) {
   }
 }
 
+TEST_F(PippengerAdapterTest, ComputeTermNums) {
+  struct {
+    size_t scalars_size;
+    size_t task_nums;
+    size_t expected_term_nums;
+    size_t expected_size;
+  } tests[] = {
+      {0, 4, 1, 0}, {1, 4, 1, 1}, {5, 4, 3, 2},
+      {7, 6, 4, 2}, {8, 4, 4, 2}, {1024, 12, 12, 86},
+  };
+
+  for (const auto& test : tests) {
+    SCOPED_TRACE(absl::Substitute("scalars_size: $0, task_nums: $1",
+                                  test.scalars_size, test.task_nums));
+    size_t size;
+    size_t term_nums = PippengerAdapter<bn254::G1AffinePoint>::ComputeTermNums(
+        test.scalars_size, test.task_nums, &size);
+    EXPECT_EQ(term_nums, test.expected_term_nums);
+    EXPECT_EQ(size, test.expected_size);
+    // The last term starts before the end of the scalars.
+    if (test.scalars_size > 0) {
+      EXPECT_LT(size * (term_nums - 1), test.scalars_size);
+    }
+  }
+}
+
+TEST_F(PippengerAdapterTest, RunWithStrategyOnFewScalars) {
+  for (size_t n : {1, 2, 3, 5, 7, 13}) {
+    MSMTestSet<bn254::G1AffinePoint> test_set =
+        MSMTestSet<bn254::G1AffinePoint>::Random(n, MSMMethod::kMSM);
+    for (PippengerParallelStrategy strategy :
+         {PippengerParallelStrategy::kParallelTerm,
+          PippengerParallelStrategy::kParallelWindowAndTerm}) {
+      PippengerAdapter<bn254::G1AffinePoint> pippenger;
+      SCOPED_TRACE(absl::Substitute("n: $0, strategy: $1", n,
+                                    static_cast<int>(strategy)));
+      bn254::G1PointXYZZ ret;
+      EXPECT_TRUE(pippenger.RunWithStrategy(
+          test_set.bases.begin(), test_set.bases.end(),
+          test_set.scalars.begin(), test_set.scalars.end(), strategy, &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
 }  // namespace tachyon::math
@@ -200,6 +200,8 @@ class AffinePoint<
   }
 
  private:
+  friend class base::TriviallySerializable<AffinePoint<Curve>>;
+
   BaseField x_;
   BaseField y_;
   bool infinity_;
@@ -234,6 +236,27 @@ class Copyable<math::AffinePoint<
   }
 };
 
+template <typename Curve>
+class TriviallySerializable<math::AffinePoint<
+    Curve, std::enable_if_t<
+               Curve::kType == math::CurveType::kShortWeierstrass &&
+               IsTriviallySerializable<typename Curve::BaseField>::value>>> {
+ public:
+  // The byte of |infinity_| is checked before it is read as a bool, since a
+  // bool that is neither 0 nor 1 is undefined behavior.
+  static bool IsValid(const math::AffinePoint<Curve>& point) {
+    using BaseField = typename Curve::BaseField;
+    const uint8_t* infinity =
+        reinterpret_cast<const uint8_t*>(&point.infinity_);
+    if (*infinity > 1) return false;
+    if (!TriviallySerializable<BaseField>::IsValid(point.x()) ||
+        !TriviallySerializable<BaseField>::IsValid(point.y())) {
+      return false;
+    }
+    return point.infinity() || Curve::IsOnCurve(point);
+  }
+};
+
 template <typename Curve>
 class RapidJsonValueConverter<math::AffinePoint<
     Curve,
@@ -1,5 +1,7 @@
 #include "tachyon/math/elliptic_curves/short_weierstrass/affine_point.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
@@ -176,6 +178,26 @@ TEST_F(AffinePointTest, Copyable) {
   EXPECT_EQ(expected, value);
 }
 
+TEST_F(AffinePointTest, TriviallySerializable) {
+  std::vector<test::AffinePoint> points = {test::AffinePoint::Generator(),
+                                           test::AffinePoint::Zero()};
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.WriteRaw(absl::MakeConstSpan(points)));
+  std::vector<uint8_t> bytes = write_buf.owned_buffer();
+
+  base::Buffer read_buf(bytes.data(), bytes.size());
+  std::vector<test::AffinePoint> values(points.size());
+  ASSERT_TRUE(read_buf.ReadRaw(absl::MakeSpan(values), /*validate=*/true));
+  EXPECT_EQ(values, points);
+
+  // The infinity flag of the second point, which follows its coordinates, is
+  // neither 0 nor 1.
+  bytes[sizeof(test::AffinePoint) + 2 * sizeof(GF7)] = 2;
+  read_buf.set_buffer_offset(0);
+  EXPECT_FALSE(read_buf.ReadRaw(absl::MakeSpan(values), /*validate=*/true));
+}
+
 TEST_F(AffinePointTest, JsonValueConverter) {
   test::AffinePoint expected_point(GF7(1), GF7(2));
   std::string expected_json = R"({"x":{"value":"0x1"},"y":{"value":"0x2"}})";
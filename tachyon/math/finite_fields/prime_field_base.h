@@ -187,6 +187,19 @@ class Copyable<
   }
 };
 
+// Prime fields are written in their Montgomery forms by |Buffer::WriteRaw()|,
+// which is valid if it is less than the modulus.
+template <typename T>
+class TriviallySerializable<
+    T, std::enable_if_t<std::is_base_of_v<math::PrimeFieldBase<T>, T> &&
+                        std::is_same_v<typename T::value_type,
+                                       typename T::BigIntTy>>> {
+ public:
+  static bool IsValid(const T& prime_field) {
+    return prime_field.value() < T::Config::kModulus;
+  }
+};
+
 template <typename T>
 class RapidJsonValueConverter<
     T, std::enable_if_t<std::is_base_of_v<math::PrimeFieldBase<T>, T>>> {
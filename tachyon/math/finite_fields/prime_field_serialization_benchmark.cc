@@ -0,0 +1,103 @@
+#include <string.h>
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::math {
+
+template <typename F>
+void BM_WriteCopyable(benchmark::State& state) {
+  std::vector<F> fields =
+      base::CreateVector(state.range(0), []() { return F::Random(); });
+  for (auto _ : state) {
+    base::Uint8VectorBuffer buffer;
+    CHECK(buffer.Grow(base::EstimateSize(fields)));
+    CHECK(buffer.Write(fields));
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+template <typename F>
+void BM_WriteRaw(benchmark::State& state) {
+  std::vector<F> fields =
+      base::CreateVector(state.range(0), []() { return F::Random(); });
+  for (auto _ : state) {
+    base::Uint8VectorBuffer buffer;
+    CHECK(buffer.Grow(fields.size() * sizeof(F)));
+    CHECK(buffer.WriteRaw(absl::MakeConstSpan(fields)));
+    benchmark::DoNotOptimize(buffer);
+  }
+}
+
+template <typename F>
+void BM_ReadCopyable(benchmark::State& state) {
+  std::vector<F> fields =
+      base::CreateVector(state.range(0), []() { return F::Random(); });
+  base::Uint8VectorBuffer buffer;
+  CHECK(buffer.Write(fields));
+  for (auto _ : state) {
+    buffer.set_buffer_offset(0);
+    std::vector<F> read_fields;
+    CHECK(buffer.Read(&read_fields));
+    benchmark::DoNotOptimize(read_fields);
+  }
+}
+
+template <typename F>
+void BM_ReadRaw(benchmark::State& state) {
+  std::vector<F> fields =
+      base::CreateVector(state.range(0), []() { return F::Random(); });
+  base::Uint8VectorBuffer buffer;
+  CHECK(buffer.WriteRaw(absl::MakeConstSpan(fields)));
+  bool validate = state.range(1);
+  for (auto _ : state) {
+    buffer.set_buffer_offset(0);
+    std::vector<F> read_fields(fields.size());
+    CHECK(buffer.ReadRaw(absl::MakeSpan(read_fields), validate));
+    benchmark::DoNotOptimize(read_fields);
+  }
+}
+
+template <typename F>
+void BM_ReadRawView(benchmark::State& state) {
+  std::vector<F> fields =
+      base::CreateVector(state.range(0), []() { return F::Random(); });
+  base::Uint8VectorBuffer buffer;
+  CHECK(buffer.WriteRaw(absl::MakeConstSpan(fields)));
+  // The view needs the buffer to be aligned for |F|.
+  std::vector<F> aligned(fields.size());
+  memcpy(aligned.data(), buffer.buffer(), buffer.buffer_len());
+  base::Buffer aligned_buffer(aligned.data(), buffer.buffer_len());
+  bool validate = state.range(1);
+  for (auto _ : state) {
+    aligned_buffer.set_buffer_offset(0);
+    absl::Span<const F> view;
+    CHECK(aligned_buffer.ReadRawView(fields.size(), &view, validate));
+    benchmark::DoNotOptimize(view);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_WriteCopyable, bn254::Fr)
+    ->Arg(1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_WriteRaw, bn254::Fr)
+    ->Arg(1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadCopyable, bn254::Fr)
+    ->Arg(1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadRaw, bn254::Fr)
+    ->Args({1 << 24, false})
+    ->Args({1 << 24, true})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ReadRawView, bn254::Fr)
+    ->Args({1 << 24, false})
+    ->Args({1 << 24, true})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::math
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
@@ -197,4 +199,23 @@ TEST_F(PrimeFieldTest, Copyable) {
   EXPECT_EQ(expected, value);
 }
 
+TEST_F(PrimeFieldTest, WriteRaw) {
+  std::vector<GF7> expected = {GF7(1), GF7(3), GF7(5)};
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.WriteRaw(absl::MakeConstSpan(expected)));
+
+  write_buf.set_buffer_offset(0);
+  std::vector<GF7> values(expected.size());
+  ASSERT_TRUE(write_buf.ReadRaw(absl::MakeSpan(values), true));
+  EXPECT_EQ(values, expected);
+
+  // The Montgomery form must be less than the modulus.
+  base::Uint8VectorBuffer invalid_buf;
+  ASSERT_TRUE(invalid_buf.Write(BigInt<1>(7)));
+  invalid_buf.set_buffer_offset(0);
+  GF7 value;
+  EXPECT_FALSE(invalid_buf.ReadRaw(absl::MakeSpan(&value, 1), true));
+}
+
 }  // namespace tachyon::math
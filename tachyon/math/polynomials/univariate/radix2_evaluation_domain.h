@@ -27,6 +27,8 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/device/buffer_pool.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -99,13 +101,20 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   [[nodiscard]] constexpr Evals FFT(const DensePoly& poly) const override {
     if (poly.IsZero()) return {};
 
+    // The buffer is acquired with the size of the domain, so that it doesn't
+    // grow in |DegreeAwareFFTInPlace()|. It is untracked, since the caller
+    // owns the result and may free it without releasing it.
     Evals evals;
-    evals.evaluations_ = poly.coefficients_.coefficients_;
-    if (evals.evaluations_.size() * kDegreeAwareFFTThresholdFactor <=
-        this->size_) {
+    evals.evaluations_ =
+        device::BufferPool<F>::GetInstance().AcquireUntracked(this->size_);
+    const std::vector<F>& coeffs = poly.coefficients_.coefficients_;
+    size_t num_coeffs = std::min(coeffs.size(), this->size_);
+    if (num_coeffs * kDegreeAwareFFTThresholdFactor <= this->size_) {
+      evals.evaluations_.resize(num_coeffs);
+      std::copy_n(coeffs.begin(), num_coeffs, evals.evaluations_.begin());
       DegreeAwareFFTInPlace(evals);
     } else {
-      evals.evaluations_.resize(this->size_, F::Zero());
+      CopyAndPadWithZeros(coeffs, evals.evaluations_);
       InOrderFFTInPlace(evals);
     }
     return evals;
@@ -117,13 +126,23 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     if (evals.IsZero()) return {};
 
     DensePoly poly;
-    poly.coefficients_.coefficients_ = evals.evaluations_;
-    poly.coefficients_.coefficients_.resize(this->size_, F::Zero());
+    poly.coefficients_.coefficients_ =
+        device::BufferPool<F>::GetInstance().AcquireUntracked(this->size_);
+    CopyAndPadWithZeros(evals.evaluations_, poly.coefficients_.coefficients_);
     InOrderIFFTInPlace(poly);
     poly.coefficients_.RemoveHighDegreeZeros();
     return poly;
   }
 
+  // Copies |src| to the front of |dst| and fills the rest with zeros, since
+  // |dst| may be a recycled buffer.
+  static void CopyAndPadWithZeros(const std::vector<F>& src,
+                                  std::vector<F>& dst) {
+    size_t size = std::min(src.size(), dst.size());
+    std::copy_n(src.begin(), size, dst.begin());
+    std::fill(dst.begin() + size, dst.end(), F::Zero());
+  }
+
   // Degree aware FFT that runs in O(n log d) instead of O(n log n).
   // Implementation copied from libiop. (See
   // https://github.com/arkworks-rs/algebra/blob/master/poly/src/domain/radix2/fft.rs#L28)
@@ -170,11 +189,13 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   constexpr void InOrderIFFTInPlace(DensePoly& poly) const {
     IFFTHelperInPlace(poly);
     if (this->offset_.IsOne()) {
-      // clang-format off
-      OPENMP_PARALLEL_FOR(F& val : poly.coefficients_.coefficients_) {
-        // clang-format on
-        val *= this->size_inv_;
-      }
+      std::vector<F>& coeffs = poly.coefficients_.coefficients_;
+      base::ParallelForRange(coeffs.size(),
+                             [this, &coeffs](size_t begin, size_t end) {
+                               for (size_t i = begin; i < end; ++i) {
+                                 coeffs[i] *= this->size_inv_;
+                               }
+                             });
     } else {
       Base::DistributePowersAndMulByConst(poly, this->offset_inv_,
                                           this->size_inv_);
@@ -202,7 +223,7 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   template <FFTOrder Order, typename PolyOrEvals>
   constexpr static void ApplyButterfly(PolyOrEvals& poly_or_evals,
                                        absl::Span<const F> roots, size_t step,
-                                       size_t chunk_size, size_t thread_nums,
+                                       size_t chunk_size, size_t task_nums,
                                        size_t gap) {
     void (*fn)(F&, F&, const F&);
 
@@ -212,23 +233,33 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       static_assert(Order == FFTOrder::kOutIn);
       fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn;
     }
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < poly_or_evals.NumElements();
-                        i += chunk_size) {
-      // If the chunk is sufficiently big that parallelism helps,
-      // we parallelize the butterfly operation within the chunk.
-      if (gap > kMinGapSizeForParallelization && chunk_size < thread_nums) {
-        OPENMP_PARALLEL_FOR(size_t j = 0; j < gap; ++j) {
-          if (j * step < roots.size()) {
-            fn(*poly_or_evals[i + j], *poly_or_evals[i + j + gap],
-               roots[j * step]);
-          }
-        }
-      } else {
-        for (size_t j = 0, k = 0; j < gap && k < roots.size(); ++j, k += step) {
-          fn(*poly_or_evals[i + j], *poly_or_evals[i + j + gap], roots[k]);
+    // If the chunks are too few to keep the tasks busy and sufficiently big
+    // that parallelism helps, the butterflies of a chunk are split into
+    // |num_pieces| pieces. The pieces are then distributed over at most
+    // |task_nums| tasks.
+    size_t num_chunks = poly_or_evals.NumElements() / chunk_size;
+    size_t num_pieces = 1;
+    if (gap > kMinGapSizeForParallelization && num_chunks < task_nums) {
+      num_pieces = (task_nums + num_chunks - 1) / num_chunks;
+    }
+    size_t piece_size = (gap + num_pieces - 1) / num_pieces;
+    size_t num_units = num_chunks * num_pieces;
+    size_t num_tasks = std::min(num_units, task_nums);
+    base::ParallelFor(num_tasks, [&poly_or_evals, roots, step, chunk_size, gap,
+                                  fn, num_pieces, piece_size, num_units,
+                                  num_tasks](size_t task) {
+      size_t begin = task * num_units / num_tasks;
+      size_t end = (task + 1) * num_units / num_tasks;
+      for (size_t unit = begin; unit < end; ++unit) {
+        size_t i = unit / num_pieces * chunk_size;
+        size_t j_begin = unit % num_pieces * piece_size;
+        size_t j_end = std::min(j_begin + piece_size, gap);
+        for (size_t j = j_begin; j < j_end && j * step < roots.size(); ++j) {
+          fn(*poly_or_evals[i + j], *poly_or_evals[i + j + gap],
+             roots[j * step]);
         }
       }
-    }
+    });
   }
 
   constexpr void InOutHelper(DensePoly& poly, const F& root) const {
@@ -236,11 +267,7 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     size_t step = 1;
     bool first = true;
 
-#if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-#else
-    size_t thread_nums = 1;
-#endif
+    size_t task_nums = base::TaskPool::GetInstance().concurrency();
 
     size_t gap = poly.coefficients_.coefficients_.size() / 2;
     while (gap > 0) {
@@ -254,11 +281,18 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       bool should_compact = num_chunks >= min_num_chunks_for_compaction_;
       if (should_compact) {
         if (!first) {
+          // The roots are compacted into a new buffer, since compacting them
+          // in place in parallel would overwrite the roots that the other
+          // threads are yet to read.
           size_t size = roots.size() / (step * 2);
-          OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
-            roots[i] = roots[i * (step * 2)];
-          }
-          roots.erase(roots.begin() + size, roots.end());
+          std::vector<F> compacted_roots(size);
+          base::ParallelForRange(size, [&compacted_roots, &roots, step](
+                                           size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+              compacted_roots[i] = roots[i * (step * 2)];
+            }
+          });
+          roots = std::move(compacted_roots);
         }
         step = 1;
       } else {
@@ -267,7 +301,7 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       first = false;
 
       ApplyButterfly<FFTOrder::kInOut>(poly, roots, step, chunk_size,
-                                       thread_nums, gap);
+                                       task_nums, gap);
       gap /= 2;
     }
   }
@@ -283,11 +317,7 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
                  roots_cache.size() / min_num_chunks_for_compaction_);
     std::vector<F> compacted_roots(compaction_max_size, F::Zero());
 
-#if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-#else
-    size_t thread_nums = 1;
-#endif
+    size_t task_nums = base::TaskPool::GetInstance().concurrency();
 
     size_t gap = start_gap;
     while (gap < evals.evaluations_.size()) {
@@ -301,15 +331,18 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       bool should_compact = num_chunks >= min_num_chunks_for_compaction_ &&
                             gap < evals.evaluations_.size() / 2;
       if (should_compact) {
-        OPENMP_PARALLEL_FOR(size_t i = 0; i < gap; ++i) {
-          compacted_roots[i] = roots_cache[i * num_chunks];
-        }
+        base::ParallelForRange(gap, [&compacted_roots, &roots_cache,
+                                     num_chunks](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            compacted_roots[i] = roots_cache[i * num_chunks];
+          }
+        });
       }
       ApplyButterfly<FFTOrder::kOutIn>(
           evals,
           should_compact ? absl::Span<const F>(compacted_roots.data(), gap)
                          : roots_cache,
-          /*step=*/should_compact ? 1 : num_chunks, chunk_size, thread_nums,
+          /*step=*/should_compact ? 1 : num_chunks, chunk_size, task_nums,
           gap);
       gap *= 2;
     }
@@ -22,6 +22,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/base/strings/string_util.h"
+#include "tachyon/device/numa_placement.h"
 #include "tachyon/math/polynomials/univariate/support_poly_operators.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_forwards.h"
 
@@ -123,6 +124,12 @@ class UnivariateDenseCoefficients {
   constexpr const std::vector<F>& coefficients() const { return coefficients_; }
   constexpr std::vector<F>& coefficients() { return coefficients_; }
 
+  // Places the pages of |coefficients_| on the NUMA nodes. The placement is
+  // lost once |coefficients_| is reallocated. See |device::PlaceOnNUMANodes()|.
+  bool PlaceOnNUMANodes(device::NUMAPlacement placement) const {
+    return device::PlaceOnNUMANodes<F>(coefficients_, placement);
+  }
+
   constexpr bool operator==(const UnivariateDenseCoefficients& other) const {
     return coefficients_ == other.coefficients_;
   }
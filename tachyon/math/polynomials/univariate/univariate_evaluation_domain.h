@@ -15,6 +15,7 @@
 #include "tachyon/base/logging.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/base/range.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/math/polynomials/evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_forwards.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
@@ -116,6 +117,17 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   // Compute an IFFT.
   [[nodiscard]] constexpr virtual DensePoly IFFT(const Evals& evals) const = 0;
 
+  // Computes the IFFTs of |evals_vec| concurrently on the |TaskPool|. The
+  // butterflies of each IFFT are its nested tasks, so the cores are kept busy
+  // whether there are more of them than the cores or fewer.
+  std::vector<DensePoly> BatchIFFT(const std::vector<Evals>& evals_vec) const {
+    std::vector<DensePoly> polys(evals_vec.size());
+    base::ParallelFor(evals_vec.size(), [this, &evals_vec, &polys](size_t i) {
+      polys[i] = IFFT(evals_vec[i]);
+    });
+    return polys;
+  }
+
   // Computes the first |size| roots of unity for the entire domain.
   // e.g. for the domain [1, g, g², ..., gⁿ⁻¹}] and |size| = n / 2, it computes
   // [1, g, g², ..., g^{(n / 2) - 1}]
@@ -325,22 +337,16 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   template <typename PolyOrEvals>
   constexpr static void DistributePowersAndMulByConst(
       PolyOrEvals& poly_or_evals, const F& g, const F& c) {
-#if defined(TACHYON_HAS_OPENMP)
-    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
-#else
-    size_t thread_nums = 1;
-#endif
-    // Invariant: |pow| = |c|*|g|ⁱ at the i-th iteration of the loop
-    size_t size = poly_or_evals.NumElements();
-    size_t num_elems_per_thread = std::max(size / thread_nums, size_t{1024});
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += num_elems_per_thread) {
-      F pow = c * g.Pow(i);
-      for (size_t j = 0; j < num_elems_per_thread; ++j) {
-        if (i + j >= size) break;
-        (*poly_or_evals[i + j]) *= pow;
-        pow *= g;
-      }
-    }
+    base::ParallelForRange(poly_or_evals.NumElements(),
+                           [&poly_or_evals, &g, &c](size_t begin, size_t end) {
+                             // Invariant: |pow| = |c|*|g|ⁱ at the i-th
+                             // iteration of the loop
+                             F pow = c * g.Pow(begin);
+                             for (size_t i = begin; i < end; ++i) {
+                               (*poly_or_evals[i]) *= pow;
+                               pow *= g;
+                             }
+                           });
   }
 
   // See https://en.wikipedia.org/wiki/Butterfly_diagram
@@ -425,12 +431,18 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   template <typename PolyOrEvals>
   constexpr static void SwapElements(PolyOrEvals& poly_or_evals, size_t size,
                                      uint32_t log_len) {
-    for (size_t idx = 1; idx < size; ++idx) {
-      size_t ridx = base::bits::BitRev(idx) >> (sizeof(size_t) * 8 - log_len);
-      if (idx < ridx) {
-        std::swap(*poly_or_evals[idx], *poly_or_evals[ridx]);
+    // An element is swapped only by the smaller index of its pair, so the
+    // ranges never touch the same pair.
+    base::ParallelForRange(size, [&poly_or_evals, log_len](size_t begin,
+                                                           size_t end) {
+      for (size_t idx = std::max(begin, size_t{1}); idx < end; ++idx) {
+        size_t ridx =
+            base::bits::BitRev(idx) >> (sizeof(size_t) * 8 - log_len);
+        if (idx < ridx) {
+          std::swap(*poly_or_evals[idx], *poly_or_evals[ridx]);
+        }
       }
-    }
+    });
   }
 
   constexpr virtual std::unique_ptr<UnivariateEvaluationDomain> Clone()
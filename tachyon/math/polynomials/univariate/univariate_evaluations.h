@@ -19,6 +19,7 @@
 #include "tachyon/base/json/json.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/strings/string_util.h"
+#include "tachyon/device/numa_placement.h"
 #include "tachyon/math/polynomials/polynomial.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_forwards.h"
 
@@ -90,6 +91,12 @@ class UnivariateEvaluations final
   constexpr const std::vector<F>& evaluations() const { return evaluations_; }
   constexpr std::vector<F>& evaluations() { return evaluations_; }
 
+  // Places the pages of |evaluations_| on the NUMA nodes. The placement is
+  // lost once |evaluations_| is reallocated. See |device::PlaceOnNUMANodes()|.
+  bool PlaceOnNUMANodes(device::NUMAPlacement placement) const {
+    return device::PlaceOnNUMANodes<F>(evaluations_, placement);
+  }
+
   // NOTE(chokobole): Sometimes, this degree doesn't match with the exact
   // degree of the coefficients that is produced by IFFT. I leave it for
   // consistency with another polynomial.
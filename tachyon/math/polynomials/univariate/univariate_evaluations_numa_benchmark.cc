@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/device/numa.h"
+#include "tachyon/device/numa_placement.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using Evals = UnivariateEvaluations<bn254::Fr, (size_t{1} << 24) - 1>;
+
+// The number of the chunks that the evaluations are multiplied in. It is
+// divisible by the usual numbers of the nodes, so that the chunks of a node
+// fall in the part of the buffer that is bound to it.
+constexpr size_t kNumChunks = 256;
+
+void MulChunk(Evals& lhs, const Evals& rhs, size_t chunk) {
+  size_t size = lhs.evaluations().size();
+  size_t begin = size * chunk / kNumChunks;
+  size_t end = size * (chunk + 1) / kNumChunks;
+  for (size_t i = begin; i < end; ++i) {
+    *lhs[i] *= rhs.evaluations()[i];
+  }
+}
+
+}  // namespace
+
+// Multiplies the evaluations on the workers of all the NUMA nodes, with the
+// pages placed by |Placement|. Each chunk is run on the node that holds it.
+// See |base::ParallelForPartitioned()|.
+template <device::NUMAPlacement Placement>
+void BM_MulEvaluationsOnAllNodes(benchmark::State& state) {
+  bn254::Fr::Init();
+  if (!device::NUMAEnabled()) {
+    state.SkipWithError("NUMA is not enabled");
+    return;
+  }
+  Evals lhs = Evals::Random(state.range(0) - 1);
+  Evals rhs = Evals::Random(state.range(0) - 1);
+  if (!lhs.PlaceOnNUMANodes(Placement) || !rhs.PlaceOnNUMANodes(Placement)) {
+    state.SkipWithError("Failed to place the evaluations");
+    return;
+  }
+  state.SetLabel(std::string(device::NUMAPlacementToString(Placement)));
+  for (auto _ : state) {
+    base::ParallelForPartitioned(
+        kNumChunks, [&lhs, &rhs](size_t chunk) { MulChunk(lhs, rhs, chunk); });
+  }
+  benchmark::DoNotOptimize(lhs);
+}
+
+// Same as above, but both the pages and the workers are on the node 0, which
+// is what a process bound to a single socket runs with. The pool has as many
+// workers as the cores of a node. The current thread is left pinned to the
+// node 0, so this is registered last.
+void BM_MulEvaluationsOnSingleNode(benchmark::State& state) {
+  bn254::Fr::Init();
+  if (!device::NUMAEnabled()) {
+    state.SkipWithError("NUMA is not enabled");
+    return;
+  }
+  Evals lhs = Evals::Random(state.range(0) - 1);
+  Evals rhs = Evals::Random(state.range(0) - 1);
+  size_t bytes = lhs.evaluations().size() * sizeof(bn254::Fr);
+  if (!device::NUMABindMem(lhs.evaluations().data(), bytes, 0) ||
+      !device::NUMABindMem(rhs.evaluations().data(), bytes, 0)) {
+    state.SkipWithError("Failed to bind the evaluations");
+    return;
+  }
+  size_t num_cores = std::thread::hardware_concurrency() /
+                     static_cast<size_t>(device::NUMANumNodes());
+  base::TaskPool pool(std::max(num_cores, size_t{1}) - 1, /*node=*/0);
+  device::NUMASetThreadNodeAffinity(0);
+  for (auto _ : state) {
+    base::TaskGroup group(&pool);
+    for (size_t chunk = 0; chunk < kNumChunks; ++chunk) {
+      group.Run([&lhs, &rhs, chunk]() { MulChunk(lhs, rhs, chunk); });
+    }
+    group.Wait();
+  }
+  benchmark::DoNotOptimize(lhs);
+}
+
+BENCHMARK_TEMPLATE(BM_MulEvaluationsOnAllNodes,
+                   device::NUMAPlacement::kFirstTouch)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 24);
+BENCHMARK_TEMPLATE(BM_MulEvaluationsOnAllNodes,
+                   device::NUMAPlacement::kInterleaved)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 24);
+BENCHMARK_TEMPLATE(BM_MulEvaluationsOnAllNodes,
+                   device::NUMAPlacement::kPartitioned)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 24);
+
+BENCHMARK(BM_MulEvaluationsOnSingleNode)
+    ->RangeMultiplier(4)
+    ->Range(1 << 18, 1 << 24);
+
+}  // namespace tachyon::math
@@ -9,7 +9,10 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 
 namespace tachyon::zk {
@@ -48,6 +51,27 @@ class Entity {
   }
   crypto::Transcript<Commitment>* transcript() { return transcript_.get(); }
 
+  // Commits to each of |evals_vec| in the Lagrange basis. If the |PCS|
+  // supports the batch mode, the commitments are normalized together with a
+  // single batch inversion instead of an inversion for each of them.
+  std::vector<Commitment> BatchCommitLagrange(
+      const std::vector<Evals>& evals_vec) {
+    if constexpr (PCS::kSupportsBatchMode) {
+      if (evals_vec.empty()) return {};
+      pcs_.SetBatchMode(evals_vec.size());
+      for (size_t i = 0; i < evals_vec.size(); ++i) {
+        CHECK(pcs_.CommitLagrange(evals_vec[i], i));
+      }
+      return pcs_.GetBatchCommitments();
+    } else {
+      return base::Map(evals_vec, [this](const Evals& evals) {
+        Commitment commitment;
+        CHECK(pcs_.CommitLagrange(evals, &commitment));
+        return commitment;
+      });
+    }
+  }
+
  protected:
   PCS pcs_;
   std::unique_ptr<Domain> domain_;
@@ -0,0 +1,60 @@
+#ifndef TACHYON_ZK_BASE_FRACTION_TILES_H_
+#define TACHYON_ZK_BASE_FRACTION_TILES_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_pool.h"
+
+namespace tachyon::zk {
+
+// The bytes of a tile of |ComputeFractionsInTiles()|. A tile is touched 3
+// times: the denominators are multiplied into it, it is inverted, and the
+// numerators are multiplied into it. It has to stay in the L2 cache in
+// between, while the columns that the callbacks read are streamed past it.
+// 128 KiB is half of the smallest L2 of the recent x86 cores (256 KiB), which
+// leaves the other half for the streamed columns. A tile is a task of
+// |base::ParallelFor()|, so the smaller tiles post more tasks. See
+// fraction_tiles_benchmark.cc for the measurements.
+constexpr size_t kFractionTileBytes = size_t{1} << 17;
+
+// Returns the number of the rows of a tile of |F|, which is 4096 for a 256-bit
+// field.
+template <typename F>
+constexpr size_t GetFractionTileSize() {
+  return std::max(kFractionTileBytes / sizeof(F), size_t{1});
+}
+
+// Sets |values| to [n₀ / d₀, n₁ / d₁, ..., nₖ₋₁ / dₖ₋₁], where nⱼ and dⱼ are
+// the products that |numerator_callback| and |denominator_callback| multiply
+// into the j-th row. The rows are processed in tiles of |tile_size| rows in
+// parallel. A callback is called as |callback(tile, tile_index, tile_size)|,
+// so the rows of a tile start at |tile_index * tile_size|. Both callbacks fold
+// all of their columns into a tile, and the tile is inverted in between, so
+// that a tile stays in the cache until its rows are done.
+//
+// A row whose denominator is zero is set to zero, as Halo2's |batch_invert()|
+// does.
+template <typename F, typename Callable>
+void ComputeFractionsInTiles(absl::Span<F> values,
+                             const Callable& numerator_callback,
+                             const Callable& denominator_callback,
+                             size_t tile_size = GetFractionTileSize<F>()) {
+  size_t num_tiles = (values.size() + tile_size - 1) / tile_size;
+  base::ParallelFor(num_tiles, [values, tile_size, &numerator_callback,
+                                &denominator_callback](size_t i) {
+    absl::Span<F> tile = values.subspan(i * tile_size, tile_size);
+    std::fill(tile.begin(), tile.end(), F::One());
+    denominator_callback(tile, i, tile_size);
+    CHECK(F::BatchInverseInPlaceSerial(tile));
+    numerator_callback(tile, i, tile_size);
+  });
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_BASE_FRACTION_TILES_H_
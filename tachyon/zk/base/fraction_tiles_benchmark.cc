@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/zk/base/fraction_tiles.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+// The columns of a permutation set. A row of the numerator is the product of
+// (vᵢ + β * uᵢ + γ) over the columns, and that of the denominator is the
+// product of (vᵢ + β * pᵢ + γ), where u, p and v are the unpermuted, the
+// permuted and the value columns.
+template <typename F>
+struct PermutationColumns {
+  std::vector<std::vector<F>> unpermuted;
+  std::vector<std::vector<F>> permuted;
+  std::vector<std::vector<F>> values;
+  F beta;
+  F gamma;
+
+  PermutationColumns(size_t n, size_t num_columns) {
+    auto random_columns = [n, num_columns]() {
+      return base::CreateVector(num_columns, [n]() {
+        return base::CreateVector(n, []() { return F::Random(); });
+      });
+    };
+    unpermuted = random_columns();
+    permuted = random_columns();
+    values = random_columns();
+    beta = F::Random();
+    gamma = F::Random();
+  }
+
+  void MultiplyInto(const std::vector<std::vector<F>>& columns,
+                    absl::Span<F> chunk, size_t start) const {
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const F* column = &columns[i][start];
+      const F* value = &values[i][start];
+      for (size_t j = 0; j < chunk.size(); ++j) {
+        chunk[j] *= value[j] + beta * column[j] + gamma;
+      }
+    }
+  }
+};
+
+}  // namespace
+
+// Computes the grand product ratios of |state.range(1)| columns over
+// |state.range(0)| rows in tiles of |state.range(2)| rows.
+template <typename F>
+void BM_ComputeFractionsInTiles(benchmark::State& state) {
+  size_t n = state.range(0);
+  PermutationColumns<F> columns(n, state.range(1));
+  size_t tile_size = state.range(2);
+
+  using Callback = std::function<void(absl::Span<F>, size_t, size_t)>;
+  Callback numerator_callback = [&columns](absl::Span<F> chunk,
+                                           size_t chunk_index,
+                                           size_t chunk_size) {
+    columns.MultiplyInto(columns.unpermuted, chunk, chunk_index * chunk_size);
+  };
+  Callback denominator_callback = [&columns](absl::Span<F> chunk,
+                                             size_t chunk_index,
+                                             size_t chunk_size) {
+    columns.MultiplyInto(columns.permuted, chunk, chunk_index * chunk_size);
+  };
+  std::vector<F> values(n);
+  for (auto _ : state) {
+    ComputeFractionsInTiles(absl::MakeSpan(values), numerator_callback,
+                            denominator_callback, tile_size);
+  }
+  benchmark::DoNotOptimize(values);
+}
+
+// Same as above, but the columns are multiplied into the whole |values| one
+// after another, and |values| is inverted with a single batch inversion.
+template <typename F>
+void BM_ComputeFractionsUntiled(benchmark::State& state) {
+  size_t n = state.range(0);
+  PermutationColumns<F> columns(n, state.range(1));
+
+  std::vector<F> values(n);
+  for (auto _ : state) {
+    std::fill(values.begin(), values.end(), F::One());
+    columns.MultiplyInto(columns.permuted, absl::MakeSpan(values), 0);
+    CHECK(F::BatchInverseInPlace(values));
+    columns.MultiplyInto(columns.unpermuted, absl::MakeSpan(values), 0);
+  }
+  benchmark::DoNotOptimize(values);
+}
+
+BENCHMARK_TEMPLATE(BM_ComputeFractionsInTiles, math::bn254::Fr)
+    ->ArgsProduct({{1 << 20}, {3}, benchmark::CreateRange(1 << 8, 1 << 16, 2)})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ComputeFractionsUntiled, math::bn254::Fr)
+    ->Args({1 << 20, 3})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::zk
+
+// clang-format off
+// Executing tests from //tachyon/zk/base:fraction_tiles_benchmark
+// -----------------------------------------------------------------------------
+// Run on (1 X 2100 MHz CPU )
+// CPU Caches:
+//   L1 Data 48 KiB (x1)
+//   L1 Instruction 32 KiB (x1)
+//   L2 Unified 2048 KiB (x1)
+// -----------------------------------------------------------------------------
+// Benchmark                                                                  Time             CPU   Iterations
+// -----------------------------------------------------------------------------
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/256_median         1292 ms         1259 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/512_median         1384 ms         1344 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/1024_median        1353 ms         1328 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/2048_median        1388 ms         1373 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/4096_median        1451 ms         1418 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/8192_median        1342 ms         1325 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/16384_median       1157 ms         1138 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/32768_median       1190 ms         1168 ms            3
+// BM_ComputeFractionsInTiles<math::bn254::Fr>/1048576/3/65536_median       1187 ms         1160 ms            3
+// BM_ComputeFractionsUntiled<math::bn254::Fr>/1048576/3_median             1322 ms         1310 ms            3
+// clang-format on
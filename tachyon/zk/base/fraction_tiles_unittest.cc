@@ -0,0 +1,85 @@
+#include "tachyon/zk/base/fraction_tiles.h"
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+using F = math::GF7;
+using Callback = std::function<void(absl::Span<F>, size_t, size_t)>;
+
+Callback CreateMultiplyCallback(const std::vector<std::vector<F>>& columns) {
+  return [&columns](absl::Span<F> chunk, size_t chunk_index,
+                    size_t chunk_size) {
+    size_t start = chunk_index * chunk_size;
+    for (const std::vector<F>& column : columns) {
+      for (size_t i = 0; i < chunk.size(); ++i) {
+        chunk[i] *= column[start + i];
+      }
+    }
+  };
+}
+
+}  // namespace
+
+TEST(FractionTilesTest, GetFractionTileSize) {
+  EXPECT_EQ(GetFractionTileSize<uint64_t>(), size_t{16384});
+  EXPECT_EQ((GetFractionTileSize<std::array<uint64_t, 4>>()), size_t{4096});
+}
+
+TEST(FractionTilesTest, ComputeFractionsInTiles) {
+  constexpr size_t kRows = 10;
+  constexpr size_t kColumns = 2;
+
+  auto random_columns = [](bool nonzero) {
+    return base::CreateVector(kColumns, [nonzero]() {
+      return base::CreateVector(kRows, [nonzero]() {
+        F f = F::Random();
+        while (nonzero && f.IsZero()) f = F::Random();
+        return f;
+      });
+    });
+  };
+  std::vector<std::vector<F>> numerators = random_columns(false);
+  std::vector<std::vector<F>> denominators = random_columns(true);
+
+  std::vector<F> expected = base::CreateVector(kRows, [&](size_t i) {
+    F numerator = F::One();
+    F denominator = F::One();
+    for (size_t j = 0; j < kColumns; ++j) {
+      numerator *= numerators[j][i];
+      denominator *= denominators[j][i];
+    }
+    return numerator / denominator;
+  });
+
+  // The last tile is shorter than the others.
+  for (size_t tile_size : {size_t{1}, size_t{3}, kRows, kRows + 1}) {
+    std::vector<F> values(kRows);
+    ComputeFractionsInTiles(absl::MakeSpan(values),
+                            CreateMultiplyCallback(numerators),
+                            CreateMultiplyCallback(denominators), tile_size);
+    EXPECT_EQ(values, expected);
+  }
+}
+
+TEST(FractionTilesTest, ZeroDenominator) {
+  std::vector<std::vector<F>> numerators = {{F(3), F(3), F(3)}};
+  std::vector<std::vector<F>> denominators = {{F(2), F::Zero(), F(4)}};
+
+  std::vector<F> values(3);
+  ComputeFractionsInTiles(absl::MakeSpan(values),
+                          CreateMultiplyCallback(numerators),
+                          CreateMultiplyCallback(denominators));
+  EXPECT_EQ(values, std::vector<F>({F(3) / F(2), F::Zero(), F(3) / F(4)}));
+}
+
+}  // namespace tachyon::zk
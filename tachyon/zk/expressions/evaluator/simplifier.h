@@ -0,0 +1,149 @@
+#ifndef TACHYON_ZK_EXPRESSIONS_EVALUATOR_SIMPLIFIER_H_
+#define TACHYON_ZK_EXPRESSIONS_EVALUATOR_SIMPLIFIER_H_
+
+#include <memory>
+#include <utility>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/expressions/evaluator.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+
+namespace tachyon::zk {
+
+// Rewrites an expression into an equivalent one that costs fewer field
+// operations to evaluate. It
+//  - folds constant subexpressions: 2 * 3 -> 6, -(3) -> -3,
+//  - removes identities: x + 0 -> x, x * 1 -> x, x * 0 -> 0,
+//  - moves constant factors outward and merges them:
+//    (2 * x) * (3 * y) -> 6 * (x * y), -(2 * x) -> -2 * x,
+//  - factors out a common factor: q * a + q * b -> q * (a + b).
+// The degree of the result never exceeds the degree of the input.
+template <typename F>
+class Simplifier : public Evaluator<F, std::unique_ptr<Expression<F>>> {
+ public:
+  using Expr = Expression<F>;
+
+  // Evaluator methods
+  std::unique_ptr<Expr> Evaluate(const Expr* input) override {
+    switch (input->type()) {
+      case ExpressionType::kConstant:
+      case ExpressionType::kSelector:
+      case ExpressionType::kFixed:
+      case ExpressionType::kAdvice:
+      case ExpressionType::kInstance:
+      case ExpressionType::kChallenge:
+        return input->Clone();
+      case ExpressionType::kNegated:
+        return Scale(Evaluate(input->ToNegated()->expr()), -F::One());
+      case ExpressionType::kSum: {
+        const SumExpression<F>* sum = input->ToSum();
+        return Add(Evaluate(sum->left()), Evaluate(sum->right()));
+      }
+      case ExpressionType::kProduct: {
+        const ProductExpression<F>* product = input->ToProduct();
+        return Multiply(Evaluate(product->left()), Evaluate(product->right()));
+      }
+      case ExpressionType::kScaled: {
+        const ScaledExpression<F>* scaled = input->ToScaled();
+        return Scale(Evaluate(scaled->expr()), scaled->scale());
+      }
+    }
+    NOTREACHED();
+    return nullptr;
+  }
+
+ private:
+  // Splits |expr| into c * e, where c is a constant.
+  static F SplitScale(const Expr* expr, const Expr** rest) {
+    switch (expr->type()) {
+      case ExpressionType::kConstant:
+        *rest = nullptr;
+        return expr->ToConstant()->value();
+      case ExpressionType::kNegated:
+        *rest = expr->ToNegated()->expr();
+        return -F::One();
+      case ExpressionType::kScaled:
+        *rest = expr->ToScaled()->expr();
+        return expr->ToScaled()->scale();
+      default:
+        *rest = expr;
+        return F::One();
+    }
+  }
+
+  // Returns c * |expr|. |expr| must be simplified.
+  static std::unique_ptr<Expr> Scale(std::unique_ptr<Expr> expr, F scale) {
+    const Expr* rest;
+    scale *= SplitScale(expr.get(), &rest);
+    if (rest == nullptr || scale.IsZero()) {
+      return ExpressionFactory<F>::Constant(scale);
+    }
+    if (scale.IsOne()) return rest->Clone();
+    if ((-scale).IsOne()) return ExpressionFactory<F>::Negated(rest->Clone());
+    return ExpressionFactory<F>::Scaled(rest->Clone(), scale);
+  }
+
+  // Returns |left| + |right|. Both must be simplified.
+  static std::unique_ptr<Expr> Add(std::unique_ptr<Expr> left,
+                                   std::unique_ptr<Expr> right) {
+    bool left_is_constant = left->type() == ExpressionType::kConstant;
+    bool right_is_constant = right->type() == ExpressionType::kConstant;
+    if (left_is_constant && right_is_constant) {
+      return ExpressionFactory<F>::Constant(left->ToConstant()->value() +
+                                            right->ToConstant()->value());
+    }
+    if (left_is_constant && left->ToConstant()->value().IsZero()) {
+      return right;
+    }
+    if (right_is_constant && right->ToConstant()->value().IsZero()) {
+      return left;
+    }
+    if (std::unique_ptr<Expr> factored = FactorOut(left.get(), right.get())) {
+      return factored;
+    }
+    return ExpressionFactory<F>::Sum(std::move(left), std::move(right));
+  }
+
+  // Returns q * (a + b) if |left| is q * a and |right| is q * b. Otherwise,
+  // returns nullptr.
+  static std::unique_ptr<Expr> FactorOut(const Expr* left, const Expr* right) {
+    if (left->type() != ExpressionType::kProduct ||
+        right->type() != ExpressionType::kProduct) {
+      return nullptr;
+    }
+    const ProductExpression<F>* l = left->ToProduct();
+    const ProductExpression<F>* r = right->ToProduct();
+    const Expr* l_operands[] = {l->left(), l->right()};
+    const Expr* r_operands[] = {r->left(), r->right()};
+    for (size_t i = 0; i < 2; ++i) {
+      for (size_t j = 0; j < 2; ++j) {
+        if (*l_operands[i] != *r_operands[j]) continue;
+        return Multiply(l_operands[i]->Clone(),
+                        Add(l_operands[1 - i]->Clone(),
+                            r_operands[1 - j]->Clone()));
+      }
+    }
+    return nullptr;
+  }
+
+  // Returns |left| * |right|. Both must be simplified.
+  static std::unique_ptr<Expr> Multiply(std::unique_ptr<Expr> left,
+                                        std::unique_ptr<Expr> right) {
+    const Expr* left_rest;
+    const Expr* right_rest;
+    F scale = SplitScale(left.get(), &left_rest) *
+              SplitScale(right.get(), &right_rest);
+    if (left_rest == nullptr && right_rest == nullptr) {
+      return ExpressionFactory<F>::Constant(scale);
+    }
+    if (left_rest == nullptr) return Scale(right_rest->Clone(), scale);
+    if (right_rest == nullptr) return Scale(left_rest->Clone(), scale);
+    return Scale(
+        ExpressionFactory<F>::Product(left_rest->Clone(), right_rest->Clone()),
+        scale);
+  }
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_EXPRESSIONS_EVALUATOR_SIMPLIFIER_H_
@@ -0,0 +1,92 @@
+#include "tachyon/zk/expressions/evaluator/simplifier.h"
+
+#include <memory>
+
+#include "tachyon/zk/expressions/evaluator/test/evaluator_test.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+using Expr = std::unique_ptr<Expression<GF7>>;
+
+class SimplifierTest : public EvaluatorTest {
+ public:
+  Expr Simplify(const Expr& expr) {
+    Simplifier<GF7> simplifier;
+    return expr->Evaluate(&simplifier);
+  }
+
+  static Expr Constant(int value) {
+    return ExpressionFactory<GF7>::Constant(GF7(value));
+  }
+  static Expr Fixed(size_t column_index) {
+    return ExpressionFactory<GF7>::Fixed(FixedQuery(
+        column_index, Rotation::Cur(), FixedColumnKey(column_index)));
+  }
+  static Expr Advice(size_t column_index) {
+    return ExpressionFactory<GF7>::Advice(AdviceQuery(
+        column_index, Rotation::Cur(), AdviceColumnKey(column_index)));
+  }
+};
+
+}  // namespace
+
+TEST_F(SimplifierTest, FoldConstants) {
+  Expr expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(Constant(2), Constant(3)),
+      ExpressionFactory<GF7>::Negated(Constant(4)));
+  EXPECT_EQ(*Simplify(expr), *Constant(2));
+
+  expr = ExpressionFactory<GF7>::Scaled(Constant(3), GF7(5));
+  EXPECT_EQ(*Simplify(expr), *Constant(1));
+}
+
+TEST_F(SimplifierTest, RemoveIdentities) {
+  Expr expr = ExpressionFactory<GF7>::Sum(Advice(0), Constant(0));
+  EXPECT_EQ(*Simplify(expr), *Advice(0));
+
+  expr = ExpressionFactory<GF7>::Product(Constant(1), Advice(0));
+  EXPECT_EQ(*Simplify(expr), *Advice(0));
+
+  expr = ExpressionFactory<GF7>::Product(Advice(0), Constant(0));
+  EXPECT_EQ(*Simplify(expr), *Constant(0));
+
+  expr = ExpressionFactory<GF7>::Negated(
+      ExpressionFactory<GF7>::Negated(Advice(0)));
+  EXPECT_EQ(*Simplify(expr), *Advice(0));
+
+  expr = ExpressionFactory<GF7>::Scaled(Advice(0), GF7(6));
+  EXPECT_EQ(*Simplify(expr), *ExpressionFactory<GF7>::Negated(Advice(0)));
+}
+
+TEST_F(SimplifierTest, MergeScales) {
+  // (2 * a₀) * (2 * a₁) -> 4 * (a₀ * a₁)
+  Expr expr = ExpressionFactory<GF7>::Product(
+      ExpressionFactory<GF7>::Scaled(Advice(0), GF7(2)),
+      ExpressionFactory<GF7>::Scaled(Advice(1), GF7(2)));
+  EXPECT_EQ(*Simplify(expr),
+            *ExpressionFactory<GF7>::Scaled(
+                ExpressionFactory<GF7>::Product(Advice(0), Advice(1)), GF7(4)));
+
+  // -(2 * a₀) -> 5 * a₀
+  expr = ExpressionFactory<GF7>::Negated(
+      ExpressionFactory<GF7>::Scaled(Advice(0), GF7(2)));
+  EXPECT_EQ(*Simplify(expr),
+            *ExpressionFactory<GF7>::Scaled(Advice(0), GF7(5)));
+}
+
+TEST_F(SimplifierTest, FactorOut) {
+  // q * a₀ + a₁ * q -> q * (a₀ + a₁)
+  Expr expr = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(Fixed(0), Advice(0)),
+      ExpressionFactory<GF7>::Product(Advice(1), Fixed(0)));
+  Expr simplified = Simplify(expr);
+  EXPECT_EQ(*simplified,
+            *ExpressionFactory<GF7>::Product(
+                Fixed(0), ExpressionFactory<GF7>::Sum(Advice(0), Advice(1))));
+  EXPECT_LT(simplified->Complexity(), expr->Complexity());
+  EXPECT_EQ(simplified->Degree(), expr->Degree());
+}
+
+}  // namespace tachyon::zk
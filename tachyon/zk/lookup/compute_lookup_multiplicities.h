@@ -0,0 +1,107 @@
+#ifndef TACHYON_ZK_LOOKUP_COMPUTE_LOOKUP_MULTIPLICITIES_H_
+#define TACHYON_ZK_LOOKUP_COMPUTE_LOOKUP_MULTIPLICITIES_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/zk/lookup/lookup_pair.h"
+
+namespace tachyon::zk {
+
+// Given a vector of input values A and a vector of table values S, this
+// method computes the multiplicities m such that m(ωⁱ) is the number of the
+// usable rows of A whose value is S(ωⁱ). If a value appears more than once in
+// S, all of its count goes to the first row that has it, and the other rows
+// get 0. This method returns m without blinding it if all the input values
+// are found in the table.
+//
+// Example
+//
+// Assume that
+//  * in.input.evaluations() = [1,2,1,5]
+//  * in.table.evaluations() = [1,2,4,5]
+//
+// Then m = [2,1,0,1].
+template <typename Evals, typename F = typename Evals::Field>
+[[nodiscard]] bool ComputeLookupMultiplicities(size_t usable_rows,
+                                               const LookupPair<Evals>& in,
+                                               Evals* out) {
+  // The values are compared by their Montgomery forms, which are unique for
+  // each value. |F::operator==()| would convert both of them out of the
+  // Montgomery form on every probe.
+  struct MontgomeryEq {
+    bool operator()(const F& a, const F& b) const {
+      return a.value() == b.value();
+    }
+  };
+
+  const std::vector<F>& input_evals = in.input().evaluations();
+  const std::vector<F>& table_evals = in.table().evaluations();
+
+  // The row of the first appearance of each table value.
+  absl::flat_hash_map<F, size_t, absl::Hash<F>, MontgomeryEq> table_rows;
+  table_rows.reserve(usable_rows);
+  for (size_t row = 0; row < usable_rows; ++row) {
+    table_rows.try_emplace(table_evals[row], row);
+  }
+
+  // The map is only read from here on, so that the input values are looked
+  // up concurrently.
+  constexpr size_t kNotFound = std::numeric_limits<size_t>::max();
+  std::vector<size_t> input_table_rows(usable_rows);
+  std::atomic<bool> all_found = true;
+  base::ParallelForRange(usable_rows, [&table_rows, &input_evals,
+                                       &input_table_rows, &all_found](
+                                          size_t begin, size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      auto it = table_rows.find(input_evals[row]);
+      if (it == table_rows.end()) {
+        input_table_rows[row] = kNotFound;
+        all_found.store(false, std::memory_order_relaxed);
+      } else {
+        input_table_rows[row] = it->second;
+      }
+    }
+  });
+  if (!all_found.load(std::memory_order_relaxed)) {
+    for (size_t row = 0; row < usable_rows; ++row) {
+      if (input_table_rows[row] == kNotFound) {
+        LOG(ERROR) << "input(" << input_evals[row].ToString()
+                   << ") is not found in table";
+        break;
+      }
+    }
+    return false;
+  }
+
+  std::vector<uint64_t> counts(usable_rows, 0);
+  for (size_t table_row : input_table_rows) {
+    ++counts[table_row];
+  }
+
+  std::vector<F> multiplicities =
+      base::CreateVector(table_evals.size(), F::Zero());
+  base::ParallelForRange(usable_rows, [&multiplicities, &counts](size_t begin,
+                                                                size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      multiplicities[row] = F(counts[row]);
+    }
+  });
+  *out = Evals(std::move(multiplicities));
+  return true;
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_COMPUTE_LOOKUP_MULTIPLICITIES_H_
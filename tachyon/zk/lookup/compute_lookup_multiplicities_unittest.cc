@@ -0,0 +1,77 @@
+#include "tachyon/zk/lookup/compute_lookup_multiplicities.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/zk/plonk/halo2/prover_test.h"
+
+namespace tachyon::zk {
+
+class ComputeLookupMultiplicitiesTest : public halo2::ProverTest {};
+
+TEST_F(ComputeLookupMultiplicitiesTest, ComputeLookupMultiplicities) {
+  prover_->blinder().set_blinding_factors(5);
+  size_t n = prover_->pcs().N();
+  size_t usable_rows = prover_->GetUsableRows();
+
+  std::vector<F> table_evals =
+      base::CreateVector(n, []() { return F::Random(); });
+  // The repeated table value is counted only in its first row.
+  table_evals[1] = table_evals[0];
+
+  std::vector<F> input_evals = base::CreateVector(n, [usable_rows,
+                                                      &table_evals]() {
+    return table_evals[base::Uniform(base::Range<size_t>::Until(usable_rows))];
+  });
+
+  std::vector<F> expected = base::CreateVector(n, F::Zero());
+  for (size_t i = 0; i < usable_rows; ++i) {
+    for (size_t j = 0; j < usable_rows; ++j) {
+      if (input_evals[i] == table_evals[j]) {
+        expected[j] += F::One();
+        break;
+      }
+    }
+  }
+
+  LookupPair<Evals> input(Evals(std::move(input_evals)),
+                          Evals(std::move(table_evals)));
+  Evals multiplicities;
+  ASSERT_TRUE(ComputeLookupMultiplicities(usable_rows, input, &multiplicities));
+  EXPECT_EQ(multiplicities.evaluations(), expected);
+}
+
+TEST_F(ComputeLookupMultiplicitiesTest, ComputeLookupMultiplicitiesExample) {
+  std::vector<F> input_evals = {F(1), F(2), F(1), F(5)};
+  std::vector<F> table_evals = {F(1), F(2), F(4), F(5)};
+
+  LookupPair<Evals> input(Evals(std::move(input_evals)),
+                          Evals(std::move(table_evals)));
+  Evals multiplicities;
+  ASSERT_TRUE(ComputeLookupMultiplicities(4, input, &multiplicities));
+
+  std::vector<F> expected = {F(2), F(1), F(0), F(1)};
+  EXPECT_EQ(multiplicities.evaluations(), expected);
+}
+
+TEST_F(ComputeLookupMultiplicitiesTest, ComputeLookupMultiplicitiesWrong) {
+  // set input_evals not included within table_evals;
+  size_t n = prover_->pcs().N();
+  std::vector<F> input_evals =
+      base::CreateVector(n, [](size_t i) { return F(i * 2); });
+
+  std::vector<F> table_evals =
+      base::CreateVector(n, [](size_t i) { return F(i * 3); });
+
+  LookupPair<Evals> input = {Evals(std::move(input_evals)),
+                             Evals(std::move(table_evals))};
+  Evals multiplicities;
+  ASSERT_FALSE(ComputeLookupMultiplicities(prover_->GetUsableRows(), input,
+                                           &multiplicities));
+}
+
+}  // namespace tachyon::zk
@@ -0,0 +1,66 @@
+#ifndef TACHYON_ZK_LOOKUP_GRAND_SUM_ARGUMENT_H_
+#define TACHYON_ZK_LOOKUP_GRAND_SUM_ARGUMENT_H_
+
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "gtest/gtest_prod.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/zk/base/blinded_polynomial.h"
+#include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/base/fraction_tiles.h"
+
+namespace tachyon::zk {
+
+// The additive counterpart of |GrandProductArgument|. It commits a running
+// sum φ(X) of fractions instead of a running product. See log derivative
+// lookup argument for use case.
+class GrandSumArgument {
+ public:
+  template <typename PCS, typename Callable, typename Poly = typename PCS::Poly>
+  static BlindedPolynomial<Poly> Commit(ProverBase<PCS>* prover,
+                                        const Callable& numerator_callback,
+                                        const Callable& denominator_callback) {
+    using Evals = typename PCS::Evals;
+
+    size_t size = prover->pcs().N();
+    size_t blinding_factors = prover->blinder().blinding_factors();
+    Evals phi = CreatePolynomial<Evals>(
+        size, blinding_factors, numerator_callback, denominator_callback);
+    CHECK(prover->blinder().Blind(phi));
+    return prover->CommitAndWriteToProofWithBlind(phi);
+  }
+
+ private:
+  FRIEND_TEST(GrandSumArgumentTest, CreatePolynomial);
+
+  // Returns φ, where φ(ω⁰) = 0 and φ(ωⁱ⁺¹) = φ(ωⁱ) + nᵢ / dᵢ over the usable
+  // rows. nⱼ and dⱼ are what |numerator_callback| and |denominator_callback|
+  // multiply into the j-th row. See |ComputeFractionsInTiles()|.
+  template <typename Evals, typename Callable>
+  static Evals CreatePolynomial(size_t size, size_t blinding_factors,
+                                const Callable& numerator_callback,
+                                const Callable& denominator_callback) {
+    using F = typename Evals::Field;
+
+    std::vector<F> fractions;
+    fractions.resize(size);
+    ComputeFractionsInTiles(absl::MakeSpan(fractions), numerator_callback,
+                            denominator_callback);
+
+    // The additions are much cheaper than the inversions above, so that the
+    // running sum is accumulated serially.
+    size_t usable_rows = size - blinding_factors;
+    std::vector<F> phi = base::CreateVector(size, F::Zero());
+    for (size_t i = 1; i < usable_rows; ++i) {
+      phi[i] = phi[i - 1] + fractions[i - 1];
+    }
+    return Evals(std::move(phi));
+  }
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_GRAND_SUM_ARGUMENT_H_
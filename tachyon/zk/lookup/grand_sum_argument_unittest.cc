@@ -0,0 +1,70 @@
+#include "tachyon/zk/lookup/grand_sum_argument.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/zk/lookup/compute_lookup_multiplicities.h"
+#include "tachyon/zk/plonk/halo2/prover_test.h"
+
+namespace tachyon::zk {
+
+class GrandSumArgumentTest : public halo2::ProverTest {};
+
+TEST_F(GrandSumArgumentTest, CreatePolynomial) {
+  prover_->blinder().set_blinding_factors(5);
+  size_t n = prover_->pcs().N();
+  size_t blinding_factors = prover_->blinder().blinding_factors();
+  size_t usable_rows = prover_->GetUsableRows();
+
+  std::vector<F> table_evals =
+      base::CreateVector(n, []() { return F::Random(); });
+  std::vector<F> input_evals = base::CreateVector(n, [usable_rows,
+                                                      &table_evals]() {
+    return table_evals[base::Uniform(base::Range<size_t>::Until(usable_rows))];
+  });
+  LookupPair<Evals> pair(Evals(std::move(input_evals)),
+                         Evals(std::move(table_evals)));
+  Evals multiplicities;
+  ASSERT_TRUE(ComputeLookupMultiplicities(usable_rows, pair, &multiplicities));
+
+  F beta = F::Random();
+  const std::vector<F>& inputs = pair.input().evaluations();
+  const std::vector<F>& tables = pair.table().evaluations();
+  const std::vector<F>& counts = multiplicities.evaluations();
+  auto numerator_callback = [&](absl::Span<F> chunk, size_t chunk_index,
+                                size_t chunk_size) {
+    size_t start = chunk_index * chunk_size;
+    for (size_t j = 0; j < chunk.size(); ++j) {
+      size_t i = start + j;
+      chunk[j] *= (tables[i] + beta) - counts[i] * (inputs[i] + beta);
+    }
+  };
+  auto denominator_callback = [&](absl::Span<F> chunk, size_t chunk_index,
+                                  size_t chunk_size) {
+    size_t start = chunk_index * chunk_size;
+    for (size_t j = 0; j < chunk.size(); ++j) {
+      size_t i = start + j;
+      chunk[j] *= (inputs[i] + beta) * (tables[i] + beta);
+    }
+  };
+  base::ParallelizeCallback3<F> numerator = numerator_callback;
+  base::ParallelizeCallback3<F> denominator = denominator_callback;
+  Evals phi = GrandSumArgument::CreatePolynomial<Evals>(
+      n, blinding_factors, numerator, denominator);
+
+  // φ(ωⁱ⁺¹) = φ(ωⁱ) + 1 / (A(ωⁱ) + β) - m(ωⁱ) / (S(ωⁱ) + β)
+  EXPECT_EQ(*phi[0], F::Zero());
+  for (size_t i = 0; i < usable_rows; ++i) {
+    F expected = *phi[i] + (inputs[i] + beta).Inverse() -
+                 counts[i] * (tables[i] + beta).Inverse();
+    EXPECT_EQ(*phi[i + 1], expected);
+  }
+  // The sum goes back to 0 at the last row, since A(X) is a subset of S(X).
+  EXPECT_EQ(*phi[usable_rows], F::Zero());
+}
+
+}  // namespace tachyon::zk
@@ -0,0 +1,69 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_H_
+
+#include <vector>
+
+#include "tachyon/base/parallelize.h"
+#include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/base/prover_query.h"
+#include "tachyon/zk/expressions/evaluator/simple_evaluator.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_committed.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_evaluated.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_prepared.h"
+#include "tachyon/zk/lookup/lookup_argument.h"
+
+namespace tachyon::zk {
+
+// Runs the prover side of the log derivative lookup argument. For each
+// lookup, it commits the multiplicities m(X) of the compressed table values
+// S(X) in the compressed input values A(X), and then the running sum φ(X),
+// where φ(ω⁰) = 0 and
+//
+//   φ(ωⁱ⁺¹) = φ(ωⁱ) + 1 / (A(ωⁱ) + β) - m(ωⁱ) / (S(ωⁱ) + β).
+//
+// φ(X) goes back to 0 at the last usable row if and only if A(X) is a subset
+// of S(X).
+template <typename Poly, typename Evals>
+class LogDerivativeLookupArgumentRunner {
+ public:
+  LogDerivativeLookupArgumentRunner() = delete;
+
+  // The expressions of the |arguments| are compressed and their
+  // multiplicities are computed concurrently. The multiplicities are blinded
+  // and committed in the order of the |arguments|.
+  template <typename PCS, typename F>
+  static std::vector<LogDerivativeLookupPrepared<Poly, Evals>>
+  PrepareArguments(ProverBase<PCS>* prover,
+                   const std::vector<LookupArgument<F>>& arguments,
+                   const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl);
+
+  template <typename PCS, typename F>
+  static LogDerivativeLookupCommitted<Poly> CommitPrepared(
+      ProverBase<PCS>* prover,
+      LogDerivativeLookupPrepared<Poly, Evals>&& prepared, const F& beta);
+
+  template <typename PCS, typename F>
+  static LogDerivativeLookupEvaluated<Poly> EvaluateCommitted(
+      ProverBase<PCS>* prover, LogDerivativeLookupCommitted<Poly>&& committed,
+      const F& x);
+
+  template <typename PCS, typename F>
+  static std::vector<ProverQuery<PCS>> OpenEvaluated(
+      const ProverBase<PCS>* prover,
+      const LogDerivativeLookupEvaluated<Poly>& evaluated, const F& x);
+
+ private:
+  template <typename F>
+  static base::ParallelizeCallback3<F> CreateNumeratorCallback(
+      const LogDerivativeLookupPrepared<Poly, Evals>& prepared, const F& beta);
+
+  template <typename F>
+  static base::ParallelizeCallback3<F> CreateDenominatorCallback(
+      const LogDerivativeLookupPrepared<Poly, Evals>& prepared, const F& beta);
+};
+
+}  // namespace tachyon::zk
+
+#include "tachyon/zk/lookup/log_derivative_lookup_argument_runner_impl.h"
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_H_
@@ -0,0 +1,152 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_IMPL_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_IMPL_H_
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/zk/lookup/compress_expression.h"
+#include "tachyon/zk/lookup/compute_lookup_multiplicities.h"
+#include "tachyon/zk/lookup/grand_sum_argument.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_argument_runner.h"
+#include "tachyon/zk/plonk/circuit/rotation.h"
+
+namespace tachyon::zk {
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+std::vector<LogDerivativeLookupPrepared<Poly, Evals>>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::PrepareArguments(
+    ProverBase<PCS>* prover, const std::vector<LookupArgument<F>>& arguments,
+    const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl) {
+  size_t usable_rows = prover->GetUsableRows();
+  std::vector<LookupPair<Evals>> compressed_evals_pairs(arguments.size());
+  std::vector<Evals> multiplicities_vec(arguments.size());
+  base::ParallelFor(arguments.size(), [prover, &arguments, &theta,
+                                       &evaluator_tpl, usable_rows,
+                                       &compressed_evals_pairs,
+                                       &multiplicities_vec](size_t i) {
+    // A_compressed(X) = θᵐ⁻¹A₀(X) + θᵐ⁻²A₁(X) + ... + θAₘ₋₂(X) + Aₘ₋₁(X)
+    Evals compressed_input_expression =
+        CompressExpressions(prover->domain(), arguments[i].input_expressions(),
+                            theta, evaluator_tpl);
+    // S_compressed(X) = θᵐ⁻¹S₀(X) + θᵐ⁻²S₁(X) + ... + θSₘ₋₂(X) + Sₘ₋₁(X)
+    Evals compressed_table_expression =
+        CompressExpressions(prover->domain(), arguments[i].table_expressions(),
+                            theta, evaluator_tpl);
+    compressed_evals_pairs[i] = {std::move(compressed_input_expression),
+                                 std::move(compressed_table_expression)};
+
+    // m(X)
+    CHECK(ComputeLookupMultiplicities(usable_rows, compressed_evals_pairs[i],
+                                      &multiplicities_vec[i]));
+  });
+
+  // The blinding and the commitments draw from the blinder and write to the
+  // proof, so they are done in the order of the |arguments|.
+  std::vector<LogDerivativeLookupPrepared<Poly, Evals>> ret;
+  ret.reserve(arguments.size());
+  for (size_t i = 0; i < arguments.size(); ++i) {
+    Evals& multiplicities = multiplicities_vec[i];
+    CHECK(prover->blinder().Blind(multiplicities));
+
+    // Commit(m(X))
+    BlindedPolynomial<Poly> multiplicities_poly =
+        prover->CommitAndWriteToProofWithBlind(multiplicities);
+
+    ret.emplace_back(std::move(compressed_evals_pairs[i]),
+                     std::move(multiplicities), std::move(multiplicities_poly));
+  }
+  return ret;
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+LogDerivativeLookupCommitted<Poly>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::CommitPrepared(
+    ProverBase<PCS>* prover,
+    LogDerivativeLookupPrepared<Poly, Evals>&& prepared, const F& beta) {
+  BlindedPolynomial<Poly> grand_sum_poly = GrandSumArgument::Commit(
+      prover, CreateNumeratorCallback<F>(prepared, beta),
+      CreateDenominatorCallback<F>(prepared, beta));
+
+  return LogDerivativeLookupCommitted<Poly>(
+      std::move(prepared).TakeMultiplicitiesPoly(), std::move(grand_sum_poly));
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+LogDerivativeLookupEvaluated<Poly>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::EvaluateCommitted(
+    ProverBase<PCS>* prover, LogDerivativeLookupCommitted<Poly>&& committed,
+    const F& x) {
+  F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
+
+  BlindedPolynomial<Poly> grand_sum_poly =
+      std::move(committed).TakeGrandSumPoly();
+  BlindedPolynomial<Poly> multiplicities_poly =
+      std::move(committed).TakeMultiplicitiesPoly();
+
+  prover->EvaluateAndWriteToProof(grand_sum_poly.poly(), x);
+  prover->EvaluateAndWriteToProof(grand_sum_poly.poly(), x_next);
+  prover->EvaluateAndWriteToProof(multiplicities_poly.poly(), x);
+
+  return {std::move(multiplicities_poly), std::move(grand_sum_poly)};
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+std::vector<ProverQuery<PCS>>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::OpenEvaluated(
+    const ProverBase<PCS>* prover,
+    const LogDerivativeLookupEvaluated<Poly>& evaluated, const F& x) {
+  F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
+
+  return {ProverQuery<PCS>(x, evaluated.grand_sum_poly().ToRef()),
+          ProverQuery<PCS>(x, evaluated.multiplicities_poly().ToRef()),
+          ProverQuery<PCS>(std::move(x_next),
+                           evaluated.grand_sum_poly().ToRef())};
+}
+
+template <typename Poly, typename Evals>
+template <typename F>
+base::ParallelizeCallback3<F>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::CreateNumeratorCallback(
+    const LogDerivativeLookupPrepared<Poly, Evals>& prepared, const F& beta) {
+  // (S_compressed(ωʲ) + β) - m(ωʲ) * (A_compressed(ωʲ) + β)
+  return [&prepared, &beta](absl::Span<F> chunk, size_t chunk_index,
+                            size_t chunk_size) {
+    size_t start = chunk_index * chunk_size;
+    const LookupPair<Evals>& compressed = prepared.compressed_evals_pair();
+    const F* input_values = &compressed.input().evaluations()[start];
+    const F* table_values = &compressed.table().evaluations()[start];
+    const F* multiplicities = &prepared.multiplicities().evaluations()[start];
+    for (size_t j = 0; j < chunk.size(); ++j) {
+      chunk[j] *= (table_values[j] + beta) -
+                  multiplicities[j] * (input_values[j] + beta);
+    }
+  };
+}
+
+template <typename Poly, typename Evals>
+template <typename F>
+base::ParallelizeCallback3<F>
+LogDerivativeLookupArgumentRunner<Poly, Evals>::CreateDenominatorCallback(
+    const LogDerivativeLookupPrepared<Poly, Evals>& prepared, const F& beta) {
+  // (A_compressed(ωʲ) + β) * (S_compressed(ωʲ) + β)
+  return [&prepared, &beta](absl::Span<F> chunk, size_t chunk_index,
+                            size_t chunk_size) {
+    size_t start = chunk_index * chunk_size;
+    const LookupPair<Evals>& compressed = prepared.compressed_evals_pair();
+    const F* input_values = &compressed.input().evaluations()[start];
+    const F* table_values = &compressed.table().evaluations()[start];
+    for (size_t j = 0; j < chunk.size(); ++j) {
+      chunk[j] *= (input_values[j] + beta) * (table_values[j] + beta);
+    }
+  };
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_ARGUMENT_RUNNER_IMPL_H_
@@ -0,0 +1,200 @@
+#include "tachyon/zk/lookup/log_derivative_lookup_argument_runner.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_verification.h"
+#include "tachyon/zk/lookup/test/compress_expression_test_setting.h"
+#include "tachyon/zk/plonk/circuit/rotation.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+class LogDerivativeLookupArgumentRunnerTest
+    : public CompressExpressionTestSetting {
+ public:
+  using Runner = LogDerivativeLookupArgumentRunner<Poly, Evals>;
+
+  void SetUp() override {
+    CompressExpressionTestSetting::SetUp();
+    prover_->blinder().set_blinding_factors(5);
+
+    // The table is a pair of the fixed columns, and each row of the input,
+    // which is a pair of the advice columns, is one of the usable rows of the
+    // table.
+    size_t n = prover_->pcs().N();
+    size_t usable_rows = prover_->GetUsableRows();
+    fixed_columns_ = base::CreateVector(2, [n]() {
+      return Evals(base::CreateVector(n, []() { return F::Random(); }));
+    });
+    std::vector<size_t> table_rows = base::CreateVector(n, [usable_rows]() {
+      return base::Uniform(base::Range<size_t>::Until(usable_rows));
+    });
+    advice_columns_ =
+        base::Map(fixed_columns_, [&table_rows](const Evals& column) {
+          return Evals(base::Map(
+              table_rows, [&column](size_t row) { return *column[row]; }));
+        });
+
+    RefTable<Evals> columns(absl::MakeConstSpan(fixed_columns_),
+                            absl::MakeConstSpan(advice_columns_),
+                            absl::MakeConstSpan(instance_columns_));
+    evaluator_ = {0, static_cast<int32_t>(n), 1, columns,
+                  absl::MakeConstSpan(challenges_)};
+
+    LookupPairs<std::unique_ptr<Expression<F>>> pairs;
+    for (size_t i = 0; i < 2; ++i) {
+      pairs.emplace_back(
+          ExpressionFactory<F>::Advice(
+              AdviceQuery(i, Rotation::Cur(), AdviceColumnKey(i))),
+          ExpressionFactory<F>::Fixed(
+              FixedQuery(i, Rotation::Cur(), FixedColumnKey(i))));
+    }
+    arguments_.emplace_back("lookup", std::move(pairs));
+  }
+
+ protected:
+  // Returns the log derivative lookup expressions that the verifier evaluates
+  // at ωⁱ with the evaluations of the |multiplicities_poly| and the
+  // |grand_sum_poly|.
+  std::vector<F> CreateVerificationExpressions(const Poly& multiplicities_poly,
+                                               const Poly& grand_sum_poly,
+                                               const F& beta,
+                                               size_t i) const {
+    size_t usable_rows = prover_->GetUsableRows();
+    F x = prover_->domain()->GetElement(i);
+    F x_next = prover_->domain()->GetElement(i + 1);
+    std::vector<F> fixed_evals = base::Map(
+        fixed_columns_, [i](const Evals& column) { return *column[i]; });
+    std::vector<F> advice_evals = base::Map(
+        advice_columns_, [i](const Evals& column) { return *column[i]; });
+    F multiplicities_eval = multiplicities_poly.Evaluate(x);
+    F grand_sum_eval = grand_sum_poly.Evaluate(x);
+    F grand_sum_next_eval = grand_sum_poly.Evaluate(x_next);
+    F l_first = i == 0 ? F::One() : F::Zero();
+    F l_last = i == usable_rows ? F::One() : F::Zero();
+    F l_blind = i > usable_rows ? F::One() : F::Zero();
+
+    LogDerivativeLookupVerificationData<F, Commitment> data;
+    data.fixed_evals = absl::MakeConstSpan(fixed_evals);
+    data.advice_evals = absl::MakeConstSpan(advice_evals);
+    data.multiplicities_eval = &multiplicities_eval;
+    data.grand_sum_eval = &grand_sum_eval;
+    data.grand_sum_next_eval = &grand_sum_next_eval;
+    data.theta = &theta_;
+    data.beta = &beta;
+    data.x = &x;
+    data.x_next = &x_next;
+    data.l_first = &l_first;
+    data.l_blind = &l_blind;
+    data.l_last = &l_last;
+    return CreateLogDerivativeLookupVerificationExpressions(data,
+                                                           arguments_[0]);
+  }
+
+  std::vector<LookupArgument<F>> arguments_;
+};
+
+}  // namespace
+
+TEST_F(LogDerivativeLookupArgumentRunnerTest, PrepareArguments) {
+  std::vector<LogDerivativeLookupPrepared<Poly, Evals>> prepared =
+      Runner::PrepareArguments(prover_.get(), arguments_, theta_, evaluator_);
+  ASSERT_EQ(prepared.size(), size_t{1});
+
+  // A_compressed(ωⁱ) = θA₀(ωⁱ) + A₁(ωⁱ)
+  // S_compressed(ωⁱ) = θS₀(ωⁱ) + S₁(ωⁱ)
+  const LookupPair<Evals>& compressed = prepared[0].compressed_evals_pair();
+  size_t usable_rows = prover_->GetUsableRows();
+  std::vector<F> counts(prover_->pcs().N(), F::Zero());
+  for (size_t i = 0; i < usable_rows; ++i) {
+    EXPECT_EQ(*compressed.input()[i],
+              theta_ * *advice_columns_[0][i] + *advice_columns_[1][i]);
+    EXPECT_EQ(*compressed.table()[i],
+              theta_ * *fixed_columns_[0][i] + *fixed_columns_[1][i]);
+    for (size_t j = 0; j < usable_rows; ++j) {
+      if (*compressed.table()[j] == *compressed.input()[i]) {
+        counts[j] += F::One();
+        break;
+      }
+    }
+  }
+  // The blinding rows of m(X) are random, so only the usable rows are
+  // compared.
+  for (size_t i = 0; i < usable_rows; ++i) {
+    EXPECT_EQ(*prepared[0].multiplicities()[i], counts[i]);
+  }
+}
+
+TEST_F(LogDerivativeLookupArgumentRunnerTest, ProveAndVerify) {
+  F beta = F::Random();
+  F x = F::Random();
+
+  std::vector<LogDerivativeLookupPrepared<Poly, Evals>> prepared =
+      Runner::PrepareArguments(prover_.get(), arguments_, theta_, evaluator_);
+  LogDerivativeLookupCommitted<Poly> committed =
+      Runner::CommitPrepared(prover_.get(), std::move(prepared[0]), beta);
+  Poly multiplicities_poly = committed.multiplicities_poly().poly();
+  Poly grand_sum_poly = committed.grand_sum_poly().poly();
+  Commitment multiplicities_commitment = prover_->Commit(multiplicities_poly);
+  Commitment grand_sum_commitment = prover_->Commit(grand_sum_poly);
+  LogDerivativeLookupEvaluated<Poly> evaluated =
+      Runner::EvaluateCommitted(prover_.get(), std::move(committed), x);
+  std::vector<ProverQuery<PCS>> queries =
+      Runner::OpenEvaluated(prover_.get(), evaluated, x);
+  EXPECT_EQ(queries.size(), GetSizeOfLogDerivativeLookupVerifierQueries());
+
+  // The verifier reads the commitments and the evaluations in the order that
+  // the prover wrote them.
+  F x_next = Rotation::Next().RotateOmega(prover_->domain(), x);
+  base::Uint8VectorBuffer& write_buf = prover_->GetWriter()->buffer();
+  base::Buffer read_buf(write_buf.buffer(), write_buf.buffer_len());
+  std::unique_ptr<halo2::Verifier<PCS>> verifier =
+      CreateVerifier(std::move(read_buf));
+  crypto::TranscriptReader<Commitment>* reader = verifier->GetReader();
+  Commitment commitment;
+  ASSERT_TRUE(reader->ReadFromProof(&commitment));
+  EXPECT_EQ(commitment, multiplicities_commitment);
+  ASSERT_TRUE(reader->ReadFromProof(&commitment));
+  EXPECT_EQ(commitment, grand_sum_commitment);
+  F eval;
+  ASSERT_TRUE(reader->ReadFromProof(&eval));
+  EXPECT_EQ(eval, grand_sum_poly.Evaluate(x));
+  ASSERT_TRUE(reader->ReadFromProof(&eval));
+  EXPECT_EQ(eval, grand_sum_poly.Evaluate(x_next));
+  ASSERT_TRUE(reader->ReadFromProof(&eval));
+  EXPECT_EQ(eval, multiplicities_poly.Evaluate(x));
+
+  // Every expression that the verifier checks vanishes on the domain, which
+  // is what the quotient polynomial proves.
+  size_t n = prover_->pcs().N();
+  for (size_t i = 0; i < n; ++i) {
+    std::vector<F> expressions = CreateVerificationExpressions(
+        multiplicities_poly, grand_sum_poly, beta, i);
+    ASSERT_EQ(expressions.size(),
+              GetSizeOfLogDerivativeLookupVerificationExpressions());
+    for (const F& expression : expressions) {
+      EXPECT_TRUE(expression.IsZero());
+    }
+  }
+
+  // With another β, the running sum doesn't satisfy the verifier.
+  F wrong_beta = beta + F::One();
+  bool all_zero = true;
+  for (size_t i = 0; i < n; ++i) {
+    for (const F& expression : CreateVerificationExpressions(
+             multiplicities_poly, grand_sum_poly, wrong_beta, i)) {
+      all_zero &= expression.IsZero();
+    }
+  }
+  EXPECT_FALSE(all_zero);
+}
+
+}  // namespace tachyon::zk
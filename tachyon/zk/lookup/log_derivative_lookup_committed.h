@@ -0,0 +1,41 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_COMMITTED_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_COMMITTED_H_
+
+#include <utility>
+
+#include "tachyon/zk/base/blinded_polynomial.h"
+
+namespace tachyon::zk {
+
+template <typename Poly>
+class LogDerivativeLookupCommitted {
+ public:
+  using F = typename Poly::Field;
+
+  LogDerivativeLookupCommitted(BlindedPolynomial<Poly>&& multiplicities_poly,
+                               BlindedPolynomial<Poly>&& grand_sum_poly)
+      : multiplicities_poly_(std::move(multiplicities_poly)),
+        grand_sum_poly_(std::move(grand_sum_poly)) {}
+
+  const BlindedPolynomial<Poly>& multiplicities_poly() const {
+    return multiplicities_poly_;
+  }
+  const BlindedPolynomial<Poly>& grand_sum_poly() const {
+    return grand_sum_poly_;
+  }
+
+  BlindedPolynomial<Poly>&& TakeMultiplicitiesPoly() && {
+    return std::move(multiplicities_poly_);
+  }
+  BlindedPolynomial<Poly>&& TakeGrandSumPoly() && {
+    return std::move(grand_sum_poly_);
+  }
+
+ private:
+  BlindedPolynomial<Poly> multiplicities_poly_;
+  BlindedPolynomial<Poly> grand_sum_poly_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_COMMITTED_H_
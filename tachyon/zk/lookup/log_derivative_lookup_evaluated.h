@@ -0,0 +1,34 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_EVALUATED_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_EVALUATED_H_
+
+#include <utility>
+
+#include "tachyon/zk/base/blinded_polynomial.h"
+
+namespace tachyon::zk {
+
+template <typename Poly>
+class LogDerivativeLookupEvaluated {
+ public:
+  using F = typename Poly::Field;
+
+  LogDerivativeLookupEvaluated(BlindedPolynomial<Poly>&& multiplicities_poly,
+                               BlindedPolynomial<Poly>&& grand_sum_poly)
+      : multiplicities_poly_(std::move(multiplicities_poly)),
+        grand_sum_poly_(std::move(grand_sum_poly)) {}
+
+  const BlindedPolynomial<Poly>& multiplicities_poly() const {
+    return multiplicities_poly_;
+  }
+  const BlindedPolynomial<Poly>& grand_sum_poly() const {
+    return grand_sum_poly_;
+  }
+
+ private:
+  BlindedPolynomial<Poly> multiplicities_poly_;
+  BlindedPolynomial<Poly> grand_sum_poly_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_EVALUATED_H_
@@ -0,0 +1,39 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_PREPARED_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_PREPARED_H_
+
+#include <utility>
+
+#include "tachyon/zk/base/blinded_polynomial.h"
+#include "tachyon/zk/lookup/lookup_pair.h"
+
+namespace tachyon::zk {
+
+template <typename Poly, typename Evals>
+class LogDerivativeLookupPrepared {
+ public:
+  using F = typename Poly::Field;
+
+  LogDerivativeLookupPrepared(LookupPair<Evals>&& compressed_evals_pair,
+                              Evals&& multiplicities,
+                              BlindedPolynomial<Poly>&& multiplicities_poly)
+      : compressed_evals_pair_(std::move(compressed_evals_pair)),
+        multiplicities_(std::move(multiplicities)),
+        multiplicities_poly_(std::move(multiplicities_poly)) {}
+
+  const LookupPair<Evals>& compressed_evals_pair() const {
+    return compressed_evals_pair_;
+  }
+  const Evals& multiplicities() const { return multiplicities_; }
+  BlindedPolynomial<Poly>&& TakeMultiplicitiesPoly() && {
+    return std::move(multiplicities_poly_);
+  }
+
+ private:
+  LookupPair<Evals> compressed_evals_pair_;
+  Evals multiplicities_;
+  BlindedPolynomial<Poly> multiplicities_poly_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_PREPARED_H_
@@ -0,0 +1,81 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_H_
+
+#include <vector>
+
+#include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_verification_data.h"
+#include "tachyon/zk/lookup/lookup_argument.h"
+#include "tachyon/zk/lookup/lookup_verification.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_verification_evaluator.h"
+
+namespace tachyon::zk {
+
+template <typename F, typename C>
+F CreateGrandSumExpression(
+    const LogDerivativeLookupVerificationData<F, C>& data,
+    const LookupArgument<F>& argument) {
+  VanishingVerificationEvaluator<F> evaluator(data);
+  // (φ(ω * X) - φ(X)) * (A(X) + β) * (S(X) + β)
+  // - (S(X) + β) + m(X) * (A(X) + β), where
+  //  - A(X) = θᵐ⁻¹a₀(X) + ... + aₘ₋₁(X)
+  //  - S(X) = θᵐ⁻¹s₀(X) + ... + sₘ₋₁(X)
+  F input = CompressExpressions(argument.input_expressions(), *data.theta,
+                                evaluator) +
+            *data.beta;
+  F table = CompressExpressions(argument.table_expressions(), *data.theta,
+                                evaluator) +
+            *data.beta;
+  return (*data.grand_sum_next_eval - *data.grand_sum_eval) * input * table -
+         table + *data.multiplicities_eval * input;
+}
+
+constexpr size_t GetSizeOfLogDerivativeLookupVerificationExpressions() {
+  return 3;
+}
+
+template <typename F, typename C>
+std::vector<F> CreateLogDerivativeLookupVerificationExpressions(
+    const LogDerivativeLookupVerificationData<F, C>& data,
+    const LookupArgument<F>& argument) {
+  F active_rows = F::One() - (*data.l_last + *data.l_blind);
+  std::vector<F> ret;
+  ret.reserve(GetSizeOfLogDerivativeLookupVerificationExpressions());
+  // l_first(X) * φ(X) = 0
+  ret.push_back(*data.l_first * *data.grand_sum_eval);
+  // l_last(X) * φ(X) = 0
+  ret.push_back(*data.l_last * *data.grand_sum_eval);
+  // (1 - (l_last(X) + l_blind(X))) * (
+  //  (φ(ω * X) - φ(X)) * (A(X) + β) * (S(X) + β) -
+  //  (S(X) + β) + m(X) * (A(X) + β)
+  // ) = 0
+  ret.push_back(active_rows * CreateGrandSumExpression(data, argument));
+  return ret;
+}
+
+constexpr size_t GetSizeOfLogDerivativeLookupVerifierQueries() { return 3; }
+
+template <typename PCS, typename F, typename C,
+          typename Poly = typename PCS::Poly>
+std::vector<crypto::PolynomialOpening<Poly, C>>
+CreateLogDerivativeLookupQueries(
+    const LogDerivativeLookupVerificationData<F, C>& data) {
+  std::vector<crypto::PolynomialOpening<Poly, C>> queries;
+  queries.reserve(GetSizeOfLogDerivativeLookupVerifierQueries());
+  // Open lookup grand sum commitment at x.
+  queries.emplace_back(base::DeepRef<const C>(data.grand_sum_commitment),
+                       base::DeepRef<const F>(data.x), *data.grand_sum_eval);
+  // Open lookup multiplicities commitment at x.
+  queries.emplace_back(base::DeepRef<const C>(data.multiplicities_commitment),
+                       base::DeepRef<const F>(data.x),
+                       *data.multiplicities_eval);
+  // Open lookup grand sum commitment at ω * x.
+  queries.emplace_back(base::DeepRef<const C>(data.grand_sum_commitment),
+                       base::DeepRef<const F>(data.x_next),
+                       *data.grand_sum_next_eval);
+  return queries;
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_H_
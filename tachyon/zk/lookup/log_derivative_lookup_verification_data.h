@@ -0,0 +1,27 @@
+#ifndef TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_DATA_H_
+#define TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_DATA_H_
+
+#include "tachyon/zk/plonk/vanishing/vanishing_verification_data.h"
+
+namespace tachyon::zk {
+
+template <typename F, typename C>
+struct LogDerivativeLookupVerificationData
+    : public VanishingVerificationData<F> {
+  const C* multiplicities_commitment = nullptr;
+  const C* grand_sum_commitment = nullptr;
+  const F* multiplicities_eval = nullptr;
+  const F* grand_sum_eval = nullptr;
+  const F* grand_sum_next_eval = nullptr;
+  const F* theta = nullptr;
+  const F* beta = nullptr;
+  const F* x = nullptr;
+  const F* x_next = nullptr;
+  const F* l_first = nullptr;
+  const F* l_blind = nullptr;
+  const F* l_last = nullptr;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOG_DERIVATIVE_LOOKUP_VERIFICATION_DATA_H_
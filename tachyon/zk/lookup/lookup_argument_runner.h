@@ -31,6 +31,13 @@ class LookupArgumentRunner {
       ProverBase<PCS>* prover, const LookupArgument<F>& argument,
       const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl);
 
+  // Same as calling |PermuteArgument()| for each of the |arguments|, but the
+  // expressions of the |arguments| are compressed and permuted concurrently.
+  template <typename PCS, typename F>
+  static std::vector<LookupPermuted<Poly, Evals>> PermuteArguments(
+      ProverBase<PCS>* prover, const std::vector<LookupArgument<F>>& arguments,
+      const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl);
+
   template <typename PCS, typename F>
   static LookupCommitted<Poly> CommitPermuted(
       ProverBase<PCS>* prover, LookupPermuted<Poly, Evals>&& permuted,
@@ -48,6 +55,16 @@ class LookupArgumentRunner {
  private:
   FRIEND_TEST(LookupArgumentRunnerTest, ComputePermutationProduct);
 
+  template <typename Domain, typename F>
+  static LookupPair<Evals> CompressArgument(
+      const Domain* domain, const LookupArgument<F>& argument, const F& theta,
+      const SimpleEvaluator<Evals>& evaluator_tpl);
+
+  template <typename PCS>
+  static LookupPermuted<Poly, Evals> BlindAndCommitPermuted(
+      ProverBase<PCS>* prover, LookupPair<Evals>&& compressed_evals_pair,
+      LookupPair<Evals>&& permuted_evals_pair);
+
   template <typename F>
   static base::ParallelizeCallback3<F> CreateNumeratorCallback(
       const LookupPermuted<Poly, Evals>& permuted, const F& beta,
@@ -10,8 +10,11 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/zk/lookup/compress_expression.h"
 #include "tachyon/zk/lookup/lookup_argument_runner.h"
+#include "tachyon/zk/lookup/permute_expression_pair.h"
 #include "tachyon/zk/plonk/circuit/rotation.h"
 #include "tachyon/zk/plonk/permutation/grand_product_argument.h"
 
@@ -22,35 +25,89 @@ template <typename PCS, typename F>
 LookupPermuted<Poly, Evals> LookupArgumentRunner<Poly, Evals>::PermuteArgument(
     ProverBase<PCS>* prover, const LookupArgument<F>& argument, const F& theta,
     const SimpleEvaluator<Evals>& evaluator_tpl) {
+  LookupPair<Evals> compressed_evals_pair =
+      CompressArgument(prover->domain(), argument, theta, evaluator_tpl);
+
+  // A'(X), S'(X)
+  LookupPair<Evals> permuted_evals_pair;
+  CHECK(PermuteExpressionPair(prover->GetUsableRows(), compressed_evals_pair,
+                              &permuted_evals_pair));
+
+  return BlindAndCommitPermuted(prover, std::move(compressed_evals_pair),
+                                std::move(permuted_evals_pair));
+}
+
+template <typename Poly, typename Evals>
+template <typename PCS, typename F>
+std::vector<LookupPermuted<Poly, Evals>>
+LookupArgumentRunner<Poly, Evals>::PermuteArguments(
+    ProverBase<PCS>* prover, const std::vector<LookupArgument<F>>& arguments,
+    const F& theta, const SimpleEvaluator<Evals>& evaluator_tpl) {
+  size_t usable_rows = prover->GetUsableRows();
+  std::vector<LookupPair<Evals>> compressed_evals_pairs(arguments.size());
+  std::vector<LookupPair<Evals>> permuted_evals_pairs(arguments.size());
+  base::ParallelFor(arguments.size(), [prover, &arguments, &theta,
+                                       &evaluator_tpl, usable_rows,
+                                       &compressed_evals_pairs,
+                                       &permuted_evals_pairs](size_t i) {
+    compressed_evals_pairs[i] =
+        CompressArgument(prover->domain(), arguments[i], theta, evaluator_tpl);
+    CHECK(PermuteExpressionPair(usable_rows, compressed_evals_pairs[i],
+                                &permuted_evals_pairs[i]));
+  });
+
+  // The blinding and the commitments draw from the blinder and write to the
+  // proof, so they are done in the order of the |arguments|.
+  std::vector<LookupPermuted<Poly, Evals>> ret;
+  ret.reserve(arguments.size());
+  for (size_t i = 0; i < arguments.size(); ++i) {
+    ret.push_back(BlindAndCommitPermuted(prover,
+                                         std::move(compressed_evals_pairs[i]),
+                                         std::move(permuted_evals_pairs[i])));
+  }
+  return ret;
+}
+
+template <typename Poly, typename Evals>
+template <typename Domain, typename F>
+LookupPair<Evals> LookupArgumentRunner<Poly, Evals>::CompressArgument(
+    const Domain* domain, const LookupArgument<F>& argument, const F& theta,
+    const SimpleEvaluator<Evals>& evaluator_tpl) {
   // A_compressed(X) = θᵐ⁻¹A₀(X) + θᵐ⁻²A₁(X) + ... + θAₘ₋₂(X) + Aₘ₋₁(X)
   Evals compressed_input_expression = CompressExpressions(
-      prover->domain(), argument.input_expressions(), theta, evaluator_tpl);
+      domain, argument.input_expressions(), theta, evaluator_tpl);
 
   // S_compressed(X) = θᵐ⁻¹S₀(X) + θᵐ⁻²S₁(X) + ... + θSₘ₋₂(X) + Sₘ₋₁(X)
-  Evals compressed_table_expression =
-      CompressExpressions(prover->domain(), argument.table_expressions(), theta,
-                          evaluator_tpl, &compressed_table_expression);
+  Evals compressed_table_expression = CompressExpressions(
+      domain, argument.table_expressions(), theta, evaluator_tpl);
 
-  // Permute compressed (InputExpression, TableExpression) pair.
-  LookupPair<Evals> compressed_evals_pair(
-      std::move(compressed_input_expression),
-      std::move(compressed_table_expression));
+  return {std::move(compressed_input_expression),
+          std::move(compressed_table_expression)};
+}
 
-  // A'(X), S'(X)
-  LookupPair<Evals> permuted_evals_pair;
-  CHECK(PermuteExpressionPair(prover, compressed_evals_pair,
-                              &permuted_evals_pair));
+template <typename Poly, typename Evals>
+template <typename PCS>
+LookupPermuted<Poly, Evals>
+LookupArgumentRunner<Poly, Evals>::BlindAndCommitPermuted(
+    ProverBase<PCS>* prover, LookupPair<Evals>&& compressed_evals_pair,
+    LookupPair<Evals>&& permuted_evals_pair) {
+  Evals permuted_input = std::move(permuted_evals_pair).TakeInput();
+  Evals permuted_table = std::move(permuted_evals_pair).TakeTable();
+  prover->blinder().Blind(permuted_input);
+  prover->blinder().Blind(permuted_table);
 
   // Commit(A'(X))
   BlindedPolynomial<Poly> permuted_input_poly =
-      prover->CommitAndWriteToProofWithBlind(permuted_evals_pair.input());
+      prover->CommitAndWriteToProofWithBlind(permuted_input);
 
   // Commit(S'(X))
   BlindedPolynomial<Poly> permuted_table_poly =
-      prover->CommitAndWriteToProofWithBlind(permuted_evals_pair.table());
+      prover->CommitAndWriteToProofWithBlind(permuted_table);
 
-  return {std::move(compressed_evals_pair), std::move(permuted_evals_pair),
-          std::move(permuted_input_poly), std::move(permuted_table_poly)};
+  return {std::move(compressed_evals_pair),
+          {std::move(permuted_input), std::move(permuted_table)},
+          std::move(permuted_input_poly),
+          std::move(permuted_table_poly)};
 }
 
 template <typename Poly, typename Evals>
@@ -0,0 +1,22 @@
+#ifndef TACHYON_ZK_LOOKUP_LOOKUP_TYPE_H_
+#define TACHYON_ZK_LOOKUP_LOOKUP_TYPE_H_
+
+namespace tachyon::zk {
+
+// |kHalo2| is the lookup argument of the Halo2 book, which permutes the
+// compressed input and table expressions and commits both of the permuted
+// columns and a grand product.
+// See https://zcash.github.io/halo2/design/proving-system/lookup.html
+//
+// |kLogDerivativeHalo2| is the logarithmic derivative lookup argument, which
+// commits the multiplicities of the table values and a running sum instead.
+// It doesn't sort anything and commits one column less per lookup.
+// See https://eprint.iacr.org/2022/1530
+enum class LookupType {
+  kHalo2,
+  kLogDerivativeHalo2,
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_LOOKUP_LOOKUP_TYPE_H_
@@ -0,0 +1,30 @@
+#ifndef TACHYON_ZK_LOOKUP_LOOKUP_TYPE_STRINGIFIER_H_
+#define TACHYON_ZK_LOOKUP_LOOKUP_TYPE_STRINGIFIER_H_
+
+#include <ostream>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/strings/rust_stringifier.h"
+#include "tachyon/zk/lookup/lookup_type.h"
+
+namespace tachyon::base::internal {
+
+template <>
+class RustDebugStringifier<zk::LookupType> {
+ public:
+  static std::ostream& AppendToStream(std::ostream& os, RustFormatter& fmt,
+                                      zk::LookupType type) {
+    switch (type) {
+      case zk::LookupType::kHalo2:
+        return os << "Halo2";
+      case zk::LookupType::kLogDerivativeHalo2:
+        return os << "LogDerivativeHalo2";
+    }
+    NOTREACHED();
+    return os;
+  }
+};
+
+}  // namespace tachyon::base::internal
+
+#endif  // TACHYON_ZK_LOOKUP_LOOKUP_TYPE_STRINGIFIER_H_
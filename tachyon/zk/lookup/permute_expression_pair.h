@@ -7,13 +7,15 @@
 #ifndef TACHYON_ZK_LOOKUP_PERMUTE_EXPRESSION_PAIR_H_
 #define TACHYON_ZK_LOOKUP_PERMUTE_EXPRESSION_PAIR_H_
 
-#include <algorithm>
 #include <utility>
 #include <vector>
 
-#include "absl/container/btree_map.h"
+#include "absl/types/span.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/math/base/radix_sort.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/lookup/lookup_pair.h"
 
@@ -24,40 +26,45 @@ namespace tachyon::zk {
 // - like values in A' are vertically adjacent to each other; and
 // - the first row in a sequence of like values in A' is the row
 //   that has the corresponding value in S'.
-// This method returns (A', S') if no errors are encountered.
-template <typename PCS, typename Evals, typename F = typename Evals::Field>
-[[nodiscard]] bool PermuteExpressionPair(ProverBase<PCS>* prover,
+// This method returns (A', S') without blinding them if no errors are
+// encountered. It doesn't touch the prover, so that the pairs of several
+// lookups can be permuted concurrently.
+template <typename Evals, typename F = typename Evals::Field>
+[[nodiscard]] bool PermuteExpressionPair(size_t usable_rows,
                                          const LookupPair<Evals>& in,
                                          LookupPair<Evals>* out) {
-  size_t domain_size = prover->domain()->size();
-  size_t usable_rows = prover->GetUsableRows();
-
-  std::vector<F> permuted_input_expressions = in.input().evaluations();
-
-  // sort input lookup expression values
-  std::sort(permuted_input_expressions.begin(),
-            permuted_input_expressions.begin() + usable_rows);
-
-  // a map of each unique element in the table expression and its count
-  absl::btree_map<F, uint32_t> leftover_table_map;
-
-  for (size_t i = 0; i < usable_rows; ++i) {
-    const F& coeff = *in.table()[i];
-    // if key doesn't exist, insert the key and value 1 for the key.
-    auto it = leftover_table_map.try_emplace(coeff, uint32_t{1});
-    // no inserted value, meaning the key exists.
-    if (!it.second) {
-      // Increase value by 1 if not inserted.
-      ++((*it.first).second);
+  using BigInt = typename F::BigIntTy;
+
+  // The values are sorted by their canonical representations, which is the
+  // order of |F::operator<()|. Comparing the fields directly would convert
+  // both of them out of the Montgomery form on every comparison.
+  const std::vector<F>& input_evals = in.input().evaluations();
+  const std::vector<F>& table_evals = in.table().evaluations();
+  std::vector<BigInt> input_values(usable_rows);
+  std::vector<BigInt> table_values(usable_rows);
+  base::ParallelForRange(usable_rows, [&input_evals, &table_evals,
+                                       &input_values, &table_values](
+                                          size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      input_values[i] = input_evals[i].ToBigInt();
+      table_values[i] = table_evals[i].ToBigInt();
     }
-  }
-
-  std::vector<F> permuted_table_expressions =
-      base::CreateVector(domain_size, F::Zero());
+  });
 
+  // sort input lookup expression values
+  math::RadixSortInPlace(absl::MakeSpan(input_values));
+  // The sorted table values replace a map of each unique element in the table
+  // expression and its count.
+  math::RadixSortInPlace(absl::MakeSpan(table_values));
+
+  // |table_indices[row]| is the index of |table_values| that is assigned to
+  // S'(ωʳᵒʷ).
+  std::vector<size_t> table_indices(usable_rows);
+  std::vector<size_t> leftover_table_indices;
   std::vector<size_t> repeated_input_rows;
+  size_t table_idx = 0;
   for (size_t row = 0; row < usable_rows; ++row) {
-    const F& input_value = permuted_input_expressions[row];
+    const BigInt& input_value = input_values[row];
 
     // ref: https://zcash.github.io/halo2/design/proving-system/lookup.html
     //
@@ -69,8 +76,8 @@ template <typename PCS, typename Evals, typename F = typename Evals::Field>
     // - What 'row == 0' condition means: l_first(x) == 1.
     // To satisfy constraint 1, A'(x) - S'(x) must be 0.
     // => checking if A'(x) == S'(x)
-    // - What 'input_value != permuted_input_expressions[row-1]' condition
-    //   means: (A'(x) - A'(ω⁻¹x)) != 0.
+    // - What 'input_value != input_values[row-1]' condition means:
+    //   (A'(x) - A'(ω⁻¹x)) != 0.
     // To satisfy constraint 2, A'(x) - S'(x) must be 0.
     // => checking if A'(x) == S'(x)
     //
@@ -94,45 +101,67 @@ template <typename PCS, typename Evals, typename F = typename Evals::Field>
     //               --------                --------
     // we can see that elements of A' {1,2,5} is in S' {1,4,2,5}
     //
-    if (row == 0 || input_value != permuted_input_expressions[row - 1]) {
-      // Assign S'(x) with A'(x).
-      permuted_table_expressions[row] = input_value;
-
-      // remove one instance of input_value from |leftover_table_map|.
-      auto it = leftover_table_map.find(input_value);
+    if (row == 0 || input_value != input_values[row - 1]) {
+      // The table values smaller than |input_value| are left over.
+      while (table_idx < usable_rows && table_values[table_idx] < input_value) {
+        leftover_table_indices.push_back(table_idx++);
+      }
       // if input value is not found, return error
-      if (it == leftover_table_map.end()) {
+      if (table_idx == usable_rows || table_values[table_idx] != input_value) {
         LOG(ERROR) << "input(" << input_value.ToString()
                    << ") is not found in table";
         return false;
       }
-
-      // input value found, check if the value > 0.
-      // then decrement the value by 1
-      CHECK_GT(it->second--, size_t{0});
+      // Assign S'(x) with A'(x), which removes one instance of |input_value|
+      // from the table.
+      table_indices[row] = table_idx++;
     } else {
       repeated_input_rows.push_back(row);
     }
   }
+  for (; table_idx < usable_rows; ++table_idx) {
+    leftover_table_indices.push_back(table_idx);
+  }
 
   // populate permuted table at unfilled rows with leftover table elements
-  for (auto it = leftover_table_map.begin(); it != leftover_table_map.end();
-       ++it) {
-    const F& coeff = it->first;
-    const uint32_t count = it->second;
-
-    for (uint32_t i = 0; i < count; ++i) {
-      CHECK(!repeated_input_rows.empty());
-      size_t row = repeated_input_rows.back();
-      permuted_table_expressions[row] = coeff;
-      repeated_input_rows.pop_back();
-    }
+  CHECK_EQ(leftover_table_indices.size(), repeated_input_rows.size());
+  for (size_t leftover_table_idx : leftover_table_indices) {
+    table_indices[repeated_input_rows.back()] = leftover_table_idx;
+    repeated_input_rows.pop_back();
   }
 
-  CHECK(repeated_input_rows.empty());
+  std::vector<F> permuted_input_expressions = input_evals;
+  std::vector<F> permuted_table_expressions =
+      base::CreateVector(table_evals.size(), F::Zero());
+  base::ParallelForRange(usable_rows, [&permuted_input_expressions,
+                                       &permuted_table_expressions,
+                                       &input_values, &table_values,
+                                       &table_indices](size_t begin,
+                                                       size_t end) {
+    for (size_t row = begin; row < end; ++row) {
+      permuted_input_expressions[row] = F::FromBigInt(input_values[row]);
+      permuted_table_expressions[row] =
+          F::FromBigInt(table_values[table_indices[row]]);
+    }
+  });
+
+  *out = {Evals(std::move(permuted_input_expressions)),
+          Evals(std::move(permuted_table_expressions))};
+  return true;
+}
+
+// Same as above, but blinds (A', S') with the |prover|.
+template <typename PCS, typename Evals, typename F = typename Evals::Field>
+[[nodiscard]] bool PermuteExpressionPair(ProverBase<PCS>* prover,
+                                         const LookupPair<Evals>& in,
+                                         LookupPair<Evals>* out) {
+  LookupPair<Evals> permuted;
+  if (!PermuteExpressionPair(prover->GetUsableRows(), in, &permuted)) {
+    return false;
+  }
 
-  Evals input(std::move(permuted_input_expressions));
-  Evals table(std::move(permuted_table_expressions));
+  Evals input = std::move(permuted).TakeInput();
+  Evals table = std::move(permuted).TakeTable();
 
   prover->blinder().Blind(input);
   prover->blinder().Blind(table);
@@ -52,6 +52,21 @@ TEST_F(PermuteExpressionPairTest, PermuteExpressionPairTest) {
   }
 }
 
+TEST_F(PermuteExpressionPairTest, PermuteExpressionPairWithoutBlinding) {
+  std::vector<F> input_evals = {F(1), F(2), F(1), F(5)};
+  std::vector<F> table_evals = {F(1), F(2), F(4), F(5)};
+
+  LookupPair<Evals> input(Evals(std::move(input_evals)),
+                          Evals(std::move(table_evals)));
+  LookupPair<Evals> output;
+  ASSERT_TRUE(PermuteExpressionPair(4, input, &output));
+
+  std::vector<F> expected_input_evals = {F(1), F(1), F(2), F(5)};
+  std::vector<F> expected_table_evals = {F(1), F(4), F(2), F(5)};
+  EXPECT_EQ(output.input().evaluations(), expected_input_evals);
+  EXPECT_EQ(output.table().evaluations(), expected_table_evals);
+}
+
 TEST_F(PermuteExpressionPairTest, PermuteExpressionPairTestWrong) {
   // set input_evals not included within table_evals;
   size_t n = prover_->pcs().N();
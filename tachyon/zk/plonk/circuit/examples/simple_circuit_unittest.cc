@@ -1,7 +1,15 @@
 #include "tachyon/zk/plonk/circuit/examples/simple_circuit.h"
 
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
 #include "tachyon/zk/plonk/circuit/examples/circuit_test.h"
 #include "tachyon/zk/plonk/circuit/floor_planner/simple_floor_planner.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
@@ -631,6 +639,90 @@ TEST_F(SimpleCircuitTest, LoadProvingKey) {
   }
 }
 
+TEST_F(SimpleCircuitTest, LoadKeysFromKeyFile) {
+  size_t n = 16;
+  CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
+  prover_->set_domain(Domain::Create(n));
+
+  F constant(7);
+  F a(2);
+  F b(3);
+  using Circuit = SimpleCircuit<F, SimpleFloorPlanner>;
+  Circuit circuit(constant, a, b);
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath pkey_path = temp_dir.GetPath().Append("pkey");
+  base::FilePath vkey_path = temp_dir.GetPath().Append("vkey");
+  {
+    base::Uint8VectorBuffer buffer;
+    ASSERT_TRUE(pkey.WriteToKeyFile(prover_.get(), &buffer));
+    ASSERT_TRUE(base::WriteFile(pkey_path, buffer.owned_buffer()));
+  }
+  {
+    base::Uint8VectorBuffer buffer;
+    ASSERT_TRUE(pkey.verifying_key().WriteToKeyFile(prover_.get(), &buffer));
+    ASSERT_TRUE(base::WriteFile(vkey_path, buffer.owned_buffer()));
+  }
+
+  ProvingKey<PCS> loaded_pkey;
+  ASSERT_TRUE(loaded_pkey.LoadFromKeyFile<Circuit>(prover_.get(), pkey_path));
+  EXPECT_EQ(loaded_pkey.l_first(), pkey.l_first());
+  EXPECT_EQ(loaded_pkey.l_last(), pkey.l_last());
+  EXPECT_EQ(loaded_pkey.l_active_row(), pkey.l_active_row());
+  EXPECT_EQ(loaded_pkey.fixed_columns(), pkey.fixed_columns());
+  EXPECT_EQ(loaded_pkey.fixed_polys(), pkey.fixed_polys());
+  EXPECT_EQ(loaded_pkey.permutation_proving_key().permutations(),
+            pkey.permutation_proving_key().permutations());
+  EXPECT_EQ(loaded_pkey.permutation_proving_key().polys(),
+            pkey.permutation_proving_key().polys());
+  EXPECT_EQ(loaded_pkey.verifying_key().transcript_repr(),
+            pkey.verifying_key().transcript_repr());
+
+  VerifyingKey<PCS> loaded_vkey;
+  ASSERT_TRUE(loaded_vkey.LoadFromKeyFile<Circuit>(prover_.get(), vkey_path));
+  EXPECT_EQ(loaded_vkey.fixed_commitments(),
+            pkey.verifying_key().fixed_commitments());
+  EXPECT_EQ(loaded_vkey.permutation_verifying_key().commitments(),
+            pkey.verifying_key().permutation_verifying_key().commitments());
+  EXPECT_EQ(loaded_vkey.transcript_repr(),
+            pkey.verifying_key().transcript_repr());
+
+  // The kind of the key doesn't match.
+  EXPECT_FALSE(loaded_vkey.LoadFromKeyFile<Circuit>(prover_.get(), pkey_path));
+
+  // The last coefficient of the last permutation poly isn't less than the
+  // modulus.
+  base::Uint8VectorBuffer buffer;
+  ASSERT_TRUE(pkey.WriteToKeyFile(prover_.get(), &buffer));
+  std::vector<uint8_t> corrupted = buffer.owned_buffer();
+  std::fill(corrupted.end() - sizeof(F), corrupted.end(), 0xff);
+  base::Buffer corrupted_buffer(corrupted.data(), corrupted.size());
+  EXPECT_FALSE(
+      loaded_pkey.LoadFromKeyFile<Circuit>(prover_.get(), corrupted_buffer));
+
+  // The proving key starts with the same bytes as the verifying key, which
+  // are followed by the size of |l_first|. It is larger than the file.
+  base::Uint8VectorBuffer vkey_buffer;
+  ASSERT_TRUE(
+      pkey.verifying_key().WriteToKeyFile(prover_.get(), &vkey_buffer));
+  corrupted = buffer.owned_buffer();
+  uint64_t size = uint64_t{1} << 60;
+  memcpy(&corrupted[vkey_buffer.buffer_len()], &size, sizeof(size));
+  corrupted_buffer = base::Buffer(corrupted.data(), corrupted.size());
+  EXPECT_FALSE(
+      loaded_pkey.LoadFromKeyFile<Circuit>(prover_.get(), corrupted_buffer));
+
+  // The failed loads leave the key as it was.
+  EXPECT_EQ(loaded_pkey.l_first(), pkey.l_first());
+  EXPECT_EQ(loaded_pkey.fixed_columns(), pkey.fixed_columns());
+  EXPECT_EQ(loaded_pkey.permutation_proving_key().polys(),
+            pkey.permutation_proving_key().polys());
+}
+
 TEST_F(SimpleCircuitTest, Verify) {
   size_t n = 16;
   CHECK(prover_->pcs().UnsafeSetup(n, F(2)));
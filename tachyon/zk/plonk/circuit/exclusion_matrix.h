@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/export.h"
 #include "tachyon/zk/plonk/circuit/selector_description.h"
 
@@ -59,13 +60,16 @@ namespace tachyon::zk {
 class TACHYON_EXPORT ExclusionMatrix {
  public:
   explicit ExclusionMatrix(const std::vector<SelectorDescription>& selectors) {
-    lower_triangular_matrix_ =
-        base::CreateVector(selectors.size(), [&selectors](size_t i) {
-          const SelectorDescription& selector = selectors[i];
-          return base::CreateVector(i, [&selector, &selectors](size_t j) {
+    // Each row scans the activations of the selectors over all the rows of
+    // the circuit, and the rows are independent of each other.
+    lower_triangular_matrix_.resize(selectors.size());
+    base::ParallelFor(selectors.size(), [this, &selectors](size_t i) {
+      const SelectorDescription& selector = selectors[i];
+      lower_triangular_matrix_[i] =
+          base::CreateVector(i, [&selector, &selectors](size_t j) {
             return !selector.IsOrthogonal(selectors[j]);
           });
-        });
+    });
   }
 
   const std::vector<std::vector<bool>>& lower_triangular_matrix() const {
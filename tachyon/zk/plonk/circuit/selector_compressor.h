@@ -20,6 +20,7 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/containers/cxx20_erase_vector.h"
 #include "tachyon/base/functional/callback.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/zk/expressions/expression_factory.h"
 #include "tachyon/zk/plonk/circuit/exclusion_matrix.h"
 #include "tachyon/zk/plonk/circuit/selector_assignment.h"
@@ -267,13 +268,16 @@ class SelectorCompressor {
 
       // Update the combination assignment
       const std::vector<bool>& activations = selector.activations();
-      for (size_t i = 0; i < n; ++i) {
-        // This will not overwrite another selector's activations
-        // because we have ensured that selectors are disjoint.
-        if (activations[i]) {
-          combination_assignment[i] = assigned_root;
+      base::ParallelForRange(n, [&activations, &combination_assignment,
+                                 &assigned_root](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          // This will not overwrite another selector's activations
+          // because we have ensured that selectors are disjoint.
+          if (activations[i]) {
+            combination_assignment[i] = assigned_root;
+          }
         }
-      }
+      });
 
       assigned_root += F::One();
       selector_assignments_.emplace_back(
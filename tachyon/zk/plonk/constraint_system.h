@@ -21,6 +21,7 @@
 #include "tachyon/base/functional/callback.h"
 #include "tachyon/zk/expressions/evaluator/simple_selector_finder.h"
 #include "tachyon/zk/lookup/lookup_argument.h"
+#include "tachyon/zk/lookup/lookup_type.h"
 #include "tachyon/zk/plonk/circuit/constraint.h"
 #include "tachyon/zk/plonk/circuit/gate.h"
 #include "tachyon/zk/plonk/circuit/lookup_table_column.h"
@@ -90,6 +91,14 @@ class ConstraintSystem {
 
   const std::vector<LookupArgument<F>>& lookups() const { return lookups_; }
 
+  LookupType lookup_type() const { return lookup_type_; }
+
+  // Sets the type of the argument that proves all the |lookups()|. The
+  // default is |LookupType::kHalo2|. |LookupType::kLogDerivativeHalo2| saves
+  // a sort and a committed column per lookup, which pays off for the circuits
+  // with many lookups such as range checks.
+  void set_lookup_type(LookupType lookup_type) { lookup_type_ = lookup_type; }
+
   const absl::flat_hash_map<ColumnKeyBase, std::string>&
   general_column_annotations() const {
     return general_column_annotations_;
@@ -588,6 +597,8 @@ class ConstraintSystem {
   // of table expressions involved in the lookup.
   std::vector<LookupArgument<F>> lookups_;
 
+  LookupType lookup_type_ = LookupType::kHalo2;
+
   // List of indexes of Fixed columns which are associated to a
   // circuit-general Column tied to their annotation.
   absl::flat_hash_map<ColumnKeyBase, std::string> general_column_annotations_;
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "tachyon/zk/lookup/lookup_argument_stringifier.h"
+#include "tachyon/zk/lookup/lookup_type_stringifier.h"
 #include "tachyon/zk/plonk/circuit/phase_stringifier.h"
 #include "tachyon/zk/plonk/circuit/query_stringifier.h"
 #include "tachyon/zk/plonk/constraint_system.h"
@@ -38,6 +39,7 @@ class PinnedConstraintSystem {
         fixed_queries_(constraint_system.fixed_queries()),
         permutation_(constraint_system.permutation()),
         lookups_(constraint_system.lookups()),
+        lookup_type_(constraint_system.lookup_type()),
         constants_(constraint_system.constants()),
         minimum_degree_(constraint_system.minimum_degree()) {}
 
@@ -64,6 +66,7 @@ class PinnedConstraintSystem {
   }
   const PermutationArgument& permutation() const { return permutation_; }
   const std::vector<LookupArgument<F>>& lookups() const { return lookups_; }
+  LookupType lookup_type() const { return lookup_type_; }
   const std::vector<FixedColumnKey>& constants() const { return constants_; }
   const std::optional<size_t>& minimum_degree() const {
     return minimum_degree_;
@@ -83,6 +86,7 @@ class PinnedConstraintSystem {
   const std::vector<FixedQueryData>& fixed_queries_;
   PermutationArgument permutation_;
   const std::vector<LookupArgument<F>>& lookups_;
+  LookupType lookup_type_;
   const std::vector<FixedColumnKey>& constants_;
   const std::optional<size_t>& minimum_degree_;
 };
@@ -114,8 +118,13 @@ class RustDebugStringifier<zk::halo2::PinnedConstraintSystem<F>> {
         .Field("instance_queries", constraint_system.instance_queries())
         .Field("fixed_queries", constraint_system.fixed_queries())
         .Field("permutation", constraint_system.permutation())
-        .Field("lookups", constraint_system.lookups())
-        .Field("constants", constraint_system.constants())
+        .Field("lookups", constraint_system.lookups());
+    // The lookup type is pinned only if it isn't the default, so that
+    // the pinned verifying keys of the Halo2 lookups stay the same as Halo2's.
+    if (constraint_system.lookup_type() != zk::LookupType::kHalo2) {
+      debug_struct.Field("lookup_type", constraint_system.lookup_type());
+    }
+    debug_struct.Field("constants", constraint_system.constants())
         .Field("minimum_degree", constraint_system.minimum_degree());
     return os << debug_struct.Finish();
   }
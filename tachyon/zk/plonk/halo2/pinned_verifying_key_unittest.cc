@@ -1,5 +1,7 @@
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
 
+#include <string>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/zk/plonk/halo2/prover_test.h"
@@ -20,4 +22,16 @@ TEST_F(PinnedVerifyingKeyTest, ToRustDebugString) {
   base::ToRustDebugString(pinned_verifying_key);
 }
 
+TEST_F(PinnedVerifyingKeyTest, PinLookupType) {
+  ConstraintSystem<F> constraint_system;
+  std::string pinned =
+      base::ToRustDebugString(PinnedConstraintSystem<F>(constraint_system));
+  EXPECT_EQ(pinned.find("lookup_type"), std::string::npos);
+
+  constraint_system.set_lookup_type(LookupType::kLogDerivativeHalo2);
+  pinned =
+      base::ToRustDebugString(PinnedConstraintSystem<F>(constraint_system));
+  EXPECT_NE(pinned.find("lookup_type: LogDerivativeHalo2"), std::string::npos);
+}
+
 }  // namespace tachyon::zk::halo2
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "tachyon/zk/lookup/log_derivative_lookup_verification_data.h"
 #include "tachyon/zk/lookup/lookup_pair.h"
 #include "tachyon/zk/lookup/lookup_verification_data.h"
 #include "tachyon/zk/plonk/permutation/permutation_verification_data.h"
@@ -17,11 +18,17 @@ struct Proof {
   std::vector<std::vector<C>> advices_commitments_vec;
   std::vector<F> challenges;
   F theta;
+  // Only one of |lookup_permuted_commitments_vec| and
+  // |lookup_multiplicities_commitments_vec| is filled depending on the
+  // |LookupType| of the constraint system. So are the other lookup fields
+  // below.
   std::vector<std::vector<LookupPair<C>>> lookup_permuted_commitments_vec;
+  std::vector<std::vector<C>> lookup_multiplicities_commitments_vec;
   F beta;
   F gamma;
   std::vector<std::vector<C>> permutation_product_commitments_vec;
   std::vector<std::vector<C>> lookup_product_commitments_vec;
+  std::vector<std::vector<C>> lookup_grand_sum_commitments_vec;
   C vanishing_random_poly_commitment;
   F y;
   std::vector<C> vanishing_h_poly_commitments;
@@ -39,6 +46,9 @@ struct Proof {
   std::vector<std::vector<F>> lookup_permuted_input_evals_vec;
   std::vector<std::vector<F>> lookup_permuted_input_inv_evals_vec;
   std::vector<std::vector<F>> lookup_permuted_table_evals_vec;
+  std::vector<std::vector<F>> lookup_grand_sum_evals_vec;
+  std::vector<std::vector<F>> lookup_grand_sum_next_evals_vec;
+  std::vector<std::vector<F>> lookup_multiplicities_evals_vec;
 
   // auxiliary values
   F l_first;
@@ -109,6 +119,29 @@ struct Proof {
     ret.l_last = &l_last;
     return ret;
   }
+
+  LogDerivativeLookupVerificationData<F, C>
+  ToLogDerivativeLookupVerificationData(size_t i, size_t j) const {
+    LogDerivativeLookupVerificationData<F, C> ret;
+    ret.fixed_evals = absl::MakeConstSpan(fixed_evals);
+    ret.advice_evals = absl::MakeConstSpan(advice_evals_vec[i]);
+    ret.instance_evals = absl::MakeConstSpan(instance_evals_vec[i]);
+    ret.challenges = absl::MakeConstSpan(challenges);
+    ret.multiplicities_commitment =
+        &lookup_multiplicities_commitments_vec[i][j];
+    ret.grand_sum_commitment = &lookup_grand_sum_commitments_vec[i][j];
+    ret.multiplicities_eval = &lookup_multiplicities_evals_vec[i][j];
+    ret.grand_sum_eval = &lookup_grand_sum_evals_vec[i][j];
+    ret.grand_sum_next_eval = &lookup_grand_sum_next_evals_vec[i][j];
+    ret.theta = &theta;
+    ret.beta = &beta;
+    ret.x = &x;
+    ret.x_next = &x_next;
+    ret.l_first = &l_first;
+    ret.l_blind = &l_blind;
+    ret.l_last = &l_last;
+    return ret;
+  }
 };
 
 }  // namespace tachyon::zk::halo2
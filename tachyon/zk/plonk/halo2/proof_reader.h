@@ -6,6 +6,7 @@
 
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/zk/lookup/lookup_type.h"
 #include "tachyon/zk/plonk/halo2/proof.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_utils.h"
@@ -81,17 +82,27 @@ class ProofReader {
     cursor_ = ProofCursor::kLookupPermutedCommitments;
   }
 
+  // If the lookup type is |LookupType::kLogDerivativeHalo2|, this reads the
+  // multiplicities commitments instead.
   void ReadLookupPermutedCommitments() {
     CHECK_EQ(cursor_, ProofCursor::kLookupPermutedCommitments);
-    size_t num_lookups = verifying_key_.constraint_system().lookups().size();
-    proof_.lookup_permuted_commitments_vec =
-        base::CreateVector(num_circuits_, [this, num_lookups]() {
-          return base::CreateVector(num_lookups, [this]() {
-            C input = Read<C>();
-            C table = Read<C>();
-            return LookupPair<C>(std::move(input), std::move(table));
+    const ConstraintSystem<F>& constraint_system =
+        verifying_key_.constraint_system();
+    size_t num_lookups = constraint_system.lookups().size();
+    if (constraint_system.lookup_type() == LookupType::kLogDerivativeHalo2) {
+      proof_.lookup_multiplicities_commitments_vec = base::CreateVector(
+          num_circuits_,
+          [this, num_lookups]() { return ReadMany<C>(num_lookups); });
+    } else {
+      proof_.lookup_permuted_commitments_vec =
+          base::CreateVector(num_circuits_, [this, num_lookups]() {
+            return base::CreateVector(num_lookups, [this]() {
+              C input = Read<C>();
+              C table = Read<C>();
+              return LookupPair<C>(std::move(input), std::move(table));
+            });
           });
-        });
+    }
     cursor_ = ProofCursor::kBetaAndGamma;
   }
 
@@ -113,12 +124,21 @@ class ProofReader {
     cursor_ = ProofCursor::kLookupProductCommitments;
   }
 
+  // If the lookup type is |LookupType::kLogDerivativeHalo2|, this reads the
+  // grand sum commitments instead.
   void ReadLookupProductCommitments() {
     CHECK_EQ(cursor_, ProofCursor::kLookupProductCommitments);
-    size_t num_lookups = verifying_key_.constraint_system().lookups().size();
-    proof_.lookup_product_commitments_vec = base::CreateVector(
+    const ConstraintSystem<F>& constraint_system =
+        verifying_key_.constraint_system();
+    size_t num_lookups = constraint_system.lookups().size();
+    std::vector<std::vector<C>> commitments_vec = base::CreateVector(
         num_circuits_,
         [this, num_lookups]() { return ReadMany<C>(num_lookups); });
+    if (constraint_system.lookup_type() == LookupType::kLogDerivativeHalo2) {
+      proof_.lookup_grand_sum_commitments_vec = std::move(commitments_vec);
+    } else {
+      proof_.lookup_product_commitments_vec = std::move(commitments_vec);
+    }
     cursor_ = ProofCursor::kVanishingRandomPolyCommitment;
   }
 
@@ -217,6 +237,11 @@ class ProofReader {
 
   void ReadLookupEvals() {
     CHECK_EQ(cursor_, ProofCursor::kLookupEvalsVec);
+    if (verifying_key_.constraint_system().lookup_type() ==
+        LookupType::kLogDerivativeHalo2) {
+      ReadLogDerivativeLookupEvals();
+      return;
+    }
     proof_.lookup_product_evals_vec.resize(num_circuits_);
     proof_.lookup_product_next_evals_vec.resize(num_circuits_);
     proof_.lookup_permuted_input_evals_vec.resize(num_circuits_);
@@ -241,6 +266,23 @@ class ProofReader {
   }
 
  private:
+  void ReadLogDerivativeLookupEvals() {
+    proof_.lookup_grand_sum_evals_vec.resize(num_circuits_);
+    proof_.lookup_grand_sum_next_evals_vec.resize(num_circuits_);
+    proof_.lookup_multiplicities_evals_vec.resize(num_circuits_);
+    for (size_t i = 0; i < num_circuits_; ++i) {
+      size_t size = proof_.lookup_grand_sum_commitments_vec[i].size();
+      proof_.lookup_grand_sum_evals_vec[i].reserve(size);
+      proof_.lookup_grand_sum_next_evals_vec[i].reserve(size);
+      proof_.lookup_multiplicities_evals_vec[i].reserve(size);
+      for (size_t j = 0; j < size; ++j) {
+        proof_.lookup_grand_sum_evals_vec[i].push_back(Read<F>());
+        proof_.lookup_grand_sum_next_evals_vec[i].push_back(Read<F>());
+        proof_.lookup_multiplicities_evals_vec[i].push_back(Read<F>());
+      }
+    }
+  }
+
   template <typename T>
   T Read() {
     T value;
@@ -18,6 +18,8 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/zk/base/entities/verifier_base.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_verification.h"
+#include "tachyon/zk/lookup/lookup_type.h"
 #include "tachyon/zk/lookup/lookup_verification.h"
 #include "tachyon/zk/plonk/halo2/proof_reader.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
@@ -288,11 +290,17 @@ class Verifier : public VerifierBase<PCS> {
                                         [](size_t acc, const Gate<F>& gate) {
                                           return acc + gate.polys().size();
                                         });
+    bool log_derivative_lookup =
+        constraint_system.lookup_type() == LookupType::kLogDerivativeHalo2;
+    size_t lookup_expressions_size =
+        log_derivative_lookup
+            ? GetSizeOfLogDerivativeLookupVerificationExpressions()
+            : GetSizeOfLookupVerificationExpressions();
     size_t expressions_size =
         num_circuits *
         (polys_size +
          GetSizeOfPermutationVerificationExpressions(constraint_system) +
-         lookups.size() * GetSizeOfLookupVerificationExpressions());
+         lookups.size() * lookup_expressions_size);
     expressions.reserve(expressions_size);
     for (size_t i = 0; i < num_circuits; ++i) {
       VanishingVerificationEvaluator<F> vanishing_verification_evaluator(
@@ -314,8 +322,13 @@ class Verifier : public VerifierBase<PCS> {
 
       for (size_t j = 0; j < lookups.size(); ++j) {
         const LookupArgument<F>& lookup = lookups[j];
-        std::vector<F> lookup_expressions = CreateLookupVerificationExpressions(
-            proof.ToLookupVerificationData(i, j), lookup);
+        std::vector<F> lookup_expressions =
+            log_derivative_lookup
+                ? CreateLogDerivativeLookupVerificationExpressions(
+                      proof.ToLogDerivativeLookupVerificationData(i, j),
+                      lookup)
+                : CreateLookupVerificationExpressions(
+                      proof.ToLookupVerificationData(i, j), lookup);
         expressions.insert(expressions.end(),
                            std::make_move_iterator(lookup_expressions.begin()),
                            std::make_move_iterator(lookup_expressions.end()));
@@ -370,11 +383,16 @@ class Verifier : public VerifierBase<PCS> {
         constraint_system.fixed_queries();
     const std::vector<Commitment>& common_permutation_commitments =
         vkey.permutation_verifying_key().commitments();
+    bool log_derivative_lookup =
+        constraint_system.lookup_type() == LookupType::kLogDerivativeHalo2;
+    size_t lookup_queries_size =
+        log_derivative_lookup ? GetSizeOfLogDerivativeLookupVerifierQueries()
+                              : GetSizeOfLookupVerifierQueries();
     size_t queries_size =
         num_circuits *
             (GetSizeOfAdviceInstanceColumnQueries(constraint_system) +
              GetSizeOfPermutationVerifierQueries(constraint_system) +
-             lookups.size() * GetSizeOfLookupVerifierQueries()) +
+             lookups.size() * lookup_queries_size) +
         fixed_queries.size() + common_permutation_commitments.size() + 2;
     queries.reserve(queries_size);
 
@@ -405,7 +423,11 @@ class Verifier : public VerifierBase<PCS> {
 
       for (size_t j = 0; j < lookups.size(); ++j) {
         std::vector<Opening> lookup_queries =
-            CreateLookupQueries<PCS>(proof.ToLookupVerificationData(i, j));
+            log_derivative_lookup
+                ? CreateLogDerivativeLookupQueries<PCS>(
+                      proof.ToLogDerivativeLookupVerificationData(i, j))
+                : CreateLookupQueries<PCS>(
+                      proof.ToLookupVerificationData(i, j));
         queries.insert(queries.end(),
                        std::make_move_iterator(lookup_queries.begin()),
                        std::make_move_iterator(lookup_queries.end()));
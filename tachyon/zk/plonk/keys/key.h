@@ -10,8 +10,14 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/threading/task_pool.h"
+#include "tachyon/math/base/rational_field.h"
 #include "tachyon/zk/base/entities/entity.h"
+#include "tachyon/zk/base/fraction_tiles.h"
 #include "tachyon/zk/plonk/constraint_system.h"
 #include "tachyon/zk/plonk/keys/assembly.h"
 
@@ -51,21 +57,10 @@ class Key {
   bool PreLoad(Entity<PCS>* entity, Circuit& circuit, PreLoadResult* result) {
     using Config = typename Circuit::Config;
     using FloorPlanner = typename Circuit::FloorPlanner;
-    using RationalEvals = typename Assembly<PCS>::RationalEvals;
-    using ExtendedDomain = typename PCS::ExtendedDomain;
 
     ConstraintSystem<F>& constraint_system = result->constraint_system;
     Config config = Circuit::Configure(constraint_system);
-
-    PCS& pcs = entity->pcs();
-    if (pcs.N() < constraint_system.ComputeMinimumRows()) {
-      LOG(ERROR) << "Not enough rows available " << pcs.N() << " vs "
-                 << constraint_system.ComputeMinimumRows();
-      return false;
-    }
-    size_t extended_k = constraint_system.ComputeExtendedDegree(pcs.K());
-    entity->set_extended_domain(
-        ExtendedDomain::Create(size_t{1} << extended_k));
+    if (!SetUpExtendedDomain(entity, constraint_system)) return false;
 
     result->assembly = CreateAssembly(entity->domain(), constraint_system);
     Assembly<PCS>& assembly = result->assembly;
@@ -73,14 +68,7 @@ class Key {
     floor_planner.Synthesize(&assembly, circuit, std::move(config),
                              constraint_system.constants());
 
-    result->fixed_columns =
-        base::Map(assembly.fixed_columns(), [](const RationalEvals& evals) {
-          std::vector<F> result =
-              base::CreateVector(evals.evaluations().size(), F::Zero());
-          CHECK(math::RationalField<F>::BatchEvaluate(evals.evaluations(),
-                                                      &result));
-          return Evals(std::move(result));
-        });
+    result->fixed_columns = EvaluateRationalColumns(assembly.fixed_columns());
     std::vector<Evals>& fixed_columns = result->fixed_columns;
 
     std::vector<std::vector<F>> selector_polys_tmp =
@@ -95,6 +83,61 @@ class Key {
 
     return true;
   }
+
+  // Evaluates the rational |columns|. The rows of all the |columns| are split
+  // into tiles of |GetFractionTileSize<F>()| rows, each of which is inverted
+  // with a single batch inversion in parallel. So the parallelism isn't bound
+  // by the number of the |columns| unlike evaluating a column after another.
+  static std::vector<Evals> EvaluateRationalColumns(
+      const std::vector<typename Assembly<PCS>::RationalEvals>& columns) {
+    if (columns.empty()) return {};
+    size_t n = columns[0].evaluations().size();
+    std::vector<std::vector<F>> values =
+        base::CreateVector(columns.size(), [n]() { return std::vector<F>(n); });
+
+    constexpr size_t kTileSize = GetFractionTileSize<F>();
+    size_t num_tiles_per_column = (n + kTileSize - 1) / kTileSize;
+    size_t num_tiles = columns.size() * num_tiles_per_column;
+    base::ParallelFor(num_tiles, [&columns, &values,
+                                  num_tiles_per_column](size_t i) {
+      size_t col = i / num_tiles_per_column;
+      size_t start = (i % num_tiles_per_column) * kTileSize;
+      absl::Span<const math::RationalField<F>> rationals =
+          absl::MakeConstSpan(columns[col].evaluations())
+              .subspan(start, kTileSize);
+      absl::Span<F> tile =
+          absl::MakeSpan(values[col]).subspan(start, kTileSize);
+      for (size_t j = 0; j < tile.size(); ++j) {
+        tile[j] = rationals[j].denominator();
+      }
+      CHECK(F::BatchInverseInPlaceSerial(tile));
+      for (size_t j = 0; j < tile.size(); ++j) {
+        tile[j] *= rationals[j].numerator();
+      }
+    });
+    return base::Map(
+        std::make_move_iterator(values.begin()),
+        std::make_move_iterator(values.end()),
+        [](std::vector<F>&& vec) { return Evals(std::move(vec)); });
+  }
+
+  // Checks if the |entity| has enough rows for the |constraint_system| and
+  // sets the extended domain of the |entity| for it.
+  static bool SetUpExtendedDomain(
+      Entity<PCS>* entity, const ConstraintSystem<F>& constraint_system) {
+    using ExtendedDomain = typename PCS::ExtendedDomain;
+
+    PCS& pcs = entity->pcs();
+    if (pcs.N() < constraint_system.ComputeMinimumRows()) {
+      LOG(ERROR) << "Not enough rows available " << pcs.N() << " vs "
+                 << constraint_system.ComputeMinimumRows();
+      return false;
+    }
+    size_t extended_k = constraint_system.ComputeExtendedDegree(pcs.K());
+    entity->set_extended_domain(
+        ExtendedDomain::Create(size_t{1} << extended_k));
+    return true;
+  }
 };
 
 }  // namespace tachyon::zk
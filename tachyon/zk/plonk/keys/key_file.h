@@ -0,0 +1,274 @@
+#ifndef TACHYON_ZK_PLONK_KEYS_KEY_FILE_H_
+#define TACHYON_ZK_PLONK_KEYS_KEY_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+// The key file is the on-disk format of |ProvingKey| and |VerifyingKey|, so
+// that a key doesn't need to be generated again once it is written.
+//
+// | Section          | Contents                                           |
+// |------------------|----------------------------------------------------|
+// | header           | magic, version, kind, n and the size of a field    |
+// | verifying key    | transcript repr, fixed and permutation commitments |
+// | proving key only | l_first, l_last, l_active_row, fixed columns,      |
+// |                  | fixed polys, permutations and permutation polys    |
+//
+// The field elements of the proving key are stored as arrays of their raw
+// Montgomery forms, each of which starts at an offset aligned to
+// |kKeyFileAlignment|. So if the file is memory mapped, an array can be read
+// as an |absl::Span<const F>| without any copy or conversion. See
+// |ReadKeyFileFields()|. The arrays are written in the native byte order,
+// which is checked by the magic in the header.
+//
+// NOTE: |ProvingKey| owns its polynomials, so |ProvingKey::LoadFromKeyFile()|
+// copies every array out of the file, and the file isn't needed once it
+// returns. Loading saves the synthesis, the FFTs and the commitments, not the
+// memory of the key. Every count is checked against the bytes left in the file
+// before anything is allocated, every array against the size of the domain,
+// and every field element to be less than the modulus while it is copied.
+//
+// The constraint system isn't stored in the file. It is configured from the
+// circuit again, which is cheap compared to the synthesis. The transcript repr
+// is a hash over the constraint system, the domain and the commitments, so it
+// is used to check that the file is for the circuit. The rest of the proving
+// key isn't covered by it, so the key file is trusted to be the one written by
+// |ProvingKey::WriteToKeyFile()|. A proving key that doesn't match its
+// verifying key only makes the proofs fail to verify.
+namespace tachyon::zk {
+
+// "TACHYON\0" in the little endian.
+constexpr uint64_t kKeyFileMagic = 0x004e4f5948434154;
+// Bump this whenever the layout of the key file changes.
+constexpr uint32_t kKeyFileVersion = 1;
+constexpr size_t kKeyFileAlignment = 64;
+
+enum class KeyFileKind : uint32_t {
+  kVerifyingKey,
+  kProvingKey,
+};
+
+struct KeyFileHeader {
+  uint64_t magic = kKeyFileMagic;
+  uint32_t version = kKeyFileVersion;
+  KeyFileKind kind = KeyFileKind::kVerifyingKey;
+  // The size of the domain.
+  uint64_t n = 0;
+  // The size of a field element in bytes.
+  uint64_t field_size = 0;
+};
+
+[[nodiscard]] inline bool WriteKeyFileHeader(const KeyFileHeader& header,
+                                             base::Buffer* buffer) {
+  return buffer->WriteMany(header.magic, header.version,
+                           static_cast<uint32_t>(header.kind), header.n,
+                           header.field_size);
+}
+
+// Reads a header and returns true if it is a key of |kind| of the current
+// version for the domain of size |n|.
+template <typename F>
+[[nodiscard]] bool ReadKeyFileHeader(const base::Buffer& buffer,
+                                     KeyFileKind kind, size_t n) {
+  KeyFileHeader header;
+  uint32_t header_kind;
+  if (!buffer.ReadMany(&header.magic, &header.version, &header_kind,
+                       &header.n, &header.field_size)) {
+    return false;
+  }
+  header.kind = static_cast<KeyFileKind>(header_kind);
+  if (header.magic != kKeyFileMagic) {
+    LOG(ERROR) << "Not a key file or written in a different byte order";
+    return false;
+  }
+  if (header.version != kKeyFileVersion) {
+    LOG(ERROR) << "Unsupported key file version: " << header.version
+               << " (expected " << kKeyFileVersion << ")";
+    return false;
+  }
+  if (header.kind != kind) {
+    LOG(ERROR) << "Unexpected kind of key";
+    return false;
+  }
+  if (header.n != n) {
+    LOG(ERROR) << "The key file is for a domain of size " << header.n
+               << ", not " << n;
+    return false;
+  }
+  if (header.field_size != sizeof(F)) {
+    LOG(ERROR) << "The key file is for a field of size " << header.field_size
+               << ", not " << sizeof(F);
+    return false;
+  }
+  return true;
+}
+
+namespace internal {
+
+inline size_t GetKeyFilePadding(size_t offset) {
+  return (kKeyFileAlignment - offset % kKeyFileAlignment) % kKeyFileAlignment;
+}
+
+// Reads the size of an array written by |WriteKeyFileFields()| and skips the
+// padding before it. Returns false if the |buffer| is shorter than the array.
+template <typename F>
+[[nodiscard]] bool ReadKeyFileFieldsSize(const base::Buffer& buffer,
+                                         size_t* size) {
+  uint64_t size_tmp;
+  if (!buffer.Read(&size_tmp)) return false;
+  size_t offset = buffer.buffer_offset();
+  offset = std::min(offset + GetKeyFilePadding(offset), buffer.buffer_len());
+  if (size_tmp > (buffer.buffer_len() - offset) / sizeof(F)) {
+    LOG(ERROR) << "The key file is truncated";
+    return false;
+  }
+  buffer.set_buffer_offset(offset);
+  *size = size_tmp;
+  return true;
+}
+
+// Same as |ReadKeyFileFields()| below, but it copies the array into |values|
+// and returns false if it has more than |max_size| elements.
+template <typename F>
+[[nodiscard]] bool ReadKeyFileFields(const base::Buffer& buffer,
+                                     size_t max_size, std::vector<F>* values) {
+  size_t size;
+  if (!ReadKeyFileFieldsSize<F>(buffer, &size)) return false;
+  if (size > max_size) {
+    LOG(ERROR) << "The key file has an array of " << size
+               << " field elements, more than " << max_size;
+    return false;
+  }
+  // The |buffer| may not be aligned for |F| unless it is memory mapped.
+  values->resize(size);
+  if (!buffer.ReadRaw(absl::MakeSpan(*values), /*validate=*/true)) {
+    LOG(ERROR) << "The key file has a field element out of range";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace internal
+
+// Writes |values| as an array of raw field elements whose offset is aligned
+// to |kKeyFileAlignment|.
+template <typename F>
+[[nodiscard]] bool WriteKeyFileFields(absl::Span<const F> values,
+                                      base::Buffer* buffer) {
+  if (!buffer->Write(uint64_t{values.size()})) return false;
+  uint8_t zeros[kKeyFileAlignment] = {0};
+  if (!buffer->Write(zeros,
+                     internal::GetKeyFilePadding(buffer->buffer_offset()))) {
+    return false;
+  }
+  return buffer->WriteRaw(values);
+}
+
+// Reads an array written by |WriteKeyFileFields()| and sets |values| to the
+// view of it in the |buffer| without a copy. |values| is valid as long as the
+// memory of the |buffer| is. The |buffer| needs to start at an address aligned
+// to |kKeyFileAlignment|, which a memory mapped file does.
+template <typename F>
+[[nodiscard]] bool ReadKeyFileFields(const base::Buffer& buffer,
+                                     absl::Span<const F>* values) {
+  size_t size;
+  if (!internal::ReadKeyFileFieldsSize<F>(buffer, &size)) return false;
+  if (!buffer.ReadRawView(size, values, /*validate=*/true)) {
+    LOG(ERROR) << "The key file is not aligned or has a field element out of "
+                  "range";
+    return false;
+  }
+  return true;
+}
+
+template <typename F, size_t MaxDegree>
+[[nodiscard]] bool WriteKeyFileFields(
+    const math::UnivariateEvaluations<F, MaxDegree>& evals,
+    base::Buffer* buffer) {
+  return WriteKeyFileFields(absl::MakeConstSpan(evals.evaluations()), buffer);
+}
+
+template <typename F, size_t MaxDegree>
+[[nodiscard]] bool WriteKeyFileFields(
+    const math::UnivariateDensePolynomial<F, MaxDegree>& poly,
+    base::Buffer* buffer) {
+  return WriteKeyFileFields(
+      absl::MakeConstSpan(poly.coefficients().coefficients()), buffer);
+}
+
+template <typename T>
+[[nodiscard]] bool WriteKeyFileFields(const std::vector<T>& values,
+                                      base::Buffer* buffer) {
+  if (!buffer->Write(uint64_t{values.size()})) return false;
+  for (const T& value : values) {
+    if (!WriteKeyFileFields(value, buffer)) return false;
+  }
+  return true;
+}
+
+// Reads the evaluations over the domain of size |n|. Returns false unless
+// there are exactly |n| of them.
+template <typename F, size_t MaxDegree>
+[[nodiscard]] bool ReadKeyFileFields(
+    const base::Buffer& buffer, size_t n,
+    math::UnivariateEvaluations<F, MaxDegree>* evals) {
+  std::vector<F> values;
+  if (!internal::ReadKeyFileFields(buffer, n, &values)) return false;
+  if (values.size() != n) {
+    LOG(ERROR) << "The key file has " << values.size()
+               << " evaluations, not " << n;
+    return false;
+  }
+  *evals = math::UnivariateEvaluations<F, MaxDegree>(std::move(values));
+  return true;
+}
+
+// Reads a polynomial over the domain of size |n|. Returns false if it has more
+// than |n| coefficients. It may have fewer, since the zeros of the highest
+// degrees are removed.
+template <typename F, size_t MaxDegree>
+[[nodiscard]] bool ReadKeyFileFields(
+    const base::Buffer& buffer, size_t n,
+    math::UnivariateDensePolynomial<F, MaxDegree>* poly) {
+  using Coefficients = math::UnivariateDenseCoefficients<F, MaxDegree>;
+
+  std::vector<F> values;
+  if (!internal::ReadKeyFileFields(buffer, n, &values)) return false;
+  *poly = math::UnivariateDensePolynomial<F, MaxDegree>(
+      Coefficients(std::move(values)));
+  return true;
+}
+
+template <typename T>
+[[nodiscard]] bool ReadKeyFileFields(const base::Buffer& buffer, size_t n,
+                                     std::vector<T>* values) {
+  uint64_t size;
+  if (!buffer.Read(&size)) return false;
+  // Every element starts with its own size, so the count can't be more than
+  // the |buffer| holds. This is checked before |values| is allocated.
+  if (size > (buffer.buffer_len() - buffer.buffer_offset()) /
+                 sizeof(uint64_t)) {
+    LOG(ERROR) << "The key file is truncated";
+    return false;
+  }
+  values->resize(size);
+  for (T& value : *values) {
+    if (!ReadKeyFileFields(buffer, n, &value)) return false;
+  }
+  return true;
+}
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_PLONK_KEYS_KEY_FILE_H_
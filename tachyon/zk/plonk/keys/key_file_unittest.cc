@@ -0,0 +1,75 @@
+#include "tachyon/zk/plonk/keys/key_file.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+constexpr size_t kMaxDegree = 7;
+constexpr size_t kN = 4;
+
+using F = math::GF7;
+using Poly = math::UnivariateDensePolynomial<F, kMaxDegree>;
+using Evals = math::UnivariateEvaluations<F, kMaxDegree>;
+
+Evals CreateEvals(size_t size) {
+  return Evals(base::CreateVector(size, []() { return F::Random(); }));
+}
+
+}  // namespace
+
+TEST(KeyFileTest, ReadEvals) {
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(WriteKeyFileFields(CreateEvals(kN), &write_buf));
+  ASSERT_TRUE(WriteKeyFileFields(CreateEvals(kN - 1), &write_buf));
+  ASSERT_TRUE(WriteKeyFileFields(CreateEvals(kN + 1), &write_buf));
+
+  const base::Buffer read_buf = base::Buffer::CreateReadOnly(
+      write_buf.buffer(), write_buf.buffer_len());
+  Evals evals;
+  EXPECT_TRUE(ReadKeyFileFields(read_buf, kN, &evals));
+  // There must be exactly |kN| evaluations.
+  EXPECT_FALSE(ReadKeyFileFields(read_buf, kN, &evals));
+  EXPECT_FALSE(ReadKeyFileFields(read_buf, kN, &evals));
+}
+
+TEST(KeyFileTest, ReadPoly) {
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(WriteKeyFileFields(Poly::Random(kN - 1), &write_buf));
+  // The highest coefficient is nonzero, so that it has |kN| + 1 coefficients.
+  std::vector<F> coefficients(kN + 1, F::One());
+  ASSERT_TRUE(WriteKeyFileFields(
+      Poly(math::UnivariateDenseCoefficients<F, kMaxDegree>(
+          std::move(coefficients))),
+      &write_buf));
+
+  const base::Buffer read_buf = base::Buffer::CreateReadOnly(
+      write_buf.buffer(), write_buf.buffer_len());
+  Poly poly;
+  EXPECT_TRUE(ReadKeyFileFields(read_buf, kN, &poly));
+  // A polynomial can't have more than |kN| coefficients.
+  EXPECT_FALSE(ReadKeyFileFields(read_buf, kN, &poly));
+}
+
+TEST(KeyFileTest, ReadVectorWithTooLargeCount) {
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Write(uint64_t{1} << 60));
+  ASSERT_TRUE(WriteKeyFileFields(CreateEvals(kN), &write_buf));
+
+  // The count is rejected before the vector is allocated.
+  const base::Buffer read_buf = base::Buffer::CreateReadOnly(
+      write_buf.buffer(), write_buf.buffer_len());
+  std::vector<Evals> evals_vec;
+  EXPECT_FALSE(ReadKeyFileFields(read_buf, kN, &evals_vec));
+  EXPECT_TRUE(evals_vec.empty());
+}
+
+}  // namespace tachyon::zk
@@ -0,0 +1,83 @@
+#include <memory>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/base/commitments/shplonk_extension.h"
+#include "tachyon/zk/plonk/circuit/examples/simple_circuit.h"
+#include "tachyon/zk/plonk/circuit/examples/simple_lookup_circuit.h"
+#include "tachyon/zk/plonk/circuit/floor_planner/simple_floor_planner.h"
+#include "tachyon/zk/plonk/halo2/blake2b_transcript.h"
+#include "tachyon/zk/plonk/halo2/prover.h"
+#include "tachyon/zk/plonk/keys/proving_key.h"
+
+namespace tachyon::zk::halo2 {
+
+namespace {
+
+constexpr size_t kMaxDegree = (size_t{1} << 22) - 1;
+constexpr size_t kMaxExtendedDegree = (size_t{1} << 26) - 1;
+
+using PCS = SHPlonkExtension<math::bn254::BN254Curve, kMaxDegree,
+                             kMaxExtendedDegree, math::bn254::G1AffinePoint>;
+using F = PCS::Field;
+using Commitment = PCS::Commitment;
+using Domain = PCS::Domain;
+
+std::unique_ptr<Prover<PCS>> CreateProver(size_t k) {
+  size_t n = size_t{1} << k;
+  PCS pcs;
+  CHECK(pcs.UnsafeSetup(n, F(2)));
+
+  base::Uint8VectorBuffer write_buf;
+  std::unique_ptr<crypto::TranscriptWriter<Commitment>> writer =
+      std::make_unique<Blake2bWriter<Commitment>>(std::move(write_buf));
+
+  constexpr uint8_t kSeed[] = {0x59, 0x62, 0xbe, 0x5d, 0x76, 0x3d, 0x31, 0x8d,
+                               0x17, 0xdb, 0x37, 0x32, 0x54, 0x06, 0xbc, 0xe5};
+
+  std::unique_ptr<Prover<PCS>> prover =
+      std::make_unique<Prover<PCS>>(Prover<PCS>::CreateFromSeed(
+          std::move(pcs), std::move(writer), kSeed, /*blinding_factors=*/0));
+  prover->set_domain(Domain::Create(n));
+  return prover;
+}
+
+SimpleCircuit<F, SimpleFloorPlanner> CreateSimpleCircuit(size_t) {
+  return SimpleCircuit<F, SimpleFloorPlanner>(F(7), F(2), F(3));
+}
+
+// The lookup is enabled on the half of the rows, which leaves the room for
+// the blinding factors.
+SimpleLookupCircuit<F, 3, SimpleFloorPlanner> CreateSimpleLookupCircuit(
+    size_t k) {
+  return SimpleLookupCircuit<F, 3, SimpleFloorPlanner>(k - 1);
+}
+
+}  // namespace
+
+// Generates the proving key, which includes the verifying key, of the circuit
+// for a domain of size 2^|state.range(0)|. The setup of the PCS isn't measured.
+template <typename Circuit>
+void BM_Keygen(benchmark::State& state, Circuit (*create_circuit)(size_t)) {
+  size_t k = static_cast<size_t>(state.range(0));
+  std::unique_ptr<Prover<PCS>> prover = CreateProver(k);
+  Circuit circuit = create_circuit(k);
+  for (auto _ : state) {
+    ProvingKey<PCS> pkey;
+    CHECK(pkey.Load(prover.get(), circuit));
+    benchmark::DoNotOptimize(pkey);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_Keygen, SimpleCircuit, &CreateSimpleCircuit)
+    ->DenseRange(18, 22)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Keygen, SimpleLookupCircuit, &CreateSimpleLookupCircuit)
+    ->DenseRange(18, 22)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::zk::halo2
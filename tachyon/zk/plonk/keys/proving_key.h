@@ -7,14 +7,22 @@
 #ifndef TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 #define TACHYON_ZK_PLONK_KEYS_PROVING_KEY_H_
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
-#include "tachyon/base/parallelize.h"
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/device/numa_placement.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/plonk/keys/key_file.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
 #include "tachyon/zk/plonk/permutation/permutation_proving_key.h"
+#include "tachyon/zk/plonk/vanishing/coset_cache.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_argument.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
 
 namespace tachyon::zk {
 
@@ -27,6 +35,9 @@ class ProvingKey : public Key<PCS> {
   using PreLoadResult = typename Key<PCS>::PreLoadResult;
   using VerifyingKeyLoadResult = typename VerifyingKey<PCS>::LoadResult;
 
+  constexpr static size_t kFixedPolysCacheId = 0;
+  constexpr static size_t kPermutationPolysCacheId = 1;
+
   ProvingKey() = default;
 
   const VerifyingKey<PCS>& verifying_key() const { return verifying_key_; }
@@ -38,6 +49,22 @@ class ProvingKey : public Key<PCS> {
   const PermutationProvingKey<Poly, Evals>& permutation_proving_key() const {
     return permutation_proving_key_;
   }
+  // The extended part evaluations of the circuit independent polynomials of
+  // this key. This is shared by all the proofs created with this key, which
+  // may run concurrently, so the cache is internally synchronized. The
+  // polynomials are cached with |kFixedPolysCacheId| and
+  // |kPermutationPolysCacheId|, and the cache is cleared whenever this key is
+  // loaded.
+  CosetCache<Poly, Evals>& coset_cache() const { return coset_cache_; }
+
+  device::NUMAPlacement numa_placement() const { return numa_placement_; }
+  // Sets how the polynomials and the evaluations of this key are placed on
+  // the NUMA nodes when it is loaded. They are read by all the proofs created
+  // with this key, so it pays to place them once. It is
+  // |device::NUMAPlacement::kFirstTouch| by default, which places nothing.
+  void set_numa_placement(device::NUMAPlacement numa_placement) {
+    numa_placement_ = numa_placement;
+  }
 
   // Return true if it is able to load from an instance of |circuit|.
   template <typename Circuit>
@@ -62,6 +89,92 @@ class ProvingKey : public Key<PCS> {
     return DoLoad(prover, std::move(pre_load_result), nullptr);
   }
 
+  // Writes this key to |buffer| in the key file format. See key_file.h.
+  [[nodiscard]] bool WriteToKeyFile(const ProverBase<PCS>* prover,
+                                    base::Buffer* buffer) const {
+    KeyFileHeader header;
+    header.kind = KeyFileKind::kProvingKey;
+    header.n = prover->pcs().N();
+    header.field_size = sizeof(F);
+    return WriteKeyFileHeader(header, buffer) &&
+           verifying_key_.WriteKeyFileBody(buffer) &&
+           WriteKeyFileFields(l_first_, buffer) &&
+           WriteKeyFileFields(l_last_, buffer) &&
+           WriteKeyFileFields(l_active_row_, buffer) &&
+           WriteKeyFileFields(fixed_columns_, buffer) &&
+           WriteKeyFileFields(fixed_polys_, buffer) &&
+           WriteKeyFileFields(permutation_proving_key_.permutations(),
+                              buffer) &&
+           WriteKeyFileFields(permutation_proving_key_.polys(), buffer);
+  }
+
+  // Return true if it is able to load from |buffer| written by
+  // |WriteToKeyFile()| for an instance of |Circuit|. Unlike |Load()|, this
+  // neither synthesizes the circuit nor computes any polynomial or
+  // commitment. The constraint system is configured from |Circuit| again.
+  // The values are copied out of the |buffer| after they are checked to be
+  // less than the modulus, so the |buffer| can be freed once this returns.
+  // Everything is read before this key is touched, so this key is left as it
+  // was if it returns false. See key_file.h for what is trusted in the
+  // |buffer|.
+  template <typename Circuit>
+  [[nodiscard]] bool LoadFromKeyFile(ProverBase<PCS>* prover,
+                                     const base::Buffer& buffer) {
+    size_t n = prover->pcs().N();
+    if (!ReadKeyFileHeader<F>(buffer, KeyFileKind::kProvingKey, n)) {
+      return false;
+    }
+    VerifyingKey<PCS> verifying_key;
+    if (!verifying_key.template ReadKeyFileBody<Circuit>(prover, buffer)) {
+      return false;
+    }
+
+    Poly l_first;
+    Poly l_last;
+    Poly l_active_row;
+    std::vector<Evals> fixed_columns;
+    std::vector<Poly> fixed_polys;
+    std::vector<Evals> permutations;
+    std::vector<Poly> permutation_polys;
+    if (!(ReadKeyFileFields(buffer, n, &l_first) &&
+          ReadKeyFileFields(buffer, n, &l_last) &&
+          ReadKeyFileFields(buffer, n, &l_active_row) &&
+          ReadKeyFileFields(buffer, n, &fixed_columns) &&
+          ReadKeyFileFields(buffer, n, &fixed_polys) &&
+          ReadKeyFileFields(buffer, n, &permutations) &&
+          ReadKeyFileFields(buffer, n, &permutation_polys))) {
+      return false;
+    }
+
+    verifying_key_ = std::move(verifying_key);
+    prover->blinder().set_blinding_factors(
+        verifying_key_.constraint_system().ComputeBlindingFactors());
+    coset_cache_.Clear();
+    l_first_ = std::move(l_first);
+    l_last_ = std::move(l_last);
+    l_active_row_ = std::move(l_active_row);
+    fixed_columns_ = std::move(fixed_columns);
+    fixed_polys_ = std::move(fixed_polys);
+    permutation_proving_key_ = PermutationProvingKey<Poly, Evals>(
+        std::move(permutations), std::move(permutation_polys));
+    vanishing_argument_ =
+        VanishingArgument<F>::Create(verifying_key_.constraint_system());
+    PlaceOnNUMANodes();
+    return true;
+  }
+
+  // Same as above, but it reads from the memory mapped file at |path|. The
+  // file is unmapped when this returns.
+  template <typename Circuit>
+  [[nodiscard]] bool LoadFromKeyFile(ProverBase<PCS>* prover,
+                                     const base::FilePath& path) {
+    base::MemoryMappedFile file;
+    if (!file.Initialize(path)) return false;
+    const base::Buffer buffer =
+        base::Buffer::CreateReadOnly(file.data(), file.length());
+    return LoadFromKeyFile<Circuit>(prover, buffer);
+  }
+
  private:
   bool DoLoad(ProverBase<PCS>* prover, PreLoadResult&& pre_load_result,
               VerifyingKeyLoadResult* vk_load_result) {
@@ -72,11 +185,10 @@ class ProvingKey : public Key<PCS> {
     prover->blinder().set_blinding_factors(
         verifying_key_.constraint_system().ComputeBlindingFactors());
 
+    coset_cache_.Clear();
     const Domain* domain = prover->domain();
     fixed_columns_ = std::move(pre_load_result.fixed_columns);
-    fixed_polys_ = base::Map(fixed_columns_, [domain](const Evals& evals) {
-      return domain->IFFT(evals);
-    });
+    fixed_polys_ = domain->BatchIFFT(fixed_columns_);
 
     std::vector<Evals> permutations;
     if (vk_load_result) {
@@ -103,10 +215,10 @@ class ProvingKey : public Key<PCS> {
     // | 5 | 0          |
     // | 6 | 0          |
     // | 7 | 0          |
-    Evals evals = domain->template Empty<Evals>();
-    *evals[0] = F::One();
-    l_first_ = domain->IFFT(evals);
-    *evals[0] = F::Zero();
+    //
+    // l_first(X), l_last(X) and l_active_row(X) are built in the closed form
+    // without an IFFT. See |BuildLFirst()|.
+    l_first_ = BuildLFirst(domain);
 
     // Compute l_last(X) which evaluates to 1 on the first inactive row (just
     // before the blinding factors) and 0 otherwise over the domain.
@@ -122,9 +234,7 @@ class ProvingKey : public Key<PCS> {
     // | 6 | 0         |
     // | 7 | 0         |
     size_t usable_rows = prover->GetUsableRows();
-    *evals[usable_rows] = F::One();
-    l_last_ = domain->IFFT(evals);
-    *evals[usable_rows] = F::Zero();
+    l_last_ = BuildLLast(domain, usable_rows);
 
     // Compute l_active_row(X).
     //
@@ -138,25 +248,49 @@ class ProvingKey : public Key<PCS> {
     // | 5 | 0               |
     // | 6 | 0               |
     // | 7 | 0               |
-    F one = F::One();
-    base::Parallelize(
-        evals.evaluations(),
-        [&one, usable_rows](absl::Span<F> chunk, size_t chunk_index,
-                            size_t chunk_size_in) {
-          size_t i = chunk_index * chunk_size_in;
-          for (F& value : chunk) {
-            if (i++ < usable_rows) {
-              value = one;
-            }
-          }
-        });
-    l_active_row_ = domain->IFFT(evals);
+    l_active_row_ = BuildLActiveRow(domain, usable_rows);
 
     vanishing_argument_ =
         VanishingArgument<F>::Create(verifying_key_.constraint_system());
+    PlaceOnNUMANodes();
     return true;
   }
 
+  // Places the pages of the polynomials and the evaluations of this key by
+  // |numa_placement_|. A failure is only logged, since the key works all the
+  // same with its pages wherever they are.
+  void PlaceOnNUMANodes() const {
+    if (numa_placement_ == device::NUMAPlacement::kFirstTouch) return;
+    std::vector<const Poly*> polys = {&l_first_, &l_last_, &l_active_row_};
+    for (const Poly& poly : fixed_polys_) {
+      polys.push_back(&poly);
+    }
+    for (const Poly& poly : permutation_proving_key_.polys()) {
+      polys.push_back(&poly);
+    }
+    std::vector<const Evals*> evals_vec;
+    for (const Evals& evals : fixed_columns_) {
+      evals_vec.push_back(&evals);
+    }
+    for (const Evals& evals : permutation_proving_key_.permutations()) {
+      evals_vec.push_back(&evals);
+    }
+    bool placed =
+        std::all_of(polys.begin(), polys.end(),
+                    [this](const Poly* poly) {
+                      return poly->coefficients().PlaceOnNUMANodes(
+                          numa_placement_);
+                    }) &&
+        std::all_of(evals_vec.begin(), evals_vec.end(),
+                    [this](const Evals* evals) {
+                      return evals->PlaceOnNUMANodes(numa_placement_);
+                    });
+    if (!placed) {
+      LOG(WARNING) << "Failed to place the proving key on the NUMA nodes: "
+                   << device::NUMAPlacementToString(numa_placement_);
+    }
+  }
+
   VerifyingKey<PCS> verifying_key_;
   Poly l_first_;
   Poly l_last_;
@@ -165,6 +299,8 @@ class ProvingKey : public Key<PCS> {
   std::vector<Poly> fixed_polys_;
   PermutationProvingKey<Poly, Evals> permutation_proving_key_;
   VanishingArgument<F> vanishing_argument_;
+  mutable CosetCache<Poly, Evals> coset_cache_;
+  device::NUMAPlacement numa_placement_ = device::NUMAPlacement::kFirstTouch;
 };
 
 }  // namespace tachyon::zk
@@ -15,9 +15,13 @@
 
 #include "openssl/blake2.h"
 
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
 #include "tachyon/base/strings/rust_stringifier.h"
 #include "tachyon/zk/plonk/halo2/constants.h"
 #include "tachyon/zk/plonk/keys/key.h"
+#include "tachyon/zk/plonk/keys/key_file.h"
 #include "tachyon/zk/plonk/permutation/permutation_verifying_key.h"
 
 namespace tachyon::zk {
@@ -62,6 +66,46 @@ class VerifyingKey : public Key<PCS> {
     return DoLoad(entity, std::move(result), nullptr);
   }
 
+  // Writes this key to |buffer| in the key file format. See key_file.h.
+  [[nodiscard]] bool WriteToKeyFile(const Entity<PCS>* entity,
+                                    base::Buffer* buffer) const {
+    KeyFileHeader header;
+    header.kind = KeyFileKind::kVerifyingKey;
+    header.n = entity->pcs().N();
+    header.field_size = sizeof(F);
+    return WriteKeyFileHeader(header, buffer) && WriteKeyFileBody(buffer);
+  }
+
+  // Return true if it is able to load from |buffer| written by
+  // |WriteToKeyFile()| for an instance of |Circuit|. Unlike |Load()|, this
+  // doesn't synthesize the circuit. This key is left as it was if it returns
+  // false.
+  template <typename Circuit>
+  [[nodiscard]] bool LoadFromKeyFile(Entity<PCS>* entity,
+                                     const base::Buffer& buffer) {
+    if (!ReadKeyFileHeader<F>(buffer, KeyFileKind::kVerifyingKey,
+                              entity->pcs().N())) {
+      return false;
+    }
+    VerifyingKey verifying_key;
+    if (!verifying_key.template ReadKeyFileBody<Circuit>(entity, buffer)) {
+      return false;
+    }
+    *this = std::move(verifying_key);
+    return true;
+  }
+
+  // Same as above, but it reads from the memory mapped file at |path|.
+  template <typename Circuit>
+  [[nodiscard]] bool LoadFromKeyFile(Entity<PCS>* entity,
+                                     const base::FilePath& path) {
+    base::MemoryMappedFile file;
+    if (!file.Initialize(path)) return false;
+    const base::Buffer buffer =
+        base::Buffer::CreateReadOnly(file.data(), file.length());
+    return LoadFromKeyFile<Circuit>(entity, buffer);
+  }
+
  private:
   friend class ProvingKey<PCS>;
 
@@ -83,16 +127,37 @@ class VerifyingKey : public Key<PCS> {
       load_result->permutations = std::move(permutations);
     }
 
-    const PCS& pcs = entity->pcs();
-    // TODO(chokobole): Parallelize this.
     fixed_commitments_ =
-        base::Map(pre_load_result.fixed_columns, [&pcs](const Evals& evals) {
-          Commitment commitment;
-          CHECK(pcs.CommitLagrange(evals, &commitment));
-          return commitment;
-        });
+        entity->BatchCommitLagrange(pre_load_result.fixed_columns);
+
+    SetTranscriptRepresentative(entity);
+    return true;
+  }
 
+  bool WriteKeyFileBody(base::Buffer* buffer) const {
+    return buffer->WriteMany(transcript_repr_, fixed_commitments_,
+                             permutation_verifying_Key_);
+  }
+
+  template <typename Circuit>
+  bool ReadKeyFileBody(Entity<PCS>* entity, const base::Buffer& buffer) {
+    ConstraintSystem<F> constraint_system;
+    Circuit::Configure(constraint_system);
+    if (!this->SetUpExtendedDomain(entity, constraint_system)) return false;
+    constraint_system_ = std::move(constraint_system);
+
+    F transcript_repr;
+    if (!buffer.ReadMany(&transcript_repr, &fixed_commitments_,
+                         &permutation_verifying_Key_)) {
+      return false;
+    }
+    // The transcript repr depends on the constraint system as well as the
+    // commitments. So it doesn't match if the key file is for another circuit.
     SetTranscriptRepresentative(entity);
+    if (transcript_repr_ != transcript_repr) {
+      LOG(ERROR) << "The key file is not for the circuit";
+      return false;
+    }
     return true;
   }
 
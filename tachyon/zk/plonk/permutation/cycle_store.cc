@@ -6,13 +6,48 @@
 
 #include "tachyon/zk/plonk/permutation/cycle_store.h"
 
+#include <limits>
 #include <utility>
 
+#include "tachyon/base/threading/task_pool.h"
+
 namespace tachyon::zk {
 
+CycleStore::CycleStore(size_t cols, size_t rows) : cols_(cols), rows_(rows) {
+  CHECK(rows == 0 ||
+        cols <= size_t{std::numeric_limits<uint32_t>::max()} / rows);
+  size_t cells = cols * rows;
+  next_.resize(cells);
+  parents_.resize(cells);
+  sizes_.resize(cells);
+  base::ParallelForRange(cells, [this](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      next_[i] = static_cast<uint32_t>(i);
+      parents_[i] = static_cast<uint32_t>(i);
+      sizes_[i] = 1;
+    }
+  });
+}
+
+CycleStore::Table<Label> CycleStore::mapping() const {
+  return BuildTable<Label>(
+      [this](uint32_t cell) { return ToLabel(next_[cell]); });
+}
+
+CycleStore::Table<Label> CycleStore::aux() const {
+  return BuildTable<Label>(
+      [this](uint32_t cell) { return ToLabel(FindRoot(cell)); });
+}
+
+CycleStore::Table<size_t> CycleStore::sizes() const {
+  return BuildTable<size_t>([this](uint32_t cell) { return sizes_[cell]; });
+}
+
 bool CycleStore::MergeCycle(const Label& label, const Label& label2) {
-  Label left_cycle_base = GetCycleBase(label);
-  Label right_cycle_base = GetCycleBase(label2);
+  uint32_t cell = ToCell(label);
+  uint32_t cell2 = ToCell(label2);
+  uint32_t left_cycle_base = FindRootAndCompressPath(cell);
+  uint32_t right_cycle_base = FindRootAndCompressPath(cell2);
   if (left_cycle_base == right_cycle_base) return false;
 
   // Ensure that the cell with a larger cycle size becomes the left.
@@ -22,32 +57,33 @@ bool CycleStore::MergeCycle(const Label& label, const Label& label2) {
 
   // Merge the right cycle into the left one.
   sizes_[left_cycle_base] += sizes_[right_cycle_base];
-  Label l = right_cycle_base;
-  while (true) {
-    aux_[l] = left_cycle_base;
-    l = mapping_[l];
-    if (l == right_cycle_base) {
-      break;
-    }
-  }
+  parents_[right_cycle_base] = left_cycle_base;
 
-  std::swap(mapping_[label], mapping_[label2]);
+  std::swap(next_[cell], next_[cell2]);
   return true;
 }
 
 std::vector<Label> CycleStore::GetAllLabels(const Label& label) const {
   std::vector<Label> ret;
-  Label base = GetCycleBase(label);
-  Label l = base;
-  ret.push_back(l);
+  uint32_t base = FindRoot(ToCell(label));
+  uint32_t cell = base;
+  ret.push_back(ToLabel(cell));
   while (true) {
-    l = mapping_[l];
-    ret.push_back(l);
-    if (l == base) {
+    cell = next_[cell];
+    ret.push_back(ToLabel(cell));
+    if (cell == base) {
       break;
     }
   }
   return ret;
 }
 
+uint32_t CycleStore::FindRootAndCompressPath(uint32_t cell) {
+  uint32_t root = FindRoot(cell);
+  while (parents_[cell] != root) {
+    cell = std::exchange(parents_[cell], root);
+  }
+  return root;
+}
+
 }  // namespace tachyon::zk
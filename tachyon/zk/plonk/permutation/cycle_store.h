@@ -7,10 +7,14 @@
 #ifndef TACHYON_ZK_PLONK_PERMUTATION_CYCLE_STORE_H_
 #define TACHYON_ZK_PLONK_PERMUTATION_CYCLE_STORE_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <utility>
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/export.h"
 #include "tachyon/zk/plonk/permutation/label.h"
 
@@ -61,6 +65,11 @@ namespace tachyon::zk {
 //
 //   CHECK_EQ(store.GetCycleSize(a), size_t{8});
 //
+// The cells are stored in flat arrays indexed by |col| * |rows| + |row| with
+// 32-bit indices, which takes 12 bytes per cell. The representatives are kept
+// as a disjoint-set forest with union by size and path compression instead of
+// relabeling every label of the smaller cycle on each merge.
+//
 // See
 // https://zcash.github.io/halo2/design/proving-system/permutation.html#algorithm.
 class TACHYON_EXPORT CycleStore {
@@ -89,37 +98,42 @@ class TACHYON_EXPORT CycleStore {
   };
 
   CycleStore() = default;
-  CycleStore(size_t cols, size_t rows) {
-    mapping_ = Table(base::CreateVector(cols, [rows](size_t col) {
-      return base::CreateVector(rows,
-                                [col](size_t row) { return Label(col, row); });
-    }));
-    aux_ = mapping_;
-    sizes_ =
-        Table(base::CreateVector(cols, base::CreateVector(rows, size_t{1})));
-  }
-
-  const Table<Label>& mapping() const { return mapping_; }
-  const Table<Label>& aux() const { return aux_; }
-  const Table<size_t>& sizes() const { return sizes_; }
-
-  // Return the next label of given |label| within a cycle.
-  const Label& GetNextLabel(const Label& label) const {
-    return mapping_[label];
+  CycleStore(size_t cols, size_t rows);
+
+  size_t cols() const { return cols_; }
+  size_t rows() const { return rows_; }
+
+  // The tables below are built from the flat arrays on each call, so they
+  // are meant to be used for testing.
+
+  // Return the next label for each label.
+  Table<Label> mapping() const;
+  // Return the representative of cycle for each label.
+  Table<Label> aux() const;
+  // Return the size of each cycle at its representative. The other entries
+  // are the sizes at the time they were representatives.
+  Table<size_t> sizes() const;
+
+  // Return the next label of given |label| within a cycle. This is safe to be
+  // called concurrently.
+  Label GetNextLabel(const Label& label) const {
+    return ToLabel(next_[ToCell(label)]);
   }
 
   // Return the representative of cycle of given |label|.
-  const Label& GetCycleBase(const Label& label) const { return aux_[label]; }
+  Label GetCycleBase(const Label& label) const {
+    return ToLabel(FindRoot(ToCell(label)));
+  }
 
   // Return the size of the representative of cycle of given |label|.
   size_t GetCycleSize(const Label& label) const {
-    return sizes_[GetCycleBase(label)];
+    return sizes_[FindRoot(ToCell(label))];
   }
 
   // Return whether the representative of cycles of given |label| and |label2|
   // belong to the same cycle.
   bool CheckSameCycle(const Label& label, const Label& label2) const {
-    return GetCycleBase(label) == GetCycleBase(label2);
+    return FindRoot(ToCell(label)) == FindRoot(ToCell(label2));
   }
 
   // Return false if the cycles of |label| and |label2| are same.
@@ -130,12 +144,47 @@ class TACHYON_EXPORT CycleStore {
   std::vector<Label> GetAllLabels(const Label& label) const;
 
  private:
-  // |mapping_| keeps track of the next label for each cycle.
-  Table<Label> mapping_;
-  // |aux_| keeps track of the cycle for each label.
-  Table<Label> aux_;
-  // |sizes_| keeps track of the size of each cycle.
-  Table<size_t> sizes_;
+  uint32_t ToCell(const Label& label) const {
+    DCHECK_LT(label.col, cols_);
+    DCHECK_LT(label.row, rows_);
+    return static_cast<uint32_t>(label.col * rows_ + label.row);
+  }
+
+  Label ToLabel(uint32_t cell) const {
+    return Label(cell / rows_, cell % rows_);
+  }
+
+  // Returns the root of the tree of |cell| without modifying the forest, so
+  // that it can be called concurrently. The depth of the trees is bounded by
+  // O(log n) thanks to the union by size.
+  uint32_t FindRoot(uint32_t cell) const {
+    while (parents_[cell] != cell) {
+      cell = parents_[cell];
+    }
+    return cell;
+  }
+
+  // Same as above, but makes every cell on the path point to the root.
+  uint32_t FindRootAndCompressPath(uint32_t cell);
+
+  template <typename T, typename Callback>
+  Table<T> BuildTable(Callback callback) const {
+    return Table<T>(base::CreateVector(cols_, [this, &callback](size_t col) {
+      return base::CreateVector(rows_, [this, col, &callback](size_t row) {
+        return static_cast<T>(callback(ToCell(Label(col, row))));
+      });
+    }));
+  }
+
+  size_t cols_ = 0;
+  size_t rows_ = 0;
+  // |next_| keeps track of the next cell for each cycle.
+  std::vector<uint32_t> next_;
+  // |parents_| keeps track of the parent of each cell in the disjoint-set
+  // forest, whose roots are the representatives of the cycles.
+  std::vector<uint32_t> parents_;
+  // |sizes_| keeps track of the size of each cycle at its root.
+  std::vector<uint32_t> sizes_;
 };
 
 }  // namespace tachyon::zk
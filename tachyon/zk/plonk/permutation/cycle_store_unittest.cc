@@ -50,4 +50,31 @@ TEST(CycleStoreTest, MergeCycle) {
   }
 }
 
+TEST(CycleStoreTest, MergeManyCycles) {
+  constexpr size_t kCols = 4;
+  constexpr size_t kRows = 256;
+
+  // Merges enough to build deep trees, which are compressed on the way.
+  CycleStore store(kCols, kRows);
+  for (size_t i = 0; i < kCols * kRows; ++i) {
+    Label label(base::Uniform(base::Range<size_t>(0, kCols)),
+                base::Uniform(base::Range<size_t>(0, kRows)));
+    Label label2(base::Uniform(base::Range<size_t>(0, kCols)),
+                 base::Uniform(base::Range<size_t>(0, kRows)));
+    store.MergeCycle(label, label2);
+  }
+
+  for (size_t col = 0; col < kCols; ++col) {
+    for (size_t row = 0; row < kRows; ++row) {
+      Label l(col, row);
+      // The cycle starts and ends at its base.
+      std::vector<Label> labels = store.GetAllLabels(l);
+      ASSERT_EQ(labels.size(), store.GetCycleSize(l) + 1);
+      for (const Label& label : labels) {
+        EXPECT_EQ(store.GetCycleBase(label), store.GetCycleBase(l));
+      }
+    }
+  }
+}
+
 }  // namespace tachyon::zk
@@ -1,14 +1,18 @@
 #ifndef TACHYON_ZK_PLONK_PERMUTATION_GRAND_PRODUCT_ARGUMENT_H_
 #define TACHYON_ZK_PLONK_PERMUTATION_GRAND_PRODUCT_ARGUMENT_H_
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/parallelize.h"
+#include "tachyon/device/buffer_pool.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/base/fraction_tiles.h"
 
 namespace tachyon::zk {
 
@@ -19,17 +23,19 @@ class GrandProductArgument {
   // case.
   template <typename PCS, typename Callable, typename Poly = typename PCS::Poly>
   static BlindedPolynomial<Poly> Commit(ProverBase<PCS>* prover,
-                                        Callable numerator_callback,
-                                        Callable denominator_callback) {
+                                        const Callable& numerator_callback,
+                                        const Callable& denominator_callback) {
     using Evals = typename PCS::Evals;
 
     size_t size = prover->pcs().N();
     size_t blinding_factors = prover->blinder().blinding_factors();
     Evals z = CreatePolynomial<Evals>(size, blinding_factors,
-                                      std::move(numerator_callback),
-                                      std::move(denominator_callback));
+                                      numerator_callback, denominator_callback);
     CHECK(prover->blinder().Blind(z));
-    return prover->CommitAndWriteToProofWithBlind(z);
+    BlindedPolynomial<Poly> ret = prover->CommitAndWriteToProofWithBlind(z);
+    device::BufferPool<typename Poly::Field>::GetInstance().Release(
+        std::move(z.evaluations()));
+    return ret;
   }
 
   // If the number of rows is out of the supported size of polynomial
@@ -39,19 +45,21 @@ class GrandProductArgument {
   // https://zcash.github.io/halo2/design/proving-system/permutation.html#spanning-a-large-number-of-columns
   template <typename PCS, typename Callable, typename F,
             typename Poly = typename PCS::Poly>
-  static BlindedPolynomial<Poly> CommitExcessive(ProverBase<PCS>* prover,
-                                                 Callable numerator_callback,
-                                                 Callable denominator_callback,
-                                                 size_t num_cols, F& last_z) {
+  static BlindedPolynomial<Poly> CommitExcessive(
+      ProverBase<PCS>* prover, const Callable& numerator_callback,
+      const Callable& denominator_callback, F& last_z) {
     using Evals = typename PCS::Evals;
 
     size_t size = prover->pcs().N();
     size_t blinding_factors = prover->blinder().blinding_factors();
     Evals z = CreatePolynomialExcessive<Evals>(
-        size, blinding_factors, num_cols, last_z, std::move(numerator_callback),
-        std::move(denominator_callback));
+        size, blinding_factors, last_z, numerator_callback,
+        denominator_callback);
     CHECK(prover->blinder().Blind(z));
-    return prover->CommitAndWriteToProofWithBlind(z);
+    BlindedPolynomial<Poly> ret = prover->CommitAndWriteToProofWithBlind(z);
+    device::BufferPool<typename Poly::Field>::GetInstance().Release(
+        std::move(z.evaluations()));
+    return ret;
   }
 
  private:
@@ -59,55 +67,66 @@ class GrandProductArgument {
 
   template <typename Evals, typename Callable>
   static Evals CreatePolynomial(size_t size, size_t blinding_factors,
-                                Callable numerator_callback,
-                                Callable denominator_callback) {
+                                const Callable& numerator_callback,
+                                const Callable& denominator_callback) {
     using F = typename Evals::Field;
 
-    std::vector<F> grand_product(size, F::Zero());
-
-    base::Parallelize(grand_product, std::move(denominator_callback));
-
-    F::BatchInverseInPlace(grand_product);
-
-    base::Parallelize(grand_product, std::move(numerator_callback));
+    std::vector<F> grand_product =
+        ComputeGrandProduct<F>(size, numerator_callback, denominator_callback);
 
     F last_z = F::One();
-    return DoCreatePolynomial<Evals>(last_z, size, grand_product,
-                                     blinding_factors);
+    Evals z = DoCreatePolynomial<Evals>(last_z, size, grand_product,
+                                        blinding_factors);
+    device::BufferPool<F>::GetInstance().Release(std::move(grand_product));
+    return z;
   }
 
   template <typename Evals, typename F, typename Callable>
   static Evals CreatePolynomialExcessive(size_t size, size_t blinding_factors,
-                                         size_t num_cols, F& last_z,
-                                         Callable numerator_callback,
-                                         Callable denominator_callback) {
-    std::vector<F> grand_product(size, F::Zero());
-
-    for (size_t i = 0; i < num_cols; ++i) {
-      base::Parallelize(grand_product, denominator_callback(i));
-    }
-
-    F::BatchInverseInPlace(grand_product);
-
-    for (size_t i = 0; i < num_cols; ++i) {
-      base::Parallelize(grand_product, numerator_callback(i));
-    }
+                                         F& last_z,
+                                         const Callable& numerator_callback,
+                                         const Callable& denominator_callback) {
+    std::vector<F> grand_product =
+        ComputeGrandProduct<F>(size, numerator_callback, denominator_callback);
+
+    Evals z = DoCreatePolynomial<Evals>(last_z, size, grand_product,
+                                        blinding_factors);
+    device::BufferPool<F>::GetInstance().Release(std::move(grand_product));
+    return z;
+  }
 
-    return DoCreatePolynomial<Evals>(last_z, size, grand_product,
-                                     blinding_factors);
+  // Returns [n₀ / d₀, n₁ / d₁, ..., nₙ₋₁ / dₙ₋₁]. See
+  // |ComputeFractionsInTiles()|. The returned buffer is acquired from
+  // |device::BufferPool|.
+  template <typename F, typename Callable>
+  static std::vector<F> ComputeGrandProduct(
+      size_t size, const Callable& numerator_callback,
+      const Callable& denominator_callback) {
+    std::vector<F> grand_product =
+        device::BufferPool<F>::GetInstance().Acquire(size);
+    ComputeFractionsInTiles(absl::MakeSpan(grand_product), numerator_callback,
+                            denominator_callback);
+    return grand_product;
   }
 
   template <typename Evals, typename F>
   static Evals DoCreatePolynomial(F& last_z, size_t size,
                                   const std::vector<F>& grand_product,
                                   size_t blinding_factors) {
-    std::vector<F> z;
-    z.resize(size);
+    // z = [last_z, last_z * g₀, last_z * g₀ * g₁, ...]
+    size_t usable_rows = size - blinding_factors;
+    // |z| is untracked, since it is returned as a polynomial of the proof.
+    std::vector<F> z =
+        device::BufferPool<F>::GetInstance().AcquireUntracked(size);
     z[0] = last_z;
-    for (size_t i = 0; i < size - blinding_factors - 1; ++i) {
-      z[i + 1] = z[i] * grand_product[i];
-    }
-    last_z = z[size - blinding_factors - 1];
+    std::copy(grand_product.begin(), grand_product.begin() + usable_rows - 1,
+              z.begin() + 1);
+    // The rows for the blinding factors are left to the blinder, but they are
+    // cleared since |z| may be a recycled buffer.
+    std::fill(z.begin() + usable_rows, z.end(), F::Zero());
+    absl::Span<F> usable_z = absl::MakeSpan(z).subspan(0, usable_rows);
+    F::PrefixProductsInPlace(usable_z);
+    last_z = z[usable_rows - 1];
     return Evals(std::move(z));
   }
 };
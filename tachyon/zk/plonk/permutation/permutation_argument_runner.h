@@ -7,7 +7,6 @@
 #ifndef TACHYON_ZK_PLONK_PERMUTATION_PERMUTATION_ARGUMENT_RUNNER_H_
 #define TACHYON_ZK_PLONK_PERMUTATION_PERMUTATION_ARGUMENT_RUNNER_H_
 
-#include <functional>
 #include <vector>
 
 #include "tachyon/base/parallelize.h"
@@ -64,16 +63,18 @@ class PermutationArgumentRunner {
       const PermutationProvingKey<Poly, Evals>& proving_key, const F& x);
 
  private:
+  // Returns a callback that multiplies the numerators of all the columns into
+  // the rows of a chunk.
   template <typename F>
-  static std::function<base::ParallelizeCallback3<F>(size_t)>
-  CreateNumeratorCallback(
+  static base::ParallelizeCallback3<F> CreateNumeratorCallback(
       const std::vector<base::Ref<const Evals>>& unpermuted_columns,
       const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
       const F& gamma);
 
+  // Returns a callback that multiplies the denominators of all the columns
+  // into the rows of a chunk.
   template <typename F>
-  static std::function<base::ParallelizeCallback3<F>(size_t)>
-  CreateDenominatorCallback(
+  static base::ParallelizeCallback3<F> CreateDenominatorCallback(
       const std::vector<base::Ref<const Evals>>& permuted_columns,
       const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
       const F& gamma);
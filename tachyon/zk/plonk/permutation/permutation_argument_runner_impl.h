@@ -7,10 +7,10 @@
 #ifndef TACHYON_ZK_PLONK_PERMUTATION_PERMUTATION_ARGUMENT_RUNNER_IMPL_H_
 #define TACHYON_ZK_PLONK_PERMUTATION_PERMUTATION_ARGUMENT_RUNNER_IMPL_H_
 
-#include <functional>
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/plonk/circuit/rotation.h"
@@ -55,20 +55,22 @@ PermutationArgumentRunner<Poly, Evals>::CommitArgument(
   for (size_t i = 0; i < chunk_num; ++i) {
     std::vector<base::Ref<const Evals>> permuted_columns =
         table_store.GetPermutedColumns(i);
-    std::vector<base::Ref<const Evals>> unpermuted_columns =
-        table_store.GetUnpermutedColumns(i);
+    // β * δⁱ is multiplied once per column rather than once per cell.
+    std::vector<F> beta_delta_powers =
+        base::Map(table_store.GetUnpermutedDeltaPowers(i),
+                  [&beta](const F& delta_power) { return beta * delta_power; });
     std::vector<base::Ref<const Evals>> value_columns =
         table_store.GetValueColumns(i);
 
-    size_t chunk_size = table_store.GetChunkSize(i);
     BlindedPolynomial<Poly> grand_product_poly =
         GrandProductArgument::CommitExcessive(
             prover,
-            CreateNumeratorCallback<F>(unpermuted_columns, value_columns, beta,
+            CreateNumeratorCallback<F>(table_store.GetUnpermutedOmegaPowers(),
+                                       beta_delta_powers, value_columns,
                                        gamma),
             CreateDenominatorCallback<F>(permuted_columns, value_columns, beta,
                                          gamma),
-            chunk_size, last_z);
+            last_z);
 
     grand_product_polys.push_back(std::move(grand_product_poly));
   }
@@ -176,47 +178,45 @@ void PermutationArgumentRunner<Poly, Evals>::EvaluateProvingKey(
 
 template <typename Poly, typename Evals>
 template <typename F>
-std::function<base::ParallelizeCallback3<F>(size_t)>
+base::ParallelizeCallback3<F>
 PermutationArgumentRunner<Poly, Evals>::CreateNumeratorCallback(
-    const std::vector<base::Ref<const Evals>>& unpermuted_columns,
-    const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
+    const std::vector<F>& omega_powers,
+    const std::vector<F>& beta_delta_powers,
+    const std::vector<base::Ref<const Evals>>& value_columns,
     const F& gamma) {
-  // vᵢ(ωʲ) + β * δⁱ * ωʲ + γ
-  return [&unpermuted_columns, &value_columns, &beta,
-          &gamma](size_t column_index) {
-    const Evals& unpermuted_values = *unpermuted_columns[column_index];
-    const Evals& values = *value_columns[column_index];
-    return [&unpermuted_values, &values, &beta, &gamma](
-               absl::Span<F> chunk, size_t chunk_index, size_t chunk_size_in) {
-      size_t i = chunk_index * chunk_size_in;
-      for (F& result : chunk) {
-        result *= *values[i] + beta * *unpermuted_values[i] + gamma;
-        ++i;
+  // Πᵢ(vᵢ(ωʲ) + β * δⁱ * ωʲ + γ)
+  return [&omega_powers, &beta_delta_powers, &value_columns, &gamma](
+             absl::Span<F> chunk, size_t chunk_index, size_t chunk_size) {
+    size_t start = chunk_index * chunk_size;
+    const F* omega_power = &omega_powers[start];
+    for (size_t i = 0; i < value_columns.size(); ++i) {
+      const F& beta_delta_power = beta_delta_powers[i];
+      const F* values = &value_columns[i]->evaluations()[start];
+      for (size_t j = 0; j < chunk.size(); ++j) {
+        chunk[j] *= values[j] + beta_delta_power * omega_power[j] + gamma;
       }
-    };
+    }
   };
 }
 
 template <typename Poly, typename Evals>
 template <typename F>
-std::function<base::ParallelizeCallback3<F>(size_t)>
+base::ParallelizeCallback3<F>
 PermutationArgumentRunner<Poly, Evals>::CreateDenominatorCallback(
     const std::vector<base::Ref<const Evals>>& permuted_columns,
     const std::vector<base::Ref<const Evals>>& value_columns, const F& beta,
     const F& gamma) {
-  // vᵢ(ωʲ) + β * sᵢ(ωʲ) + γ
-  return [&permuted_columns, &value_columns, &beta,
-          &gamma](size_t column_index) {
-    const Evals& permuted_values = *permuted_columns[column_index];
-    const Evals& values = *value_columns[column_index];
-    return [&permuted_values, &values, &beta, &gamma](
-               absl::Span<F> chunk, size_t chunk_index, size_t chunk_size_in) {
-      size_t i = chunk_index * chunk_size_in;
-      for (F& result : chunk) {
-        result *= *values[i] + beta * *permuted_values[i] + gamma;
-        ++i;
+  // Πᵢ(vᵢ(ωʲ) + β * sᵢ(ωʲ) + γ)
+  return [&permuted_columns, &value_columns, &beta, &gamma](
+             absl::Span<F> chunk, size_t chunk_index, size_t chunk_size) {
+    size_t start = chunk_index * chunk_size;
+    for (size_t i = 0; i < value_columns.size(); ++i) {
+      const F* permuted_values = &permuted_columns[i]->evaluations()[start];
+      const F* values = &value_columns[i]->evaluations()[start];
+      for (size_t j = 0; j < chunk.size(); ++j) {
+        chunk[j] *= values[j] + beta * permuted_values[j] + gamma;
       }
-    };
+    }
   };
 }
 
@@ -11,8 +11,7 @@
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
-#include "tachyon/base/openmp_util.h"
-#include "tachyon/base/parallelize.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/permutation/cycle_store.h"
 #include "tachyon/zk/plonk/permutation/label.h"
@@ -80,14 +79,9 @@ class PermutationAssembly {
 
   // Returns |PermutationVerifyingKey| which has commitments for permutations.
   constexpr PermutationVerifyingKey<PCS> BuildVerifyingKey(
-      const Entity<PCS>* entity, const std::vector<Evals>& permutations) const {
-    const PCS& pcs = entity->pcs();
+      Entity<PCS>* entity, const std::vector<Evals>& permutations) const {
     return PermutationVerifyingKey<PCS>(
-        base::Map(permutations, [&pcs](const Evals& permutation) {
-          Commitment commitment;
-          CHECK(pcs.CommitLagrange(permutation, &commitment));
-          return commitment;
-        }));
+        entity->BatchCommitLagrange(permutations));
   }
 
   // Returns the |PermutationProvingKey| that has the coefficient form and
@@ -95,17 +89,9 @@ class PermutationAssembly {
   constexpr PermutationProvingKey<Poly, Evals> BuildProvingKey(
       const ProverBase<PCS>* prover,
       const std::vector<Evals>& permutations) const {
-    const Domain* domain = prover->domain();
-
     // The polynomials of permutations with coefficients.
-    std::vector<Poly> polys;
-    polys.reserve(columns_.size());
-    for (size_t i = 0; i < columns_.size(); ++i) {
-      Poly poly = domain->IFFT(permutations[i]);
-      polys.push_back(std::move(poly));
-    }
-
-    return PermutationProvingKey<Poly, Evals>(std::move(permutations),
+    std::vector<Poly> polys = prover->domain()->BatchIFFT(permutations);
+    return PermutationProvingKey<Poly, Evals>(std::vector<Evals>(permutations),
                                               std::move(polys));
   }
 
@@ -121,16 +107,16 @@ class PermutationAssembly {
     std::vector<Evals> permutations =
         base::CreateVector(columns_.size(), domain->template Empty<Evals>());
 
-    // Assign |unpermuted_table| to |permutations|.
-    base::Parallelize(permutations, [&unpermuted_table, this](
-                                        absl::Span<Evals> chunk, size_t c,
-                                        size_t chunk_size) {
-      size_t i = c * chunk_size;
-      for (Evals& evals : chunk) {
-        for (size_t j = 0; j < rows_; ++j) {
-          *evals[j] = unpermuted_table[cycle_store_.GetNextLabel(Label(i, j))];
-        }
-        ++i;
+    // Assign |unpermuted_table| to |permutations|. |GetNextLabel()| doesn't
+    // modify |cycle_store_|, so that all the cells are assigned in parallel
+    // regardless of the number of columns.
+    size_t cells = columns_.size() * rows_;
+    base::ParallelForRange(cells, [this, &permutations, &unpermuted_table](
+                                      size_t begin, size_t end) {
+      for (size_t cell = begin; cell < end; ++cell) {
+        Label label(cell / rows_, cell % rows_);
+        *permutations[label.col][label.row] =
+            unpermuted_table[cycle_store_.GetNextLabel(label)];
       }
     });
     return permutations;
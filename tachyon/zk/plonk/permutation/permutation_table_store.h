@@ -59,9 +59,14 @@ class PermutationTableStore {
     return GetColumns(permuted_table_, chunk_idx);
   }
 
-  std::vector<base::Ref<const Evals>> GetUnpermutedColumns(
-      size_t chunk_idx) const {
-    return GetColumns(unpermuted_table_, chunk_idx);
+  // Returns the δⁱ of the columns in the chunk. The unpermuted columns aren't
+  // materialized. See |UnpermutedTable|.
+  absl::Span<const F> GetUnpermutedDeltaPowers(size_t chunk_idx) const {
+    return unpermuted_table_.GetDeltaPowers(GetChunkRange(chunk_idx));
+  }
+
+  const std::vector<F>& GetUnpermutedOmegaPowers() const {
+    return unpermuted_table_.omega_powers();
   }
 
  private:
@@ -75,12 +80,15 @@ class PermutationTableStore {
     return chunk_idx * chunk_size_;
   }
 
-  template <typename T>
-  auto GetColumns(const T& table, size_t chunk_idx) const {
+  base::Range<size_t> GetChunkRange(size_t chunk_idx) const {
     size_t chunk_offset = GetChunkOffset(chunk_idx);
     size_t chunk_size = GetChunkSize(chunk_idx);
-    return table.GetColumns(
-        base::Range<size_t>(chunk_offset, chunk_offset + chunk_size));
+    return base::Range<size_t>(chunk_offset, chunk_offset + chunk_size);
+  }
+
+  template <typename T>
+  auto GetColumns(const T& table, size_t chunk_idx) const {
+    return table.GetColumns(GetChunkRange(chunk_idx));
   }
 
   const std::vector<AnyColumnKey>& column_keys_;
@@ -36,8 +36,8 @@ class PermutationTableStoreTest : public halo2::ProverTest {
 
     unpermuted_table_ = UnpermutedTable<Evals>::Construct(
         column_keys_.size(), prover_->pcs().N(), prover_->domain());
-    for (const Evals& column : unpermuted_table_.table()) {
-      permutations_.push_back(column);
+    for (size_t i = 0; i < column_keys_.size(); ++i) {
+      permutations_.push_back(unpermuted_table_.GetColumn(i));
     }
     permuted_table_ = PermutedTable<Evals>(&permutations_);
   }
@@ -72,13 +72,20 @@ TEST_F(PermutationTableStoreTest, GetColumns) {
         permutation_table_store.GetValueColumns(i);
     std::vector<base::Ref<const Evals>> permuted_columns =
         permutation_table_store.GetPermutedColumns(i);
-    std::vector<base::Ref<const Evals>> unpermuted_columns =
-        permutation_table_store.GetUnpermutedColumns(i);
+    absl::Span<const F> delta_powers =
+        permutation_table_store.GetUnpermutedDeltaPowers(i);
 
     size_t start = permutation_table_store.GetChunkOffset(i);
     size_t chunk_size = permutation_table_store.GetChunkSize(i);
+    ASSERT_EQ(delta_powers.size(), chunk_size);
     for (size_t j = 0; j < chunk_size; ++j) {
-      EXPECT_EQ(*permuted_columns[j], *unpermuted_columns[j]);
+      const std::vector<F>& permuted_values =
+          permuted_columns[j]->evaluations();
+      for (size_t k = 0; k < permuted_values.size(); ++k) {
+        EXPECT_EQ(permuted_values[k],
+                  delta_powers[j] *
+                      permutation_table_store.GetUnpermutedOmegaPowers()[k]);
+      }
       EXPECT_EQ(*value_columns[j], expected_value_columns[start + j]);
     }
   }
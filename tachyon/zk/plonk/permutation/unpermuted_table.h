@@ -10,11 +10,11 @@
 #include <utility>
 #include <vector>
 
-#include "gtest/gtest_prod.h"
+#include "absl/types/span.h"
 
-#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/base/range.h"
-#include "tachyon/base/ref.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/zk/plonk/permutation/label.h"
 #include "tachyon/zk/plonk/permutation/permutation_utils.h"
 
@@ -27,34 +27,47 @@ namespace tachyon::zk {
 // Let modulus = 2ˢ * T + 1, then
 // |UnpermutedTable|
 // = [[δⁱω⁰, δⁱω¹, δⁱω², ..., δⁱωⁿ⁻¹] for i in range(0..T-1)]
+//
+// The table isn't materialized. Only [ω⁰, ω¹, ..., ωⁿ⁻¹] and
+// [δ⁰, δ¹, ..., δᶜ⁻¹] are stored, where c is the number of columns, and an
+// element is computed on demand with a single multiplication.
 template <typename Evals>
 class UnpermutedTable {
  public:
   using F = typename Evals::Field;
-  using Table = std::vector<Evals>;
 
   UnpermutedTable() = default;
 
-  const Table& table() const& { return table_; }
+  const std::vector<F>& omega_powers() const { return omega_powers_; }
+  const std::vector<F>& delta_powers() const { return delta_powers_; }
 
-  const F& operator[](const Label& label) const {
-    return *table_[label.col][label.row];
-  }
+  size_t cols() const { return delta_powers_.size(); }
+  size_t rows() const { return omega_powers_.size(); }
 
-  base::Ref<const Evals> GetColumn(size_t i) const {
-    return base::Ref<const Evals>(&table_[i]);
+  // Returns δⁱωʲ, where i is |label.col| and j is |label.row|.
+  F operator[](const Label& label) const {
+    return delta_powers_[label.col] * omega_powers_[label.row];
   }
 
-  std::vector<base::Ref<const Evals>> GetColumns(
-      base::Range<size_t> range) const {
-    CHECK_EQ(range.Intersect(base::Range<size_t>::Until(table_.size())), range);
+  // Returns [δⁱ for i in |range|].
+  absl::Span<const F> GetDeltaPowers(base::Range<size_t> range) const {
+    CHECK_EQ(range.Intersect(base::Range<size_t>::Until(cols())), range);
+    return absl::MakeConstSpan(delta_powers_)
+        .subspan(range.from, range.GetSize());
+  }
 
-    std::vector<base::Ref<const Evals>> ret;
-    ret.reserve(range.GetSize());
-    for (size_t i : range) {
-      ret.push_back(GetColumn(i));
-    }
-    return ret;
+  // Materializes the i-th column [δⁱω⁰, δⁱω¹, δⁱω², ..., δⁱωⁿ⁻¹].
+  Evals GetColumn(size_t i) const {
+    CHECK_LT(i, cols());
+    const F& delta_power = delta_powers_[i];
+    std::vector<F> column(rows());
+    base::ParallelForRange(column.size(), [this, &delta_power, &column](
+                                              size_t begin, size_t end) {
+      for (size_t j = begin; j < end; ++j) {
+        column[j] = delta_power * omega_powers_[j];
+      }
+    });
+    return Evals(std::move(column));
   }
 
   template <typename Domain>
@@ -66,29 +79,25 @@ class UnpermutedTable {
 
     // The δ is g^2ˢ with order T where modulus = 2ˢ * T + 1.
     F delta = GetDelta<F>();
-
-    Table unpermuted_table;
-    unpermuted_table.reserve(cols);
-    // Assign [δ⁰ω⁰, δ⁰ω¹, δ⁰ω², ..., δ⁰ωⁿ⁻¹] to the first col.
-    unpermuted_table.push_back(Evals(std::move(omega_powers)));
-
-    // Assign [δⁱω⁰, δⁱω¹, δⁱω², ..., δⁱωⁿ⁻¹] to each col.
-    for (size_t i = 1; i < cols; ++i) {
-      std::vector<F> col = base::CreateVector(rows, F::Zero());
-      // TODO(dongchangYoo): Optimize this with
-      // https://github.com/kroma-network/tachyon/pull/115.
-      for (size_t j = 0; j < rows; ++j) {
-        col[j] = *unpermuted_table[i - 1][j] * delta;
-      }
-      unpermuted_table.push_back(Evals(std::move(col)));
+    std::vector<F> delta_powers;
+    delta_powers.reserve(cols);
+    F delta_power = F::One();
+    for (size_t i = 0; i < cols; ++i) {
+      delta_powers.push_back(delta_power);
+      delta_power *= delta;
     }
-    return UnpermutedTable(std::move(unpermuted_table));
+    return UnpermutedTable(std::move(omega_powers), std::move(delta_powers));
   }
 
  private:
-  explicit UnpermutedTable(Table table) : table_(std::move(table)) {}
-
-  Table table_;
+  UnpermutedTable(std::vector<F> omega_powers, std::vector<F> delta_powers)
+      : omega_powers_(std::move(omega_powers)),
+        delta_powers_(std::move(delta_powers)) {}
+
+  // [ω⁰, ω¹, ω², ..., ωⁿ⁻¹]
+  std::vector<F> omega_powers_;
+  // [δ⁰, δ¹, δ², ..., δᶜ⁻¹]
+  std::vector<F> delta_powers_;
 };
 
 }  // namespace tachyon::zk
@@ -48,30 +48,30 @@ TEST_F(UnpermutedTableTest, Construct) {
   }
 }
 
-TEST_F(UnpermutedTableTest, GetColumns) {
+TEST_F(UnpermutedTableTest, GetColumn) {
   const Domain* domain = prover_->domain();
 
   const F& omega = domain->group_gen();
   const F delta = GetDelta<F>();
   size_t n = prover_->pcs().N();
   std::vector<F> omega_powers = domain->GetRootsOfUnity(n, omega);
-  for (F& omega_power : omega_powers) {
-    omega_power *= delta;
+  for (size_t i = 0; i < kCols; ++i) {
+    Evals column = unpermuted_table_.GetColumn(i);
+    EXPECT_EQ(column.evaluations(), omega_powers);
+    for (F& omega_power : omega_powers) {
+      omega_power *= delta;
+    }
   }
+}
 
-  base::Ref<const Evals> column = unpermuted_table_.GetColumn(1);
-  for (size_t i = 0; i < n; ++i) {
-    EXPECT_EQ(omega_powers[i], *(*column)[i]);
-  }
+TEST_F(UnpermutedTableTest, GetDeltaPowers) {
+  const F delta = GetDelta<F>();
 
-  std::vector<base::Ref<const Evals>> columns =
-      unpermuted_table_.GetColumns(base::Range<size_t>(2, 4));
-  for (size_t i = 0; i < 2; ++i) {
-    for (size_t j = 0; j < n; ++j) {
-      omega_powers[j] *= delta;
-      EXPECT_EQ(omega_powers[j], *(*columns[i])[j]);
-    }
-  }
+  absl::Span<const F> delta_powers =
+      unpermuted_table_.GetDeltaPowers(base::Range<size_t>(1, 3));
+  ASSERT_EQ(delta_powers.size(), 2);
+  EXPECT_EQ(delta_powers[0], delta);
+  EXPECT_EQ(delta_powers[1], delta.Square());
 }
 
 }  // namespace tachyon::zk
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/plonk/constraint_system.h"
 #include "tachyon/zk/plonk/prover/witness_collection.h"
@@ -39,7 +40,18 @@ class Synthesizer {
     }
   }
 
+  bool parallel_synthesis() const { return parallel_synthesis_; }
+  void set_parallel_synthesis(bool parallel_synthesis) {
+    parallel_synthesis_ = parallel_synthesis;
+  }
+
   // Synthesize circuit and store advice columns.
+  //
+  // For each phase, the circuits are synthesized first and their advice
+  // columns are committed afterwards. If |parallel_synthesis_| is set, the
+  // circuits are synthesized concurrently. Either way, the commitments and the
+  // blinds are drawn in the order of the |circuits|, so that the transcript
+  // doesn't depend on the mode.
   template <typename Circuit>
   void GenerateAdviceColumns(
       ProverBase<PCS>* prover, std::vector<Circuit>& circuits,
@@ -51,34 +63,45 @@ class Synthesizer {
         Circuit::Configure(empty_constraint_system);
 
     for (Phase current_phase : constraint_system_->GetPhases()) {
+      // Parse only indices related to the |current_phase|.
+      std::vector<size_t> column_indices;
+      const std::vector<Phase>& phases =
+          constraint_system_->advice_column_phases();
+      for (size_t i = 0; i < phases.size(); ++i) {
+        if (current_phase == phases[i]) column_indices.push_back(i);
+      }
+
+      std::vector<std::vector<Evals>> advice_columns_vec(num_circuits_);
+      if (parallel_synthesis_) {
+        base::ParallelFor(num_circuits_, [this, prover, current_phase,
+                                          &column_indices,
+                                          &instance_columns_vec, &circuits,
+                                          &config,
+                                          &advice_columns_vec](size_t i) {
+          advice_columns_vec[i] =
+              GenerateAdvices(prover, current_phase, column_indices,
+                              instance_columns_vec[i], circuits[i], config);
+        });
+      } else {
+        for (size_t i = 0; i < num_circuits_; ++i) {
+          advice_columns_vec[i] =
+              GenerateAdvices(prover, current_phase, column_indices,
+                              instance_columns_vec[i], circuits[i], config);
+        }
+      }
+
       for (size_t i = 0; i < num_circuits_; ++i) {
-        std::vector<RationalEvals> rational_advice_columns =
-            GenerateRationalAdvices(prover, current_phase,
-                                    instance_columns_vec[i], circuits[i],
-                                    config);
-
-        // Parse only indices related to the |current_phase|.
-        const std::vector<Phase>& phases =
-            constraint_system_->challenge_phases();
         if constexpr (PCS::kSupportsBatchMode) {
-          prover->pcs().SetBatchMode(phases.size());
+          prover->pcs().SetBatchMode(column_indices.size());
         }
-        for (size_t j = 0; j < phases.size(); ++i) {
-          if (current_phase != phases[j]) continue;
-          const RationalEvals& column = rational_advice_columns[j];
-          std::vector<F> evaluated;
-          CHECK(math::RationalField<F>::BatchEvaluate(column.evaluations(),
-                                                      &evaluated));
-          // Add blinding factors to advice columns
-          evaluated[prover->pcs().N() - 1] = F::One();
-
-          Evals evaluated_evals(std::move(evaluated));
+        for (size_t j = 0; j < column_indices.size(); ++j) {
+          Evals& evals = advice_columns_vec[i][j];
           if constexpr (PCS::kSupportsBatchMode) {
-            prover->BatchCommitAt(evaluated_evals, j);
+            prover->BatchCommitAt(evals, j);
           } else {
-            prover->CommitAndWriteToProof(evaluated_evals);
+            prover->CommitAndWriteToProof(evals);
           }
-          SetAdviceColumn(i, j, std::move(evaluated_evals),
+          SetAdviceColumn(i, column_indices[j], std::move(evals),
                           prover->blinder().Generate());
         }
         if constexpr (PCS::kSupportsBatchMode) {
@@ -107,12 +130,14 @@ class Synthesizer {
   }
 
   // Performs synthesis for a specific |circuit| and a specific |phase|, and
-  // returns a vector of |RationalEvals|.
+  // returns the evaluated advice columns at |column_indices|. This only reads
+  // from the |prover|, so that it can run for many circuits concurrently.
   template <typename Circuit>
-  std::vector<RationalEvals> GenerateRationalAdvices(
-      ProverBase<PCS>* prover, const Phase phase,
+  std::vector<Evals> GenerateAdvices(
+      const ProverBase<PCS>* prover, const Phase phase,
+      const std::vector<size_t>& column_indices,
       const std::vector<Evals>& instance_columns, Circuit& circuit,
-      const typename Circuit::Config& config) {
+      const typename Circuit::Config& config) const {
     // The prover will not be allowed to assign values to advice
     // cells that exist within inactive rows, which include some
     // number of blinding factors and an extra row for use in the
@@ -125,7 +150,13 @@ class Synthesizer {
     floor_planner.Synthesize(&witness, circuit, config.Clone(),
                              constraint_system_->constants());
 
-    return std::move(witness).TakeAdvices();
+    std::vector<Evals> advice_columns =
+        std::move(witness).TakeAdvices(column_indices);
+    for (Evals& advice_column : advice_columns) {
+      // Add blinding factors to advice columns
+      *advice_column[prover->pcs().N() - 1] = F::One();
+    }
+    return advice_columns;
   }
 
   void UpdateChallenges(ProverBase<PCS>* prover, const Phase phase) {
@@ -143,6 +174,9 @@ class Synthesizer {
   // not owned
   const ConstraintSystem<F>* constraint_system_ = nullptr;
 
+  // If set, the circuits are synthesized concurrently in
+  // |GenerateAdviceColumns()|.
+  bool parallel_synthesis_ = false;
   absl::btree_map<size_t, F> challenges_;
   std::vector<std::vector<Evals>> advice_columns_vec_;
   std::vector<std::vector<F>> advice_blinds_vec_;
@@ -54,4 +54,28 @@ TEST_F(SynthesizerTest, GenerateAdviceColumns) {
   std::vector<F> challenges = synthesizer_.ExportChallenges();
 }
 
+TEST_F(SynthesizerTest, ParallelSynthesis) {
+  std::vector<std::vector<Evals>> instance_columns_vec =
+      base::CreateVector(circuits_.size(), [this]() {
+        return base::CreateVector(1, prover_->domain()->Random<Evals>());
+      });
+  synthesizer_.GenerateAdviceColumns(prover_.get(), circuits_,
+                                     instance_columns_vec);
+  std::vector<uint8_t> expected_proof =
+      prover_->GetWriter()->buffer().owned_buffer();
+  std::vector<F> expected_challenges = synthesizer_.ExportChallenges();
+
+  // Recreates the prover, so that it starts from the same transcript and
+  // blinder as above.
+  halo2::ProverTest::SetUp();
+  Synthesizer<PCS> synthesizer(circuits_.size(),
+                               &verifying_key_.constraint_system());
+  synthesizer.set_parallel_synthesis(true);
+  synthesizer.GenerateAdviceColumns(prover_.get(), circuits_,
+                                    instance_columns_vec);
+
+  EXPECT_EQ(prover_->GetWriter()->buffer().owned_buffer(), expected_proof);
+  EXPECT_EQ(synthesizer.ExportChallenges(), expected_challenges);
+}
+
 }  // namespace tachyon::zk
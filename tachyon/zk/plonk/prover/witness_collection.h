@@ -14,7 +14,9 @@
 #include "absl/container/btree_map.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/base/range.h"
+#include "tachyon/base/threading/task_pool.h"
 #include "tachyon/zk/plonk/circuit/assignment.h"
 #include "tachyon/zk/plonk/circuit/phase.h"
 
@@ -35,15 +37,41 @@ class WitnessCollection : public Assignment<typename PCS::Field> {
                     const absl::btree_map<size_t, F>& challenges,
                     const std::vector<Evals>& instance_columns)
       : advices_(base::CreateVector(num_advice_columns,
-                                    domain->template Empty<RationalEvals>())),
+                                    domain->template Empty<Evals>())),
+        advice_denominators_(num_advice_columns),
         usable_rows_(base::Range<size_t>::Until(usable_rows)),
         current_phase_(current_phase),
         challenges_(challenges),
         instance_columns_(instance_columns) {}
 
+  // Returns true if a value with a denominator other than one has been
+  // assigned to the advice column at |column_index|.
+  bool IsRationalAdvice(size_t column_index) const {
+    return !advice_denominators_[column_index].empty();
+  }
+
+  // Returns the advice columns at |column_indices| with their denominators
+  // divided out. Only the rational columns are batch inverted, the others
+  // are returned as they are.
   // NOTE(dongchangYoo): This getter of |advices| transfers ownership as well.
   // That's why, |WitnessCollection| will be released as soon as emitting it.
-  std::vector<RationalEvals>&& TakeAdvices() && { return std::move(advices_); }
+  std::vector<Evals> TakeAdvices(const std::vector<size_t>& column_indices) && {
+    return base::Map(column_indices, [this](size_t column_index) {
+      std::vector<F>& numerators = advices_[column_index].evaluations();
+      std::vector<F>& denominators = advice_denominators_[column_index];
+      if (!denominators.empty()) {
+        CHECK(F::BatchInverseInPlace(denominators));
+        base::ParallelForRange(numerators.size(), [&numerators,
+                                                   &denominators](size_t begin,
+                                                                  size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            numerators[i] *= denominators[i];
+          }
+        });
+      }
+      return std::move(advices_[column_index]);
+    });
+  }
   const Phase current_phase() const { return current_phase_; }
   const base::Range<size_t>& usable_rows() const { return usable_rows_; }
   const absl::btree_map<size_t, F>& challenges() const { return challenges_; }
@@ -66,7 +94,18 @@ class WitnessCollection : public Assignment<typename PCS::Field> {
     CHECK(usable_rows_.Contains(row));
     CHECK_LT(column.index(), advices_.size());
 
-    *advices_[column.index()][row] = std::move(assign).Run().value();
+    math::RationalField<F> value = std::move(assign).Run().value();
+    std::vector<F>& denominators = advice_denominators_[column.index()];
+    if (denominators.empty() && !value.denominator().IsOne()) {
+      // The column turns into a rational one, whose cells assigned so far all
+      // have a denominator of one.
+      denominators = base::CreateVector(advices_[column.index()].NumElements(),
+                                        F::One());
+    }
+    *advices_[column.index()][row] = value.numerator();
+    if (!denominators.empty()) {
+      denominators[row] = value.denominator();
+    }
   }
 
   Value<F> GetChallenge(const Challenge& challenge) override {
@@ -75,7 +114,12 @@ class WitnessCollection : public Assignment<typename PCS::Field> {
   }
 
  private:
-  std::vector<RationalEvals> advices_;
+  // The numerators of the advice columns.
+  std::vector<Evals> advices_;
+  // The denominators of the advice columns. These are empty until a value
+  // with a denominator other than one is assigned to the column, so that the
+  // plain columns are neither stored nor evaluated as rational ones.
+  std::vector<std::vector<F>> advice_denominators_;
   base::Range<size_t> usable_rows_;
   Phase current_phase_;
   absl::btree_map<size_t, F> challenges_;
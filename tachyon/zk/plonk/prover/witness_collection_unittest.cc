@@ -18,7 +18,6 @@ namespace {
 class WitnessCollectionTest : public halo2::ProverTest {
  public:
   using F = typename PCS::Field;
-  using RationalEvals = typename PCS::RationalEvals;
 
   void SetUp() override {
     halo2::ProverTest::SetUp();
@@ -65,11 +64,36 @@ TEST_F(WitnessCollectionTest, AssignAdvice) {
       "", AdviceColumnKey(col), row, [value_to_be_assign]() {
         return Value<math::RationalField<F>>::Known(value_to_be_assign);
       });
+  EXPECT_FALSE(witness_collection_.IsRationalAdvice(col));
 
-  std::vector<RationalEvals> rational_advice_columns =
-      std::move(witness_collection_).TakeAdvices();
-  const RationalEvals& rational_column = rational_advice_columns[col];
-  EXPECT_EQ(value_to_be_assign, *rational_column[row]);
+  std::vector<Evals> advice_columns =
+      std::move(witness_collection_).TakeAdvices({col});
+  EXPECT_EQ(value_to_be_assign.Evaluate(), *advice_columns[0][row]);
+}
+
+TEST_F(WitnessCollectionTest, AssignRationalAdvice) {
+  math::RationalField<F> value_to_be_assign(F::Random(), F::Random());
+  math::RationalField<F> plain_value_to_be_assign(F::Random());
+  size_t col = 1;
+  size_t row = 10;
+  size_t plain_row = 11;
+
+  witness_collection_.AssignAdvice(
+      "", AdviceColumnKey(col), plain_row, [plain_value_to_be_assign]() {
+        return Value<math::RationalField<F>>::Known(plain_value_to_be_assign);
+      });
+  EXPECT_FALSE(witness_collection_.IsRationalAdvice(col));
+  witness_collection_.AssignAdvice(
+      "", AdviceColumnKey(col), row, [value_to_be_assign]() {
+        return Value<math::RationalField<F>>::Known(value_to_be_assign);
+      });
+  EXPECT_TRUE(witness_collection_.IsRationalAdvice(col));
+
+  std::vector<Evals> advice_columns =
+      std::move(witness_collection_).TakeAdvices({col});
+  EXPECT_EQ(value_to_be_assign.Evaluate(), *advice_columns[0][row]);
+  EXPECT_EQ(plain_value_to_be_assign.Evaluate(),
+            *advice_columns[0][plain_row]);
 }
 
 TEST_F(WitnessCollectionTest, GetChallenge) {
@@ -7,6 +7,7 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_CALCULATION_H_
 #define TACHYON_ZK_PLONK_VANISHING_CALCULATION_H_
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,6 +16,7 @@
 
 #include "tachyon/base/logging.h"
 #include "tachyon/export.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_block.h"
 #include "tachyon/zk/plonk/vanishing/evaluation_input.h"
 #include "tachyon/zk/plonk/vanishing/value_source.h"
 
@@ -104,8 +106,109 @@ class TACHYON_EXPORT Calculation {
     return F();
   }
 
+  // Same as |Evaluate()|, but evaluates all the rows of |block| at once and
+  // writes the results to |out|. Since the operands are resolved once per
+  // block, the inner loops run over contiguous values without branching.
+  template <typename Poly, typename Evals, typename F>
+  void EvaluateBlock(const EvaluationInput<Poly, Evals>& data,
+                     const EvaluationBlock<F>& block,
+                     const std::vector<F>& constants, F* out) const {
+    size_t size = block.size();
+    switch (type_) {
+      case Type::kAdd:
+        EvaluateBinary(pair().left.GetBlock(data, block, constants),
+                       pair().right.GetBlock(data, block, constants), size,
+                       out, [](const F& a, const F& b) { return a + b; });
+        return;
+      case Type::kSub:
+        EvaluateBinary(pair().left.GetBlock(data, block, constants),
+                       pair().right.GetBlock(data, block, constants), size,
+                       out, [](const F& a, const F& b) { return a - b; });
+        return;
+      case Type::kMul:
+        EvaluateBinary(pair().left.GetBlock(data, block, constants),
+                       pair().right.GetBlock(data, block, constants), size,
+                       out, [](const F& a, const F& b) { return a * b; });
+        return;
+      case Type::kSquare:
+        EvaluateUnary(value().GetBlock(data, block, constants), size, out,
+                      [](const F& a) { return a.Square(); });
+        return;
+      case Type::kDouble:
+        EvaluateUnary(value().GetBlock(data, block, constants), size, out,
+                      [](const F& a) { return a.Double(); });
+        return;
+      case Type::kNegate:
+        EvaluateUnary(value().GetBlock(data, block, constants), size, out,
+                      [](const F& a) { return -a; });
+        return;
+      case Type::kStore:
+        EvaluateUnary(value().GetBlock(data, block, constants), size, out,
+                      [](const F& a) { return a; });
+        return;
+      case Type::kHorner: {
+        const HornerData& honer = horner();
+        BlockValue<F> factor = honer.factor.GetBlock(data, block, constants);
+        EvaluateUnary(honer.init.GetBlock(data, block, constants), size, out,
+                      [](const F& a) { return a; });
+        for (const ValueSource& part : honer.parts) {
+          BlockValue<F> part_values = part.GetBlock(data, block, constants);
+          for (size_t i = 0; i < size; ++i) {
+            out[i] *= factor[i];
+            out[i] += part_values[i];
+          }
+        }
+        return;
+      }
+    }
+    NOTREACHED();
+  }
+
   std::string ToString() const;
 
+  // Calls |callback| with every operand of this calculation.
+  template <typename Callback>
+  void ForEachValueSource(Callback callback) const {
+    if (value_.has_value()) callback(*value_);
+    if (pair_.has_value()) {
+      callback(pair_->left);
+      callback(pair_->right);
+    }
+    if (horner_.has_value()) {
+      callback(horner_->init);
+      for (const ValueSource& part : horner_->parts) {
+        callback(part);
+      }
+      callback(horner_->factor);
+    }
+  }
+
+  // Same as above, but |callback| may replace the operands.
+  template <typename Callback>
+  void ForEachValueSource(Callback callback) {
+    if (value_.has_value()) callback(*value_);
+    if (pair_.has_value()) {
+      callback(pair_->left);
+      callback(pair_->right);
+    }
+    if (horner_.has_value()) {
+      callback(horner_->init);
+      for (ValueSource& part : horner_->parts) {
+        callback(part);
+      }
+      callback(horner_->factor);
+    }
+  }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const Calculation& calculation) {
+    h = H::combine(std::move(h), calculation.type_);
+    calculation.ForEachValueSource([&h](const ValueSource& value) {
+      h = H::combine(std::move(h), value);
+    });
+    return h;
+  }
+
  private:
   struct Pair {
     ValueSource left;
@@ -140,6 +243,41 @@ class TACHYON_EXPORT Calculation {
     }
   };
 
+  template <typename F, typename Op>
+  static void EvaluateUnary(const BlockValue<F>& a, size_t size, F* out,
+                            Op op) {
+    if (a.is_scalar()) {
+      std::fill_n(out, size, op(*a.values()));
+    } else {
+      const F* a_values = a.values();
+      for (size_t i = 0; i < size; ++i) {
+        out[i] = op(a_values[i]);
+      }
+    }
+  }
+
+  template <typename F, typename Op>
+  static void EvaluateBinary(const BlockValue<F>& a, const BlockValue<F>& b,
+                             size_t size, F* out, Op op) {
+    const F* a_values = a.values();
+    const F* b_values = b.values();
+    if (a.is_scalar() && b.is_scalar()) {
+      std::fill_n(out, size, op(*a_values, *b_values));
+    } else if (a.is_scalar()) {
+      for (size_t i = 0; i < size; ++i) {
+        out[i] = op(*a_values, b_values[i]);
+      }
+    } else if (b.is_scalar()) {
+      for (size_t i = 0; i < size; ++i) {
+        out[i] = op(a_values[i], *b_values);
+      }
+    } else {
+      for (size_t i = 0; i < size; ++i) {
+        out[i] = op(a_values[i], b_values[i]);
+      }
+    }
+  }
+
   explicit Calculation(Type type) : type_(type) {}
   Calculation(Type type, const ValueSource& value)
       : type_(type), value_(value) {}
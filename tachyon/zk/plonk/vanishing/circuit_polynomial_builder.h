@@ -7,6 +7,7 @@
 #define TACHYON_ZK_PLONK_VANISHING_CIRCUIT_POLYNOMIAL_BUILDER_H_
 
 #include <iostream>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -15,15 +16,19 @@
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/numerics/checked_math.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/device/buffer_pool.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_committed.h"
 #include "tachyon/zk/lookup/lookup_committed.h"
+#include "tachyon/zk/lookup/lookup_pair.h"
 #include "tachyon/zk/plonk/circuit/column_key.h"
-#include "tachyon/zk/plonk/circuit/owned_table.h"
 #include "tachyon/zk/plonk/circuit/ref_table.h"
 #include "tachyon/zk/plonk/circuit/rotation.h"
 #include "tachyon/zk/plonk/permutation/permutation_committed.h"
 #include "tachyon/zk/plonk/permutation/unpermuted_table.h"
+#include "tachyon/zk/plonk/vanishing/coset_cache.h"
 #include "tachyon/zk/plonk/vanishing/evaluation_input.h"
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
+#include "tachyon/zk/plonk/vanishing/permutation_evaluator.h"
 #include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
 
 namespace tachyon::zk {
@@ -55,11 +60,14 @@ class CircuitPolynomialBuilder {
       const std::vector<PermutationCommitted<Poly>>* committed_permutations,
       const std::vector<std::vector<LookupCommitted<Poly>>>*
           committed_lookups_vec,
+      const std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>*
+          committed_log_derivative_lookups_vec,
       const std::vector<RefTable<Poly>>* poly_tables) {
     CircuitPolynomialBuilder builder;
     builder.domain_ = domain;
 
     builder.n_ = static_cast<int32_t>(n);
+    builder.usable_rows_ = n - (blinding_factors + 1);
     builder.num_parts_ = extended_domain->size() >> domain->log_size_of_group();
     builder.chunk_len_ = cs_degree - 2;
 
@@ -80,6 +88,8 @@ class CircuitPolynomialBuilder {
     builder.proving_key_ = proving_key;
     builder.committed_permutations_ = committed_permutations;
     builder.committed_lookups_vec_ = committed_lookups_vec;
+    builder.committed_log_derivative_lookups_vec_ =
+        committed_log_derivative_lookups_vec;
     builder.poly_tables_ = poly_tables;
 
     return builder;
@@ -91,20 +101,24 @@ class CircuitPolynomialBuilder {
 
   // Returns an evaluation-formed polynomial as below.
   // - gate₀(X) + y * gate₁(X) + ... + yⁱ * gateᵢ(X) + ...
+  // Either |lookup_evaluators| or |log_derivative_lookup_evaluators| is used
+  // depending on which of the committed lookups is given to |Create()|.
   ExtendedEvals BuildExtendedCircuitColumn(
       const GraphEvaluator<F>& custom_gate_evaluator,
-      const std::vector<GraphEvaluator<F>>& lookup_evaluators) {
+      const std::vector<GraphEvaluator<F>>& lookup_evaluators,
+      const std::vector<LookupPair<GraphEvaluator<F>>>&
+          log_derivative_lookup_evaluators) {
     std::vector<std::vector<F>> value_parts;
     value_parts.reserve(num_parts_);
     // Calculate the quotient polynomial for each part
     for (size_t i = 0; i < num_parts_; ++i) {
-      UpdateVanishingProvingKey();
+      UpdateVanishingProvingKey(i);
 
-      std::vector<F> value_part =
-          base::CreateVector(static_cast<size_t>(n_), F::Zero());
+      std::vector<F> value_part = device::BufferPool<F>::GetInstance().Acquire(
+          static_cast<size_t>(n_), F::Zero());
       size_t circuit_num = poly_tables_->size();
       for (size_t j = 0; j < circuit_num; ++j) {
-        UpdateVanishingTable(j);
+        UpdateVanishingTable(i, j);
         UpdateValuesByCustomGates(custom_gate_evaluator, value_part);
 
         // Do iff there are permutation constraints.
@@ -112,14 +126,29 @@ class CircuitPolynomialBuilder {
           UpdateVanishingPermutation(j);
           UpdateValuesByPermutation(value_part);
         }
-        if ((*committed_lookups_vec_)[j].size() > 0) {
+        if (committed_lookups_vec_ &&
+            (*committed_lookups_vec_)[j].size() > 0) {
           UpdateVanishingLookups(j);
           UpdateValuesByLookups(lookup_evaluators, value_part);
         }
+        if (committed_log_derivative_lookups_vec_ &&
+            (*committed_log_derivative_lookups_vec_)[j].size() > 0) {
+          UpdateVanishingLogDerivativeLookups(j);
+          UpdateValuesByLogDerivativeLookups(log_derivative_lookup_evaluators,
+                                             value_part);
+        }
       }
       value_parts.push_back(std::move(value_part));
       UpdateCurrentExtendedOmega();
     }
+    ReleaseToBufferPool(advice_cosets_);
+    ReleaseToBufferPool(instance_cosets_);
+    ReleaseToBufferPool(permutation_product_cosets_);
+    ReleaseToBufferPool(lookup_product_cosets_);
+    ReleaseToBufferPool(lookup_input_cosets_);
+    ReleaseToBufferPool(lookup_table_cosets_);
+    ReleaseToBufferPool(lookup_multiplicities_cosets_);
+    ReleaseToBufferPool(lookup_grand_sum_cosets_);
     std::vector<F> extended =
         BuildExtendedColumnWithColumns(std::move(value_parts));
     return ExtendedEvals(std::move(extended));
@@ -137,16 +166,22 @@ class CircuitPolynomialBuilder {
         const Evals& input_coset = lookup_input_cosets_[i];
         const Evals& table_coset = lookup_input_cosets_[i];
         const Evals& product_coset = lookup_product_cosets_[i];
+        const Evals& l_first = *l_first_;
+        const Evals& l_last = *l_last_;
+        const Evals& l_active_row = *l_active_row_;
 
         EvaluationInput<Poly, Evals> evaluation_input = ExtractEvaluationInput(
             ev.CreateInitialIntermediates(), ev.CreateEmptyRotations());
+        ev.EvaluateInvariants(evaluation_input);
 
         size_t start = chunk_offset * chunk_size;
+        std::vector<F> table_values =
+            base::CreateVector(chunk.size(), F::Zero());
+        ev.EvaluateRows(evaluation_input, start, rot_scale_,
+                        absl::MakeSpan(table_values));
         for (size_t j = 0; j < chunk.size(); ++j) {
           size_t idx = start + j;
-
-          F zero = F::Zero();
-          F table_value = ev.Evaluate(evaluation_input, idx, rot_scale_, zero);
+          const F& table_value = table_values[j];
 
           size_t r_next = Rotation(1).GetIndex(idx, rot_scale_, n_);
           size_t r_prev = Rotation(-1).GetIndex(idx, rot_scale_, n_);
@@ -155,12 +190,12 @@ class CircuitPolynomialBuilder {
 
           // l_first(X) * (1 - z(X)) = 0
           chunk[j] *= *y_;
-          chunk[j] += (one_ - *product_coset[idx]) * *l_first_[idx];
+          chunk[j] += (one_ - *product_coset[idx]) * *l_first[idx];
 
           // l_last(X) * (z(X)² - z(X)) = 0
           chunk[j] *= *y_;
           chunk[j] += (product_coset[idx]->Square() - *product_coset[idx]) *
-                      *l_last_[idx];
+                      *l_last[idx];
 
           // clang-format off
           // A * (B - C) = 0 where
@@ -172,13 +207,13 @@ class CircuitPolynomialBuilder {
           chunk[j] += (*product_coset[r_next] * (*input_coset[idx] + *beta_) *
                            (*table_coset[idx] + *gamma_) -
                        *product_coset[idx] * table_value) *
-                      *l_active_row_[idx];
+                      *l_active_row[idx];
 
           // Check that the first values in the permuted input expression and
           // permuted fixed expression are the same.
           // l_first(X) * (a'(X) - s'(X)) = 0
           chunk[j] *= *y_;
-          chunk[j] += a_minus_s * *l_first_[idx];
+          chunk[j] += a_minus_s * *l_first[idx];
 
           // Check that each value in the permuted lookup input expression is
           // either equal to the value above it, or the value at the same
@@ -186,74 +221,83 @@ class CircuitPolynomialBuilder {
           // (a′(X) − s′(X))⋅(a′(X) − a′(w⁻¹X)) = 0
           chunk[j] *= *y_;
           chunk[j] += a_minus_s * (*input_coset[idx] - *input_coset[r_prev]) *
-                      *l_active_row_[idx];
+                      *l_active_row[idx];
         }
       });
     }
   }
 
-  void UpdateValuesByPermutation(std::vector<F>& values) {
-    base::Parallelize(values, [this](absl::Span<F> chunk, size_t chunk_offset,
-                                     size_t chunk_size) {
-      const std::vector<Evals>& product_cosets = permutation_product_cosets_;
-      const std::vector<Evals>& cosets = permutation_cosets_;
+  void UpdateValuesByLogDerivativeLookups(
+      const std::vector<LookupPair<GraphEvaluator<F>>>& lookup_evaluators,
+      std::vector<F>& values) {
+    for (size_t i = 0; i < lookup_grand_sum_cosets_.size(); ++i) {
+      const GraphEvaluator<F>& input_ev = lookup_evaluators[i].input();
+      const GraphEvaluator<F>& table_ev = lookup_evaluators[i].table();
+
+      base::Parallelize(values, [this, i, &input_ev, &table_ev](
+                                    absl::Span<F> chunk, size_t chunk_offset,
+                                    size_t chunk_size) {
+        const Evals& multiplicities_coset = lookup_multiplicities_cosets_[i];
+        const Evals& grand_sum_coset = lookup_grand_sum_cosets_[i];
+        const Evals& l_first = *l_first_;
+        const Evals& l_last = *l_last_;
+        const Evals& l_active_row = *l_active_row_;
 
-      size_t start = chunk_offset * chunk_size;
-      F beta_term = current_extended_omega_ * omega_->Pow(start);
-      for (size_t i = 0; i < chunk.size(); ++i) {
-        size_t idx = start + i;
-
-        // Enforce only for the first set: l_first(X) * (1 - z₀(X)) = 0
-        chunk[i] *= *y_;
-        chunk[i] += (one_ - *product_cosets.front()[idx]) * *l_first_[idx];
-
-        // Enforce only for the last set: l_last(X) * (z_l(X)² - z_l(X)) = 0
-        const Evals& last_coset = product_cosets.back();
-        chunk[i] *= *y_;
-        chunk[i] +=
-            *l_last_[idx] * (last_coset[idx]->Square() - *last_coset[idx]);
-
-        // Except for the first set, enforce:
-        // l_first(X) * (zᵢ(X) - zᵢ₋₁(w⁻¹X)) = 0
-        size_t r_last = last_rotation_.GetIndex(idx, rot_scale_, n_);
-        for (size_t set_idx = 0; set_idx < product_cosets.size(); ++set_idx) {
-          if (set_idx == 0) continue;
-          chunk[i] *= *y_;
-          chunk[i] += *l_first_[idx] * (*product_cosets[set_idx][idx] -
-                                        *product_cosets[set_idx - 1][r_last]);
-        }
+        size_t start = chunk_offset * chunk_size;
+        auto evaluate = [this, start, &chunk](const GraphEvaluator<F>& ev) {
+          EvaluationInput<Poly, Evals> evaluation_input =
+              ExtractEvaluationInput(ev.CreateInitialIntermediates(),
+                                     ev.CreateEmptyRotations());
+          ev.EvaluateInvariants(evaluation_input);
+          std::vector<F> ret = base::CreateVector(chunk.size(), F::Zero());
+          ev.EvaluateRows(evaluation_input, start, rot_scale_,
+                          absl::MakeSpan(ret));
+          return ret;
+        };
+        // A_compressed(X) + β
+        std::vector<F> input_values = evaluate(input_ev);
+        // S_compressed(X) + β
+        std::vector<F> table_values = evaluate(table_ev);
+
+        for (size_t j = 0; j < chunk.size(); ++j) {
+          size_t idx = start + j;
+          const F& input_value = input_values[j];
+          const F& table_value = table_values[j];
+          const F& grand_sum = *grand_sum_coset[idx];
 
-        // And for all the sets we enforce: (1 - (l_last(X) + l_blind(X))) *
-        // (zᵢ(wX) * Πⱼ(p(X) + βsⱼ(X) + γ) - zᵢ(X) Πⱼ(p(X) + δʲβX + γ))
-        F current_delta = delta_start_ * beta_term;
-        size_t r_next = Rotation(1).GetIndex(idx, rot_scale_, n_);
-
-        const std::vector<AnyColumnKey>& column_keys =
-            proving_key_->verifying_key()
-                .constraint_system()
-                .permutation()
-                .columns();
-        std::vector<absl::Span<const AnyColumnKey>> column_key_chunks =
-            base::ParallelizeMapByChunkSize(
-                column_keys, chunk_len_,
-                [](absl::Span<const AnyColumnKey> chunk) { return chunk; });
-        std::vector<absl::Span<const Evals>> coset_chunks =
-            base::ParallelizeMapByChunkSize(
-                cosets, chunk_len_,
-                [](absl::Span<const Evals> chunk) { return chunk; });
-
-        for (size_t j = 0; j < product_cosets.size(); ++j) {
-          std::vector<base::Ref<const Evals>> column_chunk =
-              table_.GetColumns(column_key_chunks[j]);
-          F left = CalculateLeft(column_chunk, coset_chunks[j], idx,
-                                 product_cosets[j][r_next]);
-          F right = CalculateRight(column_chunk, &current_delta, idx,
-                                   product_cosets[j][idx]);
-          chunk[i] *= *y_;
-          chunk[i] += (left - right) * *l_active_row_[idx];
+          size_t r_next = Rotation(1).GetIndex(idx, rot_scale_, n_);
+
+          // l_first(X) * φ(X) = 0
+          chunk[j] *= *y_;
+          chunk[j] += grand_sum * *l_first[idx];
+
+          // l_last(X) * φ(X) = 0
+          chunk[j] *= *y_;
+          chunk[j] += grand_sum * *l_last[idx];
+
+          // clang-format off
+          // (1 - (l_last(X) + l_blind(X))) * (
+          //  (φ(ωX) - φ(X)) * (A_compressed(X) + β) * (S_compressed(X) + β) -
+          //  (S_compressed(X) + β) + m(X) * (A_compressed(X) + β)
+          // ) = 0
+          // clang-format on
+          chunk[j] *= *y_;
+          chunk[j] += ((*grand_sum_coset[r_next] - grand_sum) * input_value *
+                           table_value -
+                       table_value +
+                       *multiplicities_coset[idx] * input_value) *
+                      *l_active_row[idx];
         }
-        beta_term *= *omega_;
-      }
+      });
+    }
+  }
+
+  void UpdateValuesByPermutation(std::vector<F>& values) {
+    PermutationEvaluator<F> evaluator = CreatePermutationEvaluator();
+    base::Parallelize(values, [&evaluator](absl::Span<F> chunk,
+                                           size_t chunk_offset,
+                                           size_t chunk_size) {
+      evaluator.Evaluate(chunk_offset * chunk_size, chunk);
     });
   }
 
@@ -265,27 +309,39 @@ class CircuitPolynomialBuilder {
         beta_, gamma_, theta_, y_, n_);
   }
 
-  template <typename Evals>
-  F CalculateLeft(const std::vector<base::Ref<const Evals>>& column_chunk,
-                  absl::Span<const Evals> coset_chunk, size_t idx,
-                  const F* initial_value) {
-    F left = *initial_value;
-    for (size_t i = 0; i < column_chunk.size(); ++i) {
-      left *=
-          *(*column_chunk[i])[idx] + *beta_ * *coset_chunk[i][idx] + *gamma_;
-    }
-    return left;
-  }
-
-  template <typename Evals>
-  F CalculateRight(const std::vector<base::Ref<const Evals>>& column_chunk,
-                   F* current_delta, size_t idx, const F* initial_value) {
-    F right = *initial_value;
-    for (size_t i = 0; i < column_chunk.size(); ++i) {
-      right *= *(*column_chunk[i])[idx] + delta_ + *gamma_;
-      *current_delta *= delta_;
-    }
-    return right;
+  // Resolves the columns of the permutation argument of the current part.
+  PermutationEvaluator<F> CreatePermutationEvaluator() const {
+    typename PermutationEvaluator<F>::Params params;
+    auto to_span = [](const Evals& evals) {
+      return absl::MakeConstSpan(evals.evaluations());
+    };
+    const std::vector<AnyColumnKey>& column_keys =
+        proving_key_->verifying_key()
+            .constraint_system()
+            .permutation()
+            .columns();
+    params.columns = base::Map(
+        table_.GetColumns(column_keys),
+        [&to_span](const base::Ref<const Evals>& column) {
+          return to_span(*column);
+        });
+    params.cosets = base::Map(*permutation_cosets_, to_span);
+    params.product_cosets = base::Map(permutation_product_cosets_, to_span);
+    params.chunk_len = chunk_len_;
+    params.l_first = to_span(*l_first_);
+    params.l_last = to_span(*l_last_);
+    params.l_active_row = to_span(*l_active_row_);
+    params.beta = *beta_;
+    params.gamma = *gamma_;
+    params.y = *y_;
+    params.delta = delta_;
+    params.delta_start = delta_start_;
+    params.omega = *omega_;
+    params.current_extended_omega = current_extended_omega_;
+    params.last_rotation = last_rotation_;
+    params.rot_scale = static_cast<int32_t>(rot_scale_);
+    params.n = n_;
+    return PermutationEvaluator<F>(std::move(params));
   }
 
   void UpdateValuesByCustomGates(const GraphEvaluator<F>& custom_gate_evaluator,
@@ -296,43 +352,48 @@ class CircuitPolynomialBuilder {
       EvaluationInput<Poly, Evals> evaluation_input = ExtractEvaluationInput(
           custom_gate_evaluator.CreateInitialIntermediates(),
           custom_gate_evaluator.CreateEmptyRotations());
+      custom_gate_evaluator.EvaluateInvariants(evaluation_input);
 
       size_t start = chunk_offset * chunk_size;
-      for (size_t i = 0; i < chunk.size(); ++i) {
-        chunk[i] = custom_gate_evaluator.Evaluate(evaluation_input, start + i,
-                                                  rot_scale_, chunk[i]);
-      }
+      custom_gate_evaluator.EvaluateRows(evaluation_input, start, rot_scale_,
+                                         chunk);
     });
   }
 
-  void UpdateVanishingProvingKey() {
-    l_first_ = CoeffToExtendedPart(domain_, proving_key_->l_first(), *zeta_,
-                                   current_extended_omega_);
-    l_last_ = CoeffToExtendedPart(domain_, proving_key_->l_last(), *zeta_,
-                                  current_extended_omega_);
-    l_active_row_ = CoeffToExtendedPart(domain_, proving_key_->l_active_row(),
-                                        *zeta_, current_extended_omega_);
+  // Updates the extended part evaluations that are the same for all the
+  // circuits. l_first(X), l_last(X) and l_active_row(X) are built in the closed
+  // form from a single batch inversion, and the rest are taken from the coset
+  // cache of the proving key if possible.
+  void UpdateVanishingProvingKey(size_t part) {
+    Evals l_first =
+        BuildLFirstExtendedPart(domain_, *zeta_, current_extended_omega_);
+    l_last_ = std::make_shared<const Evals>(
+        BuildLLastExtendedPart(l_first, usable_rows_));
+    l_active_row_ = std::make_shared<const Evals>(
+        BuildLActiveRowExtendedPart(l_first, usable_rows_));
+    l_first_ = std::make_shared<const Evals>(std::move(l_first));
+    permutation_cosets_ = proving_key_->coset_cache().Get(
+        domain_, ProvingKey<PCS>::kPermutationPolysCacheId,
+        absl::MakeConstSpan(proving_key_->permutation_proving_key().polys()),
+        part, *zeta_, current_extended_omega_);
   }
 
   void UpdateVanishingPermutation(size_t circuit_idx) {
+    ReleaseToBufferPool(permutation_product_cosets_);
     permutation_product_cosets_ = CoeffsToExtendedPart(
         domain_,
         absl::MakeConstSpan(
             (*committed_permutations_)[circuit_idx].product_polys()),
         *zeta_, current_extended_omega_);
-    permutation_cosets_ = CoeffsToExtendedPart(
-        domain_,
-        absl::MakeConstSpan(proving_key_->permutation_proving_key().polys()),
-        *zeta_, current_extended_omega_);
   }
 
   void UpdateVanishingLookups(size_t circuit_idx) {
     size_t num_lookups = committed_lookups_vec_->size();
-    std::vector<LookupCommitted<Poly>> current_committed_lookups =
+    const std::vector<LookupCommitted<Poly>>& current_committed_lookups =
         (*committed_lookups_vec_)[circuit_idx];
-    lookup_product_cosets_.clear();
-    lookup_input_cosets_.clear();
-    lookup_table_cosets_.clear();
+    ReleaseToBufferPool(lookup_product_cosets_);
+    ReleaseToBufferPool(lookup_input_cosets_);
+    ReleaseToBufferPool(lookup_table_cosets_);
     lookup_product_cosets_.reserve(num_lookups);
     lookup_input_cosets_.reserve(num_lookups);
     lookup_table_cosets_.reserve(num_lookups);
@@ -349,19 +410,41 @@ class CircuitPolynomialBuilder {
     }
   }
 
-  void UpdateVanishingTable(size_t circuit_idx) {
-    std::vector<Evals> fixed_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].fixed_columns(), *zeta_,
-        current_extended_omega_);
-    std::vector<Evals> advice_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].advice_columns(), *zeta_,
-        current_extended_omega_);
-    std::vector<Evals> instance_columns = CoeffsToExtendedPart(
-        domain_, (*poly_tables_)[circuit_idx].instance_columns(), *zeta_,
+  void UpdateVanishingLogDerivativeLookups(size_t circuit_idx) {
+    const std::vector<LogDerivativeLookupCommitted<Poly>>&
+        current_committed_lookups =
+            (*committed_log_derivative_lookups_vec_)[circuit_idx];
+    size_t num_lookups = current_committed_lookups.size();
+    ReleaseToBufferPool(lookup_multiplicities_cosets_);
+    ReleaseToBufferPool(lookup_grand_sum_cosets_);
+    lookup_multiplicities_cosets_.reserve(num_lookups);
+    lookup_grand_sum_cosets_.reserve(num_lookups);
+    for (const LogDerivativeLookupCommitted<Poly>& committed :
+         current_committed_lookups) {
+      lookup_multiplicities_cosets_.push_back(
+          CoeffToExtendedPart(domain_, committed.multiplicities_poly(), *zeta_,
+                              current_extended_omega_));
+      lookup_grand_sum_cosets_.push_back(
+          CoeffToExtendedPart(domain_, committed.grand_sum_poly(), *zeta_,
+                              current_extended_omega_));
+    }
+  }
+
+  void UpdateVanishingTable(size_t part, size_t circuit_idx) {
+    const RefTable<Poly>& poly_table = (*poly_tables_)[circuit_idx];
+    // The fixed columns are shared by all the circuits, so they are computed
+    // only for the first circuit unless they are evicted from the cache.
+    fixed_cosets_ = proving_key_->coset_cache().Get(
+        domain_, ProvingKey<PCS>::kFixedPolysCacheId,
+        poly_table.fixed_columns(), part, *zeta_, current_extended_omega_);
+    ReleaseToBufferPool(advice_cosets_);
+    ReleaseToBufferPool(instance_cosets_);
+    advice_cosets_ = CoeffsToExtendedPart(domain_, poly_table.advice_columns(),
+                                          *zeta_, current_extended_omega_);
+    instance_cosets_ = CoeffsToExtendedPart(
+        domain_, poly_table.instance_columns(), *zeta_,
         current_extended_omega_);
-    table_ =
-        OwnedTable<Evals>(std::move(fixed_columns), std::move(advice_columns),
-                          std::move(instance_columns));
+    table_ = RefTable<Evals>(*fixed_cosets_, advice_cosets_, instance_cosets_);
   }
 
   // not owned
@@ -372,6 +455,7 @@ class CircuitPolynomialBuilder {
   size_t rot_scale_ = 1;
 
   int32_t n_ = 0;
+  size_t usable_rows_ = 0;
   size_t num_parts_ = 0;
   size_t chunk_len_ = 0;
   // not owned
@@ -401,20 +485,29 @@ class CircuitPolynomialBuilder {
   // not owned
   const std::vector<std::vector<LookupCommitted<Poly>>>* committed_lookups_vec_;
   // not owned
+  const std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>*
+      committed_log_derivative_lookups_vec_;
+  // not owned
   const std::vector<RefTable<Poly>>* poly_tables_;
 
-  Evals l_first_;
-  Evals l_last_;
-  Evals l_active_row_;
+  std::shared_ptr<const Evals> l_first_;
+  std::shared_ptr<const Evals> l_last_;
+  std::shared_ptr<const Evals> l_active_row_;
 
   std::vector<Evals> permutation_product_cosets_;
-  std::vector<Evals> permutation_cosets_;
+  std::shared_ptr<const std::vector<Evals>> permutation_cosets_;
 
   std::vector<Evals> lookup_product_cosets_;
   std::vector<Evals> lookup_input_cosets_;
   std::vector<Evals> lookup_table_cosets_;
 
-  OwnedTable<Evals> table_;
+  std::vector<Evals> lookup_multiplicities_cosets_;
+  std::vector<Evals> lookup_grand_sum_cosets_;
+
+  std::shared_ptr<const std::vector<Evals>> fixed_cosets_;
+  std::vector<Evals> advice_cosets_;
+  std::vector<Evals> instance_cosets_;
+  RefTable<Evals> table_;
 };
 
 }  // namespace tachyon::zk
@@ -0,0 +1,165 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_COSET_CACHE_H_
+#define TACHYON_ZK_PLONK_VANISHING_COSET_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
+
+namespace tachyon::zk {
+
+// Caches the evaluations of polynomials over the extended parts, which
+// |CoeffsToExtendedPart()| computes. The polynomials that don't depend on the
+// circuit, e.g, the fixed columns and the permutation polynomials of a
+// |ProvingKey|, are then evaluated once per part and shared by all the
+// circuits and the proofs created with the key.
+//
+// The polynomials are grouped by their owner, which gives each group an |id|
+// that doesn't change while the group is cached. The evaluations are keyed by
+// the |id| and the index of the part. The owner must call |Clear()| when it
+// replaces the polynomials. At most |max_bytes()| bytes of evaluations are
+// cached. The evaluations that don't fit are computed again on every |Get()|.
+//
+// This is thread-safe, so that the proofs sharing a key can run concurrently.
+// The evaluations are computed outside of the lock, and those computed before
+// the last |Clear()| are returned but not cached.
+template <typename Poly, typename Evals>
+class CosetCache {
+ public:
+  using F = typename Poly::Field;
+
+  constexpr static size_t kDefaultMaxBytes = size_t{1} << 30;
+
+  CosetCache() = default;
+  explicit CosetCache(size_t max_bytes) : max_bytes_(max_bytes) {}
+  CosetCache(const CosetCache& other) = delete;
+  CosetCache& operator=(const CosetCache& other) = delete;
+
+  size_t max_bytes() const {
+    absl::MutexLock lock(&mutex_);
+    return max_bytes_;
+  }
+  size_t size_in_bytes() const {
+    absl::MutexLock lock(&mutex_);
+    return size_in_bytes_;
+  }
+  size_t num_entries() const {
+    absl::MutexLock lock(&mutex_);
+    return entries_.size();
+  }
+
+  // Clears the cache if it holds more than |max_bytes|.
+  void set_max_bytes(size_t max_bytes) {
+    absl::MutexLock lock(&mutex_);
+    max_bytes_ = max_bytes;
+    if (size_in_bytes_ > max_bytes_) ClearLocked();
+  }
+
+  void Clear() {
+    absl::MutexLock lock(&mutex_);
+    ClearLocked();
+  }
+
+  // Returns the evaluations of |polys| over the |part|-th extended part,
+  // whose coset is ζ * |extended_omega_factor|. |polys| must be the group
+  // identified by |id|.
+  template <typename Domain>
+  std::shared_ptr<const std::vector<Evals>> Get(
+      const Domain* domain, size_t id, absl::Span<const Poly> polys,
+      size_t part, const F& zeta, const F& extended_omega_factor) {
+    Key key(id, part);
+    uint64_t generation;
+    {
+      absl::MutexLock lock(&mutex_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        const Entry& entry = it->second;
+        if (entry.zeta == zeta &&
+            entry.extended_omega_factor == extended_omega_factor) {
+          DCHECK_EQ(entry.evals->size(), polys.size());
+          return entry.evals;
+        }
+      }
+      generation = generation_;
+    }
+
+    std::vector<Evals> evals;
+    evals.reserve(polys.size());
+    for (const Poly& poly : polys) {
+      evals.push_back(
+          CoeffToExtendedPart(domain, poly, zeta, extended_omega_factor));
+    }
+    size_t size_in_bytes = 0;
+    for (const Evals& e : evals) {
+      size_in_bytes += e.evaluations().size() * sizeof(F);
+    }
+    auto ret = std::make_shared<const std::vector<Evals>>(std::move(evals));
+
+    absl::MutexLock lock(&mutex_);
+    if (generation != generation_) return ret;
+    // Another coset of the same part, or the same one that another thread
+    // has computed meanwhile, is replaced.
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      size_in_bytes_ -= it->second.size_in_bytes;
+      entries_.erase(it);
+    }
+    if (size_in_bytes_ + size_in_bytes <= max_bytes_) {
+      size_in_bytes_ += size_in_bytes;
+      entries_.try_emplace(key, Entry{ret, zeta, extended_omega_factor,
+                                      size_in_bytes});
+    }
+    return ret;
+  }
+
+  // Returns the evaluations of |poly| over the |part|-th extended part.
+  template <typename Domain>
+  std::shared_ptr<const Evals> Get(const Domain* domain, size_t id,
+                                   const Poly& poly, size_t part,
+                                   const F& zeta,
+                                   const F& extended_omega_factor) {
+    std::shared_ptr<const std::vector<Evals>> evals =
+        Get(domain, id, absl::MakeConstSpan(&poly, 1), part, zeta,
+            extended_omega_factor);
+    const Evals* ret = &evals->front();
+    return std::shared_ptr<const Evals>(evals, ret);
+  }
+
+ private:
+  // The id of the polynomials and the index of the part.
+  using Key = std::pair<size_t, size_t>;
+
+  struct Entry {
+    std::shared_ptr<const std::vector<Evals>> evals;
+    F zeta;
+    F extended_omega_factor;
+    size_t size_in_bytes;
+  };
+
+  void ClearLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+    entries_.clear();
+    size_in_bytes_ = 0;
+    ++generation_;
+  }
+
+  mutable absl::Mutex mutex_;
+  absl::flat_hash_map<Key, Entry> entries_ ABSL_GUARDED_BY(mutex_);
+  size_t max_bytes_ ABSL_GUARDED_BY(mutex_) = kDefaultMaxBytes;
+  size_t size_in_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  // Incremented by every |Clear()|.
+  uint64_t generation_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_COSET_CACHE_H_
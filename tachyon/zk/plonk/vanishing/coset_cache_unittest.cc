@@ -0,0 +1,143 @@
+#include "tachyon/zk/plonk/vanishing/coset_cache.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+class CosetCacheTest : public testing::Test {
+ public:
+  constexpr static size_t N = size_t{1} << 4;
+  constexpr static size_t kMaxDegree = N - 1;
+
+  using F = math::bn254::Fr;
+  using Domain = math::UnivariateEvaluationDomain<F, kMaxDegree>;
+  using Poly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  void SetUp() override {
+    domain_ = Domain::Create(N);
+    polys_ = {domain_->Random<Poly>(), domain_->Random<Poly>()};
+    zeta_ = GetHalo2Zeta<F>();
+  }
+
+ protected:
+  absl::Span<const Poly> polys() const { return absl::MakeConstSpan(polys_); }
+
+  std::unique_ptr<Domain> domain_;
+  std::vector<Poly> polys_;
+  F zeta_;
+};
+
+}  // namespace
+
+TEST_F(CosetCacheTest, Get) {
+  CosetCache<Poly, Evals> cache;
+  F factor = F::Random();
+
+  std::shared_ptr<const std::vector<Evals>> evals =
+      cache.Get(domain_.get(), 0, polys(), 0, zeta_, factor);
+  std::vector<Evals> expected =
+      CoeffsToExtendedPart(domain_.get(), polys(), zeta_, factor);
+  EXPECT_EQ(*evals, expected);
+  EXPECT_EQ(cache.num_entries(), 1);
+  EXPECT_EQ(cache.size_in_bytes(), 2 * N * sizeof(F));
+
+  // Cache hit.
+  EXPECT_EQ(cache.Get(domain_.get(), 0, polys(), 0, zeta_, factor), evals);
+
+  // A different part or a different id is a different entry.
+  std::shared_ptr<const Evals> first =
+      cache.Get(domain_.get(), 1, polys_[0], 0, zeta_, factor);
+  EXPECT_EQ(*first, expected[0]);
+  cache.Get(domain_.get(), 0, polys(), 1, zeta_, factor);
+  EXPECT_EQ(cache.num_entries(), 3);
+
+  // The entry is recomputed if the coset differs.
+  F other_factor = F::Random();
+  std::shared_ptr<const std::vector<Evals>> other =
+      cache.Get(domain_.get(), 0, polys(), 0, zeta_, other_factor);
+  EXPECT_EQ(*other,
+            CoeffsToExtendedPart(domain_.get(), polys(), zeta_, other_factor));
+  EXPECT_EQ(cache.num_entries(), 3);
+}
+
+TEST_F(CosetCacheTest, MaxBytes) {
+  CosetCache<Poly, Evals> cache(N * sizeof(F));
+  F factor = F::Random();
+
+  // Doesn't fit.
+  std::shared_ptr<const std::vector<Evals>> evals =
+      cache.Get(domain_.get(), 0, polys(), 0, zeta_, factor);
+  EXPECT_EQ(evals->size(), 2);
+  EXPECT_EQ(cache.num_entries(), 0);
+  EXPECT_EQ(cache.size_in_bytes(), 0);
+
+  // Fits.
+  std::shared_ptr<const Evals> first =
+      cache.Get(domain_.get(), 1, polys_[0], 0, zeta_, factor);
+  EXPECT_EQ(cache.num_entries(), 1);
+  EXPECT_EQ(cache.Get(domain_.get(), 1, polys_[0], 0, zeta_, factor), first);
+
+  cache.set_max_bytes(0);
+  EXPECT_EQ(cache.num_entries(), 0);
+  EXPECT_EQ(cache.size_in_bytes(), 0);
+}
+
+TEST_F(CosetCacheTest, Clear) {
+  CosetCache<Poly, Evals> cache;
+  F factor = F::Random();
+
+  cache.Get(domain_.get(), 0, polys(), 0, zeta_, factor);
+  EXPECT_EQ(cache.num_entries(), 1);
+
+  // The owner replaces the polynomials of the id 0 and clears the cache, so
+  // the evaluations of the old ones are not returned.
+  cache.Clear();
+  EXPECT_EQ(cache.num_entries(), 0);
+  std::vector<Poly> new_polys = {domain_->Random<Poly>()};
+  std::shared_ptr<const std::vector<Evals>> evals = cache.Get(
+      domain_.get(), 0, absl::MakeConstSpan(new_polys), 0, zeta_, factor);
+  EXPECT_EQ(*evals, CoeffsToExtendedPart(domain_.get(),
+                                         absl::MakeConstSpan(new_polys), zeta_,
+                                         factor));
+}
+
+TEST_F(CosetCacheTest, ConcurrentGet) {
+  CosetCache<Poly, Evals> cache;
+  F factor = F::Random();
+  std::vector<Evals> expected =
+      CoeffsToExtendedPart(domain_.get(), polys(), zeta_, factor);
+
+  constexpr size_t kNumThreads = 4;
+  constexpr size_t kNumParts = 2;
+  std::vector<std::vector<Evals>> results(kNumThreads * kNumParts);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([this, &cache, &results, &factor, i]() {
+      for (size_t part = 0; part < kNumParts; ++part) {
+        results[i * kNumParts + part] =
+            *cache.Get(domain_.get(), 0, polys(), part, zeta_, factor);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    EXPECT_EQ(results[i * kNumParts], expected);
+  }
+  EXPECT_EQ(cache.num_entries(), kNumParts);
+  EXPECT_EQ(cache.size_in_bytes(), kNumParts * 2 * N * sizeof(F));
+}
+
+}  // namespace tachyon::zk
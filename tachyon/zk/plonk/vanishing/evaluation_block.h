@@ -0,0 +1,101 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_EVALUATION_BLOCK_H_
+#define TACHYON_ZK_PLONK_VANISHING_EVALUATION_BLOCK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::zk {
+
+// Value of a |ValueSource| over the rows of an |EvaluationBlock|. It is
+// either a single value shared by all the rows, e.g, a constant or a
+// challenge, or a contiguous array that holds a value per row.
+template <typename F>
+class BlockValue {
+ public:
+  BlockValue() = default;
+
+  static BlockValue Scalar(const F* value) { return BlockValue(value, true); }
+  static BlockValue Rows(const F* values) { return BlockValue(values, false); }
+
+  bool is_scalar() const { return is_scalar_; }
+  const F* values() const { return values_; }
+
+  const F& operator[](size_t row) const {
+    return is_scalar_ ? *values_ : values_[row];
+  }
+
+ private:
+  BlockValue(const F* values, bool is_scalar)
+      : values_(values), is_scalar_(is_scalar) {}
+
+  // not owned
+  const F* values_ = nullptr;
+  bool is_scalar_ = false;
+};
+
+// Buffers to evaluate the calculations of a |GraphEvaluator| over the
+// consecutive rows [|start|, |start| + |size|) at once. The intermediates are
+// stored in structure of arrays layout, that is, the values of an
+// intermediate for all the rows of the block are contiguous. The first
+// |num_invariants| intermediates are the same for all the rows and are not
+// stored here. See |GraphEvaluator::AllocateIntermediates()|.
+template <typename F>
+class EvaluationBlock {
+ public:
+  EvaluationBlock() = default;
+  EvaluationBlock(size_t num_invariants, size_t num_intermediates,
+                  size_t num_rotations, size_t capacity)
+      : intermediates_((num_intermediates - num_invariants) * capacity),
+        rotations_(num_rotations),
+        num_invariants_(num_invariants),
+        capacity_(capacity) {}
+
+  size_t num_invariants() const { return num_invariants_; }
+  size_t start() const { return start_; }
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+
+  // |rotations()[i]| is the index of the first row of the block rotated by
+  // the i-th rotation. The rotated indices of a block never wrap around, so
+  // the rotated index of the j-th row is |rotations()[i]| + j.
+  const std::vector<int32_t>& rotations() const { return rotations_; }
+  std::vector<int32_t>& rotations() { return rotations_; }
+
+  absl::Span<const F> previous_values() const { return previous_values_; }
+
+  // Returns the values of the |index|-th intermediate, which must not be one
+  // of the invariants.
+  const F* GetIntermediates(size_t index) const {
+    return &intermediates_[(index - num_invariants_) * capacity_];
+  }
+  F* GetIntermediates(size_t index) {
+    return &intermediates_[(index - num_invariants_) * capacity_];
+  }
+
+  // Moves the block to the rows [|start|, |start| + |previous_values.size()|).
+  void Reset(size_t start, absl::Span<const F> previous_values) {
+    CHECK_LE(previous_values.size(), capacity_);
+    start_ = start;
+    size_ = previous_values.size();
+    previous_values_ = previous_values;
+  }
+
+ private:
+  std::vector<F> intermediates_;
+  std::vector<int32_t> rotations_;
+  absl::Span<const F> previous_values_;
+  size_t num_invariants_ = 0;
+  size_t start_ = 0;
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_EVALUATION_BLOCK_H_
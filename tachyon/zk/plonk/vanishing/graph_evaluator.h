@@ -7,10 +7,14 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_GRAPH_EVALUATOR_H_
 #define TACHYON_ZK_PLONK_VANISHING_GRAPH_EVALUATOR_H_
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/substitute.h"
+#include "absl/types/span.h"
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/zk/expressions/advice_expression.h"
@@ -25,6 +29,7 @@
 #include "tachyon/zk/expressions/selector_expression.h"
 #include "tachyon/zk/expressions/sum_expression.h"
 #include "tachyon/zk/plonk/vanishing/calculation.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_block.h"
 
 namespace tachyon::zk {
 
@@ -52,12 +57,20 @@ struct TACHYON_EXPORT CalculationInfo {
 template <typename F>
 class GraphEvaluator : public Evaluator<F, ValueSource> {
  public:
+  constexpr static size_t kDefaultBlockSize = 256;
+
   GraphEvaluator() = default;
 
   const std::vector<F>& constants() const { return constants_; }
-  const std::vector<int32_t>& rotations() { return rotations_; }
-  const std::vector<CalculationInfo>& calculations() { return calculations_; }
+  const std::vector<int32_t>& rotations() const { return rotations_; }
+  const std::vector<CalculationInfo>& calculations() const {
+    return calculations_;
+  }
+  const std::vector<CalculationInfo>& invariant_calculations() const {
+    return invariant_calculations_;
+  }
   size_t num_intermediates() const { return num_intermediates_; }
+  size_t num_invariants() const { return num_invariants_; }
 
   template <typename Poly, typename Evals>
   F Evaluate(EvaluationInput<Poly, Evals>& data, size_t idx, int32_t scale,
@@ -76,6 +89,62 @@ class GraphEvaluator : public Evaluator<F, ValueSource> {
     return data.intermediates()[calculations_.back().target];
   }
 
+  // Evaluates the rows [|start|, |start| + |values.size()|). |values| holds
+  // the previous values of the rows on input and the evaluated values on
+  // output. The result is the same as calling |Evaluate()| for each row.
+  //
+  // Instead of running all the calculations per row, each calculation is run
+  // over a block of |block_size| rows into |EvaluationBlock|. This way, the
+  // rotated indices are computed and the calculations are dispatched once per
+  // block. The rows whose rotated indices wrap around are evaluated per row.
+  template <typename Poly, typename Evals>
+  void EvaluateRows(EvaluationInput<Poly, Evals>& data, size_t start,
+                    int32_t scale, absl::Span<F> values,
+                    size_t block_size = kDefaultBlockSize) const {
+    CHECK_GT(block_size, size_t{0});
+    if (calculations_.empty()) {
+      std::fill(values.begin(), values.end(), F::Zero());
+      return;
+    }
+
+    // None of the rotated indices of the rows in [|from|, |to|) wrap around.
+    int64_t n = data.n();
+    int64_t from = 0;
+    int64_t to = n;
+    for (int32_t rotation : rotations_) {
+      int64_t offset = int64_t{rotation} * scale;
+      if (offset < 0) {
+        from = std::max(from, -offset);
+      } else {
+        to = std::min(to, n - offset);
+      }
+    }
+    size_t end = start + values.size();
+    size_t block_from = std::clamp(from, int64_t{0}, n);
+    block_from = std::clamp(block_from, start, end);
+    size_t block_to = std::clamp(to, int64_t{0}, n);
+    block_to = std::clamp(block_to, block_from, end);
+
+    for (size_t idx = start; idx < block_from; ++idx) {
+      F& value = values[idx - start];
+      value = Evaluate(data, idx, scale, value);
+    }
+    if (block_from < block_to) {
+      EvaluationBlock<F> block(num_invariants_, num_intermediates_,
+                               rotations_.size(),
+                               std::min(block_size, block_to - block_from));
+      for (size_t idx = block_from; idx < block_to; idx += block_size) {
+        size_t size = std::min(block_size, block_to - idx);
+        EvaluateBlock(data, block, idx, scale,
+                      values.subspan(idx - start, size));
+      }
+    }
+    for (size_t idx = block_to; idx < end; ++idx) {
+      F& value = values[idx - start];
+      value = Evaluate(data, idx, scale, value);
+    }
+  }
+
   // Evaluator methods
   ValueSource Evaluate(const Expression<F>* input) override {
     switch (input->type()) {
@@ -198,6 +267,14 @@ class GraphEvaluator : public Evaluator<F, ValueSource> {
           return ValueSource::ZeroConstant();
         } else if (scale.IsOne()) {
           return AddExpression(scaled->expr());
+        } else if ((-scale).IsOne()) {
+          ValueSource result = AddExpression(scaled->expr());
+          if (result.IsZeroConstant()) return result;
+          return AddCalculation(Calculation::Negate(result));
+        } else if (scale == F(2)) {
+          ValueSource result = AddExpression(scaled->expr());
+          if (result.IsZeroConstant()) return result;
+          return AddCalculation(Calculation::Double(result));
         } else {
           ValueSource constant = AddConstant(scale);
           ValueSource result = AddExpression(scaled->expr());
@@ -216,26 +293,183 @@ class GraphEvaluator : public Evaluator<F, ValueSource> {
     return base::CreateVector(rotations_.size(), 0);
   }
 
-  // Currently does the simplest thing possible: just stores the
-  // resulting value so the result can be reused  when that calculation
-  // is done multiple times.
+  // Stores the resulting value so the result can be reused when that
+  // calculation is done multiple times, even across the expressions added to
+  // this evaluator.
   ValueSource AddCalculation(const Calculation& calculation) {
-    auto it = std::find_if(calculations_.begin(), calculations_.end(),
-                           [&calculation](const CalculationInfo& info) {
-                             return info.calculation == calculation;
-                           });
-    if (it != calculations_.end()) return ValueSource::Intermediate(it->target);
+    CHECK(!intermediates_allocated_);
+    auto [it, inserted] =
+        targets_.try_emplace(calculation, num_intermediates_);
+    if (!inserted) return ValueSource::Intermediate(it->second);
     size_t target = num_intermediates_++;
     calculations_.emplace_back(calculation, target);
     return ValueSource::Intermediate(target);
   }
 
+  // Prepares the calculations to be evaluated, after which |AddCalculation()|
+  // and |AddExpression()| must not be called.
+  //
+  // 1. The calculations whose operands are the same for all the rows, e.g,
+  //    constants, challenges and y, are moved to |invariant_calculations_|.
+  //    They are evaluated once per |EvaluationInput| by
+  //    |EvaluateInvariants()| and stored to the first |num_invariants_|
+  //    intermediates.
+  // 2. The remaining calculations share intermediates whose values are no
+  //    longer needed, so that fewer intermediates are live at once. This is a
+  //    linear scan register allocation over |calculations_|, which are already
+  //    in evaluation order. The result of a calculation is never stored to one
+  //    of its operands.
+  void AllocateIntermediates() {
+    CHECK(!intermediates_allocated_);
+    intermediates_allocated_ = true;
+    targets_.clear();
+    if (calculations_.empty()) return;
+
+    std::vector<bool> invariants(num_intermediates_, false);
+    // The result of the last calculation is read after the evaluation of a
+    // row, so it is never moved.
+    for (size_t i = 0; i < calculations_.size() - 1; ++i) {
+      bool invariant = true;
+      calculations_[i].calculation.ForEachValueSource(
+          [&invariants, &invariant](const ValueSource& value) {
+            invariant &= IsInvariant(value, invariants);
+          });
+      invariants[calculations_[i].target] = invariant;
+    }
+
+    constexpr size_t kNotUsed = std::numeric_limits<size_t>::max();
+    std::vector<size_t> slots(num_intermediates_, kNotUsed);
+    std::vector<CalculationInfo> calculations;
+    for (CalculationInfo& info : calculations_) {
+      if (invariants[info.target]) {
+        RenameOperands(slots, info.calculation);
+        slots[info.target] = invariant_calculations_.size();
+        info.target = slots[info.target];
+        invariant_calculations_.push_back(std::move(info));
+      } else {
+        calculations.push_back(std::move(info));
+      }
+    }
+    calculations_ = std::move(calculations);
+    num_invariants_ = invariant_calculations_.size();
+
+    // |last_uses[i]| is the index of the calculation that reads the i-th
+    // intermediate last.
+    std::vector<size_t> last_uses(num_intermediates_, kNotUsed);
+    for (size_t i = 0; i < calculations_.size(); ++i) {
+      calculations_[i].calculation.ForEachValueSource(
+          [&last_uses, i](const ValueSource& value) {
+            if (value.type() == ValueSource::Type::kIntermediate) {
+              last_uses[value.index()] = i;
+            }
+          });
+    }
+    last_uses[calculations_.back().target] = calculations_.size();
+
+    std::vector<size_t> free_slots;
+    size_t num_slots = num_invariants_;
+    for (size_t i = 0; i < calculations_.size(); ++i) {
+      CalculationInfo& info = calculations_[i];
+      std::vector<size_t> dead_slots;
+      info.calculation.ForEachValueSource(
+          [&last_uses, &slots, &dead_slots, &invariants, i](
+              const ValueSource& value) {
+            if (value.type() != ValueSource::Type::kIntermediate) return;
+            size_t index = value.index();
+            if (!invariants[index] && last_uses[index] == i) {
+              dead_slots.push_back(slots[index]);
+              // Prevents an operand used twice from being released twice.
+              last_uses[index] = kNotUsed;
+            }
+          });
+      RenameOperands(slots, info.calculation);
+
+      size_t slot;
+      if (free_slots.empty()) {
+        slot = num_slots++;
+      } else {
+        slot = free_slots.back();
+        free_slots.pop_back();
+      }
+      if (last_uses[info.target] == kNotUsed) {
+        dead_slots.push_back(slot);
+      }
+      slots[info.target] = slot;
+      info.target = slot;
+      free_slots.insert(free_slots.end(), dead_slots.begin(),
+                        dead_slots.end());
+    }
+    num_intermediates_ = num_slots;
+  }
+
+  // Evaluates the calculations moved by |AllocateIntermediates()|. This must
+  // be called once on |data| before it is passed to |Evaluate()| or
+  // |EvaluateRows()|.
+  template <typename Poly, typename Evals>
+  void EvaluateInvariants(EvaluationInput<Poly, Evals>& data) const {
+    for (const CalculationInfo& calculation : invariant_calculations_) {
+      data.intermediates()[calculation.target] =
+          calculation.calculation.Evaluate(data, constants_, F::Zero());
+    }
+  }
+
   // Generates an optimized evaluation for the expression
   ValueSource AddExpression(const Expression<F>* expression) {
     return expression->Evaluate(this);
   }
 
  private:
+  template <typename Poly, typename Evals>
+  void EvaluateBlock(const EvaluationInput<Poly, Evals>& data,
+                     EvaluationBlock<F>& block, size_t start, int32_t scale,
+                     absl::Span<F> values) const {
+    block.Reset(start, values);
+    for (size_t i = 0; i < rotations_.size(); ++i) {
+      block.rotations()[i] =
+          static_cast<int32_t>(start) + rotations_[i] * scale;
+    }
+
+    for (const CalculationInfo& calculation : calculations_) {
+      calculation.calculation.EvaluateBlock(
+          data, block, constants_, block.GetIntermediates(calculation.target));
+    }
+
+    const F* results = block.GetIntermediates(calculations_.back().target);
+    std::copy(results, results + values.size(), values.begin());
+  }
+
+  static bool IsInvariant(const ValueSource& value,
+                          const std::vector<bool>& invariants) {
+    switch (value.type()) {
+      case ValueSource::Type::kConstant:
+      case ValueSource::Type::kChallenge:
+      case ValueSource::Type::kBeta:
+      case ValueSource::Type::kGamma:
+      case ValueSource::Type::kTheta:
+      case ValueSource::Type::kY:
+        return true;
+      case ValueSource::Type::kIntermediate:
+        return invariants[value.index()];
+      case ValueSource::Type::kFixed:
+      case ValueSource::Type::kAdvice:
+      case ValueSource::Type::kInstance:
+      case ValueSource::Type::kPreviousValue:
+        return false;
+    }
+    NOTREACHED();
+    return false;
+  }
+
+  // Replaces the intermediate operands of |calculation| with their |slots|.
+  static void RenameOperands(const std::vector<size_t>& slots,
+                             Calculation& calculation) {
+    calculation.ForEachValueSource([&slots](ValueSource& value) {
+      if (value.type() == ValueSource::Type::kIntermediate) {
+        value = ValueSource::Intermediate(slots[value.index()]);
+      }
+    });
+  }
+
   size_t AddRotation(const Rotation& rotation) {
     size_t rotation_index = rotation.value();
     std::optional<size_t> position = base::FindIndexIf(
@@ -256,7 +490,11 @@ class GraphEvaluator : public Evaluator<F, ValueSource> {
   std::vector<F> constants_ = {F::Zero(), F::One(), F(2)};
   std::vector<int32_t> rotations_;
   std::vector<CalculationInfo> calculations_;
+  std::vector<CalculationInfo> invariant_calculations_;
+  absl::flat_hash_map<Calculation, size_t> targets_;
   size_t num_intermediates_ = 0;
+  size_t num_invariants_ = 0;
+  bool intermediates_allocated_ = false;
 };
 
 }  // namespace tachyon::zk
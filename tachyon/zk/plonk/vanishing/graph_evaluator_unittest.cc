@@ -1,10 +1,15 @@
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
 
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/random.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 #include "tachyon/zk/expressions/evaluator/test/evaluator_test.h"
 #include "tachyon/zk/expressions/expression_factory.h"
+#include "tachyon/zk/plonk/circuit/owned_table.h"
 
 namespace tachyon::zk {
 
@@ -47,7 +52,7 @@ TEST_F(GraphEvaluatorTest, Fixed) {
       {0, 1, 0, 0},
       {1, 2, 1, 1},
       {0, 1, 0, 0},
-      {0, 2, 1, 1},
+      {0, 2, 1, 2},
   };
 
   GraphEvaluator<GF7> graph_evaluator;
@@ -75,7 +80,7 @@ TEST_F(GraphEvaluatorTest, Advice) {
       {0, 1, 0, 0},
       {1, 2, 1, 1},
       {0, 1, 0, 0},
-      {0, 2, 1, 1},
+      {0, 2, 1, 2},
   };
 
   GraphEvaluator<GF7> graph_evaluator;
@@ -103,7 +108,7 @@ TEST_F(GraphEvaluatorTest, Instance) {
       {0, 1, 0, 0},
       {1, 2, 1, 1},
       {0, 1, 0, 0},
-      {0, 2, 1, 1},
+      {0, 2, 1, 2},
   };
 
   GraphEvaluator<GF7> graph_evaluator;
@@ -130,6 +135,93 @@ TEST_F(GraphEvaluatorTest, Challenges) {
             CalculationInfo(Calculation::Store(ValueSource::Challenge(1)), 0));
 }
 
+TEST_F(GraphEvaluatorTest, EvaluateRows) {
+  constexpr size_t kN = 16;
+  using Poly = math::UnivariateDensePolynomial<GF7, kN - 1>;
+  using Evals = math::UnivariateEvaluations<GF7, kN - 1>;
+
+  GraphEvaluator<GF7> graph_evaluator;
+  // f₀(X) * a₀(ωX) + 3 * i₀(ω⁻¹X) - c₁
+  Expr gate0 = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Sum(
+          ExpressionFactory<GF7>::Product(
+              ExpressionFactory<GF7>::Fixed(
+                  FixedQuery(0, Rotation::Cur(), FixedColumnKey(0))),
+              ExpressionFactory<GF7>::Advice(
+                  AdviceQuery(0, Rotation::Next(), AdviceColumnKey(0)))),
+          ExpressionFactory<GF7>::Scaled(
+              ExpressionFactory<GF7>::Instance(
+                  InstanceQuery(0, Rotation::Prev(), InstanceColumnKey(0))),
+              GF7(3))),
+      ExpressionFactory<GF7>::Negated(
+          ExpressionFactory<GF7>::Challenge(Challenge(1, Phase(0)))));
+  // a₁(ω²X)² + 2 * a₀(X)
+  Expr gate1 = ExpressionFactory<GF7>::Sum(
+      ExpressionFactory<GF7>::Product(
+          ExpressionFactory<GF7>::Advice(
+              AdviceQuery(1, Rotation(2), AdviceColumnKey(1))),
+          ExpressionFactory<GF7>::Advice(
+              AdviceQuery(1, Rotation(2), AdviceColumnKey(1)))),
+      ExpressionFactory<GF7>::Scaled(
+          ExpressionFactory<GF7>::Advice(
+              AdviceQuery(2, Rotation::Cur(), AdviceColumnKey(0))),
+          GF7(2)));
+  std::vector<ValueSource> parts = {graph_evaluator.AddExpression(gate0.get()),
+                                    graph_evaluator.AddExpression(gate1.get())};
+  ValueSource horner = graph_evaluator.AddCalculation(Calculation::Horner(
+      ValueSource::PreviousValue(), std::move(parts), ValueSource::Y()));
+  graph_evaluator.AddCalculation(Calculation::Mul(horner, ValueSource::Beta()));
+
+  auto random_evals = []() {
+    return Evals(base::CreateVector(kN, []() { return GF7::Random(); }));
+  };
+  OwnedTable<Evals> table({random_evals()}, {random_evals(), random_evals()},
+                          {random_evals()});
+  std::vector<GF7> challenges = {GF7::Random(), GF7::Random()};
+  GF7 beta = GF7::Random();
+  GF7 gamma = GF7::Random();
+  GF7 theta = GF7::Random();
+  GF7 y = GF7::Random();
+  auto create_input = [&]() {
+    return EvaluationInput<Poly, Evals>(
+        graph_evaluator.CreateInitialIntermediates(),
+        graph_evaluator.CreateEmptyRotations(), &table, &challenges, &beta,
+        &gamma, &theta, &y, kN);
+  };
+
+  std::vector<GF7> previous_values =
+      base::CreateVector(kN, []() { return GF7::Random(); });
+  EvaluationInput<Poly, Evals> input = create_input();
+  std::vector<GF7> expected = base::CreateVector(kN, [&](size_t i) {
+    return graph_evaluator.Evaluate(input, i, 1, previous_values[i]);
+  });
+
+  struct {
+    size_t start;
+    size_t size;
+    size_t block_size;
+  } tests[] = {
+      {0, kN, 1},
+      {0, kN, 3},
+      {0, kN, 64},
+      {5, 7, 4},
+      {12, 4, 2},
+  };
+
+  for (const auto& test : tests) {
+    SCOPED_TRACE(absl::Substitute("start: $0, size: $1, block_size: $2",
+                                  test.start, test.size, test.block_size));
+    std::vector<GF7> values(previous_values.begin() + test.start,
+                            previous_values.begin() + test.start + test.size);
+    EvaluationInput<Poly, Evals> input = create_input();
+    graph_evaluator.EvaluateRows(input, test.start, 1, absl::MakeSpan(values),
+                                 test.block_size);
+    EXPECT_EQ(values,
+              std::vector<GF7>(expected.begin() + test.start,
+                               expected.begin() + test.start + test.size));
+  }
+}
+
 // TODO(chokobole): AddTest for Negated, Sum, Product and Scale.
 
 }  // namespace tachyon::zk
@@ -0,0 +1,161 @@
+#ifndef TACHYON_ZK_PLONK_VANISHING_PERMUTATION_EVALUATOR_H_
+#define TACHYON_ZK_PLONK_VANISHING_PERMUTATION_EVALUATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/zk/plonk/circuit/rotation.h"
+
+namespace tachyon::zk {
+
+// Evaluates the permutation constraints of the vanishing argument over the
+// rows of an extended part. All the columns are resolved when it is created,
+// so that |Evaluate()| doesn't allocate. The rows are processed in tiles of
+// |kTileSize| rows, and each column is read contiguously within a tile.
+//
+// For each row, |Evaluate()| folds the constraints below into the value with
+// y, in this order:
+//  - l_first(X) * (1 - z₀(X))
+//  - l_last(X) * (z_l(X)² - z_l(X))
+//  - l_first(X) * (zᵢ(X) - zᵢ₋₁(ω^(last_rotation) X)) for i > 0
+//  - (1 - (l_last(X) + l_blind(X))) *
+//    (zᵢ(ωX) * Πⱼ(p(X) + βsⱼ(X) + γ) - zᵢ(X) * Πⱼ(p(X) + δʲβX + γ))
+template <typename F>
+class PermutationEvaluator {
+ public:
+  constexpr static size_t kTileSize = 64;
+
+  struct Params {
+    // |columns[i]| is the i-th column of the permutation argument and
+    // |cosets[i]| is the corresponding permutation polynomial sᵢ(X).
+    std::vector<absl::Span<const F>> columns;
+    std::vector<absl::Span<const F>> cosets;
+    // |product_cosets[i]| is the grand product polynomial zᵢ(X) of the i-th
+    // set, which covers |chunk_len| columns.
+    std::vector<absl::Span<const F>> product_cosets;
+    size_t chunk_len = 0;
+
+    absl::Span<const F> l_first;
+    absl::Span<const F> l_last;
+    absl::Span<const F> l_active_row;
+
+    F beta;
+    F gamma;
+    F y;
+    F delta;
+    // β * ζ
+    F delta_start;
+    F omega;
+    F current_extended_omega;
+    Rotation last_rotation;
+    int32_t rot_scale = 1;
+    int32_t n = 0;
+  };
+
+  PermutationEvaluator() = default;
+  explicit PermutationEvaluator(Params&& params) : params_(std::move(params)) {
+    CHECK_EQ(params_.columns.size(), params_.cosets.size());
+    CHECK_GT(params_.chunk_len, size_t{0});
+    CHECK_EQ(params_.product_cosets.size(),
+             (params_.columns.size() + params_.chunk_len - 1) /
+                 params_.chunk_len);
+  }
+
+  const Params& params() const { return params_; }
+
+  // Folds the permutation constraints of the rows
+  // [|start|, |start| + |values.size()|) into |values|.
+  void Evaluate(size_t start, absl::Span<F> values) const {
+    if (params_.product_cosets.empty()) return;
+    // βX for the first row of the next tile, where X = ω_ext * ωⁱ.
+    F beta_term = params_.current_extended_omega * params_.omega.Pow(start);
+    for (size_t offset = 0; offset < values.size(); offset += kTileSize) {
+      size_t size = std::min(kTileSize, values.size() - offset);
+      EvaluateTile(start + offset, values.subspan(offset, size), beta_term);
+    }
+  }
+
+ private:
+  using Tile = std::array<F, kTileSize>;
+
+  void EvaluateTile(size_t start, absl::Span<F> values, F& beta_term) const {
+    const Params& p = params_;
+    size_t size = values.size();
+    const absl::Span<const F>& first_product = p.product_cosets.front();
+    const absl::Span<const F>& last_product = p.product_cosets.back();
+
+    for (size_t i = 0; i < size; ++i) {
+      size_t idx = start + i;
+      F& value = values[i];
+
+      // Enforce only for the first set: l_first(X) * (1 - z₀(X)) = 0
+      value *= p.y;
+      value += (F::One() - first_product[idx]) * p.l_first[idx];
+
+      // Enforce only for the last set: l_last(X) * (z_l(X)² - z_l(X)) = 0
+      value *= p.y;
+      value += p.l_last[idx] * (last_product[idx].Square() - last_product[idx]);
+
+      // Except for the first set, enforce:
+      // l_first(X) * (zᵢ(X) - zᵢ₋₁(w⁻¹X)) = 0
+      size_t r_last = p.last_rotation.GetIndex(idx, p.rot_scale, p.n);
+      for (size_t j = 1; j < p.product_cosets.size(); ++j) {
+        value *= p.y;
+        value += p.l_first[idx] *
+                 (p.product_cosets[j][idx] - p.product_cosets[j - 1][r_last]);
+      }
+    }
+
+    // δʲβX for the first column of the current set.
+    Tile current_deltas;
+    for (size_t i = 0; i < size; ++i) {
+      current_deltas[i] = p.delta_start * beta_term;
+      beta_term *= p.omega;
+    }
+
+    // And for all the sets we enforce: (1 - (l_last(X) + l_blind(X))) *
+    // (zᵢ(wX) * Πⱼ(p(X) + βsⱼ(X) + γ) - zᵢ(X) Πⱼ(p(X) + δʲβX + γ))
+    Tile left;
+    Tile right;
+    for (size_t j = 0; j < p.product_cosets.size(); ++j) {
+      const absl::Span<const F>& product = p.product_cosets[j];
+      for (size_t i = 0; i < size; ++i) {
+        size_t idx = start + i;
+        left[i] = product[Rotation::Next().GetIndex(idx, p.rot_scale, p.n)];
+        right[i] = product[idx];
+      }
+
+      size_t from = j * p.chunk_len;
+      size_t to = std::min(from + p.chunk_len, p.columns.size());
+      for (size_t k = from; k < to; ++k) {
+        const F* column = &p.columns[k][start];
+        const F* coset = &p.cosets[k][start];
+        for (size_t i = 0; i < size; ++i) {
+          F column_plus_gamma = column[i] + p.gamma;
+          left[i] *= column_plus_gamma + p.beta * coset[i];
+          right[i] *= column_plus_gamma + current_deltas[i];
+          current_deltas[i] *= p.delta;
+        }
+      }
+
+      for (size_t i = 0; i < size; ++i) {
+        values[i] *= p.y;
+        values[i] += (left[i] - right[i]) * p.l_active_row[start + i];
+      }
+    }
+  }
+
+  Params params_;
+};
+
+}  // namespace tachyon::zk
+
+#endif  // TACHYON_ZK_PLONK_VANISHING_PERMUTATION_EVALUATOR_H_
@@ -0,0 +1,76 @@
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/zk/plonk/vanishing/permutation_evaluator.h"
+
+namespace tachyon::zk {
+
+// Folds the permutation constraints of |state.range(1)| columns into
+// |state.range(0)| rows, which is the permutation contribution to a single
+// extended part of the quotient polynomial. The chunk length 3 matches a
+// constraint system of degree 5.
+template <typename F>
+void BM_PermutationEvaluator(benchmark::State& state) {
+  size_t n = state.range(0);
+  size_t num_columns = state.range(1);
+  size_t chunk_len = 3;
+  auto random_column = [n]() {
+    return base::CreateVector(n, []() { return F::Random(); });
+  };
+  auto random_columns = [&random_column](size_t num_columns) {
+    return base::CreateVector(num_columns, random_column);
+  };
+  auto to_spans = [](const std::vector<std::vector<F>>& columns) {
+    return base::Map(columns, [](const std::vector<F>& column) {
+      return absl::MakeConstSpan(column);
+    });
+  };
+
+  std::vector<std::vector<F>> columns = random_columns(num_columns);
+  std::vector<std::vector<F>> cosets = random_columns(num_columns);
+  std::vector<std::vector<F>> product_cosets =
+      random_columns((num_columns + chunk_len - 1) / chunk_len);
+  std::vector<F> l_first = random_column();
+  std::vector<F> l_last = random_column();
+  std::vector<F> l_active_row = random_column();
+
+  typename PermutationEvaluator<F>::Params params;
+  params.columns = to_spans(columns);
+  params.cosets = to_spans(cosets);
+  params.product_cosets = to_spans(product_cosets);
+  params.chunk_len = chunk_len;
+  params.l_first = absl::MakeConstSpan(l_first);
+  params.l_last = absl::MakeConstSpan(l_last);
+  params.l_active_row = absl::MakeConstSpan(l_active_row);
+  params.beta = F::Random();
+  params.gamma = F::Random();
+  params.y = F::Random();
+  params.delta = F::Random();
+  params.delta_start = F::Random();
+  params.omega = F::Random();
+  params.current_extended_omega = F::Random();
+  params.last_rotation = Rotation(-6);
+  params.n = static_cast<int32_t>(n);
+  PermutationEvaluator<F> evaluator(std::move(params));
+
+  std::vector<F> values = random_column();
+  for (auto _ : state) {
+    base::Parallelize(values, [&evaluator](absl::Span<F> chunk,
+                                           size_t chunk_offset,
+                                           size_t chunk_size) {
+      evaluator.Evaluate(chunk_offset * chunk_size, chunk);
+    });
+  }
+  benchmark::DoNotOptimize(values);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(BM_PermutationEvaluator, math::bn254::Fr)
+    ->ArgsProduct({benchmark::CreateRange(1 << 16, 1 << 20, 4), {4, 16, 64}});
+
+}  // namespace tachyon::zk
@@ -0,0 +1,141 @@
+#include "tachyon/zk/plonk/vanishing/permutation_evaluator.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class PermutationEvaluatorTest : public testing::Test {
+ public:
+  // Not a multiple of |kTileSize| to test the last tile.
+  constexpr static size_t kN = 150;
+  constexpr static size_t kNumColumns = 5;
+  constexpr static size_t kChunkLen = 2;
+
+  static std::vector<F> RandomColumn() {
+    return base::CreateVector(kN, []() { return F::Random(); });
+  }
+
+  static std::vector<std::vector<F>> RandomColumns(size_t num_columns) {
+    return base::CreateVector(num_columns,
+                              []() { return RandomColumn(); });
+  }
+
+  static std::vector<absl::Span<const F>> ToSpans(
+      const std::vector<std::vector<F>>& columns) {
+    return base::Map(columns, [](const std::vector<F>& column) {
+      return absl::MakeConstSpan(column);
+    });
+  }
+
+  void SetUp() override {
+    columns_ = RandomColumns(kNumColumns);
+    cosets_ = RandomColumns(kNumColumns);
+    product_cosets_ =
+        RandomColumns((kNumColumns + kChunkLen - 1) / kChunkLen);
+    l_first_ = RandomColumn();
+    l_last_ = RandomColumn();
+    l_active_row_ = RandomColumn();
+
+    params_.chunk_len = kChunkLen;
+    params_.l_first = absl::MakeConstSpan(l_first_);
+    params_.l_last = absl::MakeConstSpan(l_last_);
+    params_.l_active_row = absl::MakeConstSpan(l_active_row_);
+    params_.beta = F::Random();
+    params_.gamma = F::Random();
+    params_.y = F::Random();
+    params_.delta = F::Random();
+    params_.delta_start = F::Random();
+    params_.omega = F::Random();
+    params_.current_extended_omega = F::Random();
+    params_.last_rotation = Rotation(-4);
+    params_.n = static_cast<int32_t>(kN);
+  }
+
+  PermutationEvaluator<F> CreateEvaluator() const {
+    typename PermutationEvaluator<F>::Params params = params_;
+    params.columns = ToSpans(columns_);
+    params.cosets = ToSpans(cosets_);
+    params.product_cosets = ToSpans(product_cosets_);
+    return PermutationEvaluator<F>(std::move(params));
+  }
+
+  // Evaluates the constraints of the |idx|-th row as written in the halo2
+  // book, one row at a time.
+  F EvaluateRow(size_t idx, F value) const {
+    const auto& p = params_;
+    size_t r_next = Rotation::Next().GetIndex(idx, p.rot_scale, p.n);
+    size_t r_last = p.last_rotation.GetIndex(idx, p.rot_scale, p.n);
+
+    value = value * p.y + (F::One() - product_cosets_.front()[idx]) *
+                              p.l_first[idx];
+    const std::vector<F>& last = product_cosets_.back();
+    value = value * p.y + p.l_last[idx] * (last[idx].Square() - last[idx]);
+    for (size_t j = 1; j < product_cosets_.size(); ++j) {
+      value = value * p.y + p.l_first[idx] * (product_cosets_[j][idx] -
+                                              product_cosets_[j - 1][r_last]);
+    }
+
+    F beta_term = p.current_extended_omega * p.omega.Pow(idx);
+    F current_delta = p.delta_start * beta_term;
+    for (size_t j = 0; j < product_cosets_.size(); ++j) {
+      F left = product_cosets_[j][r_next];
+      F right = product_cosets_[j][idx];
+      for (size_t k = j * kChunkLen;
+           k < std::min((j + 1) * kChunkLen, kNumColumns); ++k) {
+        left *= columns_[k][idx] + p.beta * cosets_[k][idx] + p.gamma;
+        right *= columns_[k][idx] + current_delta + p.gamma;
+        current_delta *= p.delta;
+      }
+      value = value * p.y + (left - right) * p.l_active_row[idx];
+    }
+    return value;
+  }
+
+ protected:
+  std::vector<std::vector<F>> columns_;
+  std::vector<std::vector<F>> cosets_;
+  std::vector<std::vector<F>> product_cosets_;
+  std::vector<F> l_first_;
+  std::vector<F> l_last_;
+  std::vector<F> l_active_row_;
+  typename PermutationEvaluator<F>::Params params_;
+};
+
+}  // namespace
+
+TEST_F(PermutationEvaluatorTest, Evaluate) {
+  PermutationEvaluator<F> evaluator = CreateEvaluator();
+  std::vector<F> initial_values = RandomColumn();
+  std::vector<F> expected = base::CreateVector(
+      kN, [this, &initial_values](size_t i) {
+        return EvaluateRow(i, initial_values[i]);
+      });
+
+  std::vector<F> values = initial_values;
+  evaluator.Evaluate(0, absl::MakeSpan(values));
+  EXPECT_EQ(values, expected);
+
+  // The result doesn't depend on how the rows are split.
+  values = initial_values;
+  size_t boundaries[] = {0, 3, 70, 141, kN};
+  for (size_t i = 0; i < std::size(boundaries) - 1; ++i) {
+    evaluator.Evaluate(boundaries[i],
+                       absl::MakeSpan(values).subspan(
+                           boundaries[i], boundaries[i + 1] - boundaries[i]));
+  }
+  EXPECT_EQ(values, expected);
+}
+
+}  // namespace tachyon::zk
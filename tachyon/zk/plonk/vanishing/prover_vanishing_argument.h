@@ -13,6 +13,7 @@
 
 #include "tachyon/base/parallelize.h"
 #include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/device/buffer_pool.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 #include "tachyon/zk/base/prover_query.h"
 #include "tachyon/zk/plonk/keys/verifying_key.h"
@@ -47,6 +48,9 @@ template <typename PCS>
   return true;
 }
 
+// |circuit_column| is divided by t(X) in place, and then its buffer is returned
+// to |device::BufferPool| as well as the coefficients of h(X). So it is left
+// empty.
 template <typename PCS, typename ExtendedEvals>
 [[nodiscard]] bool CommitFinalHPoly(
     ProverBase<PCS>* prover, VanishingCommitted<PCS>&& committed,
@@ -59,12 +63,14 @@ template <typename PCS, typename ExtendedEvals>
   using ExtendedPoly = typename PCS::ExtendedPoly;
 
   // Divide by t(X) = X^{params.n} - 1.
-  ExtendedEvals h_evals = DivideByVanishingPolyInPlace<F>(
+  ExtendedEvals& h_evals = DivideByVanishingPolyInPlace<F>(
       circuit_column, prover->extended_domain(), prover->domain());
 
   // Obtain final h(X) polynomial
   ExtendedPoly h_poly =
       ExtendedToCoeff<F, ExtendedPoly>(h_evals, prover->extended_domain());
+  device::BufferPool<F>& buffer_pool = device::BufferPool<F>::GetInstance();
+  buffer_pool.Release(std::move(h_evals.evaluations()));
 
   // Truncate it to match the size of the quotient polynomial; the
   // evaluation domain might be slightly larger than necessary because
@@ -74,11 +80,16 @@ template <typename PCS, typename ExtendedEvals>
       vk.constraint_system().ComputeDegree() - 1;
   h_coeffs.resize(prover->pcs().N() * quotient_poly_degree, F::Zero());
 
+  // The pieces are drawn from the pool instead of being allocated and zeroed,
+  // and they are untracked, since they are returned as the polynomials of the
+  // proof.
   auto h_chunks = base::Chunked(h_coeffs, prover->pcs().N());
   std::vector<Poly> h_pieces = base::Map(
-      h_chunks.begin(), h_chunks.end(), [](absl::Span<const F> h_piece) {
-        return Poly(
-            Coeffs(std::move(std::vector<F>(h_piece.begin(), h_piece.end()))));
+      h_chunks.begin(), h_chunks.end(),
+      [&buffer_pool](absl::Span<const F> h_piece) {
+        std::vector<F> coeffs = buffer_pool.AcquireUntracked(h_piece.size());
+        std::copy(h_piece.begin(), h_piece.end(), coeffs.begin());
+        return Poly(Coeffs(std::move(coeffs)));
       });
 
   // Compute commitments to each h(X) piece
@@ -99,6 +110,7 @@ template <typename PCS, typename ExtendedEvals>
       if (!prover->GetWriter()->WriteToProof(commitment)) return false;
     }
   }
+  buffer_pool.Release(std::move(h_coeffs));
 
   // FIXME(TomTaehoonKim): Remove this if possible.
   std::vector<F> h_blinds =
@@ -10,10 +10,12 @@
 #include <stddef.h>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "tachyon/base/logging.h"
 #include "tachyon/export.h"
+#include "tachyon/zk/plonk/vanishing/evaluation_block.h"
 #include "tachyon/zk/plonk/vanishing/evaluation_input.h"
 
 namespace tachyon::zk {
@@ -93,7 +95,8 @@ class TACHYON_EXPORT ValueSource {
       case Type::kFixed:
       case Type::kAdvice:
       case Type::kInstance:
-        return column_index_ == other.rotation_index_;
+        return column_index_ == other.column_index_ &&
+               rotation_index_ == other.rotation_index_;
       case Type::kBeta:
       case Type::kGamma:
       case Type::kTheta:
@@ -104,6 +107,9 @@ class TACHYON_EXPORT ValueSource {
     NOTREACHED();
     return false;
   }
+  bool operator!=(const ValueSource& other) const {
+    return !operator==(other);
+  }
 
   bool operator<=(const ValueSource& other) const {
     if (type_ == other.type_) {
@@ -168,8 +174,74 @@ class TACHYON_EXPORT ValueSource {
     return F();
   }
 
+  // Same as |Get()|, but returns the values of all the rows of |block|.
+  template <typename Poly, typename Evals, typename F>
+  BlockValue<F> GetBlock(const EvaluationInput<Poly, Evals>& data,
+                         const EvaluationBlock<F>& block,
+                         const std::vector<F>& constants) const {
+    switch (type_) {
+      case Type::kConstant:
+        return BlockValue<F>::Scalar(&constants[index_]);
+      case Type::kIntermediate:
+        if (index_ < block.num_invariants()) {
+          return BlockValue<F>::Scalar(&data.intermediates()[index_]);
+        }
+        return BlockValue<F>::Rows(block.GetIntermediates(index_));
+      case Type::kChallenge:
+        return BlockValue<F>::Scalar(&data.challenges()[index_]);
+      case Type::kFixed:
+        return BlockValue<F>::Rows(
+            data.table().fixed_columns()[column_index_]
+                                        [block.rotations()[rotation_index_]]);
+      case Type::kAdvice:
+        return BlockValue<F>::Rows(
+            data.table().advice_columns()[column_index_]
+                                         [block.rotations()[rotation_index_]]);
+      case Type::kInstance:
+        return BlockValue<F>::Rows(
+            data.table()
+                .instance_columns()[column_index_]
+                                   [block.rotations()[rotation_index_]]);
+      case Type::kBeta:
+        return BlockValue<F>::Scalar(&data.beta());
+      case Type::kGamma:
+        return BlockValue<F>::Scalar(&data.gamma());
+      case Type::kTheta:
+        return BlockValue<F>::Scalar(&data.theta());
+      case Type::kY:
+        return BlockValue<F>::Scalar(&data.y());
+      case Type::kPreviousValue:
+        return BlockValue<F>::Rows(block.previous_values().data());
+    }
+    NOTREACHED();
+    return BlockValue<F>();
+  }
+
   std::string ToString() const;
 
+  template <typename H>
+  friend H AbslHashValue(H h, const ValueSource& value) {
+    switch (value.type_) {
+      case Type::kConstant:
+      case Type::kIntermediate:
+      case Type::kChallenge:
+        return H::combine(std::move(h), value.type_, value.index_);
+      case Type::kFixed:
+      case Type::kAdvice:
+      case Type::kInstance:
+        return H::combine(std::move(h), value.type_, value.column_index_,
+                          value.rotation_index_);
+      case Type::kBeta:
+      case Type::kGamma:
+      case Type::kTheta:
+      case Type::kY:
+      case Type::kPreviousValue:
+        return H::combine(std::move(h), value.type_);
+    }
+    NOTREACHED();
+    return h;
+  }
+
  private:
   explicit ValueSource(Type type) : type_(type) {}
   ValueSource(Type type, size_t index) : type_(type), index_(index) {}
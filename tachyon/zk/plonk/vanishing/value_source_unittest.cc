@@ -45,4 +45,14 @@ TEST(ValueSourceTest, IsTwoConstant) {
 
 #undef TEST_CONSTANTS
 
+TEST(ValueSourceTest, Equality) {
+  EXPECT_EQ(ValueSource::Fixed(1, 2), ValueSource::Fixed(1, 2));
+  EXPECT_NE(ValueSource::Fixed(1, 2), ValueSource::Fixed(2, 1));
+  EXPECT_NE(ValueSource::Fixed(1, 2), ValueSource::Fixed(1, 3));
+  EXPECT_NE(ValueSource::Fixed(1, 2), ValueSource::Advice(1, 2));
+  EXPECT_EQ(ValueSource::Intermediate(1), ValueSource::Intermediate(1));
+  EXPECT_NE(ValueSource::Intermediate(1), ValueSource::Constant(1));
+  EXPECT_EQ(ValueSource::Y(), ValueSource::Y());
+}
+
 }  // namespace tachyon::zk
@@ -12,7 +12,12 @@
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
 #include "tachyon/zk/base/entities/prover_base.h"
+#include "tachyon/zk/expressions/evaluator/simplifier.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_committed.h"
+#include "tachyon/zk/lookup/lookup_pair.h"
+#include "tachyon/zk/lookup/lookup_type.h"
 #include "tachyon/zk/plonk/constraint_system.h"
 #include "tachyon/zk/plonk/vanishing/circuit_polynomial_builder.h"
 #include "tachyon/zk/plonk/vanishing/graph_evaluator.h"
@@ -31,39 +36,66 @@ class VanishingArgument {
       const ConstraintSystem<F>& constraint_system) {
     VanishingArgument evaluator;
 
-    std::vector<ValueSource> parts;
+    std::vector<std::unique_ptr<Expression<F>>> polys;
     for (const Gate<F>& gate : constraint_system.gates()) {
-      std::vector<ValueSource> tmp = base::Map(
-          gate.polys(),
-          [&evaluator](const std::unique_ptr<Expression<F>>& expression) {
-            return evaluator.custom_gates_.AddExpression(expression.get());
-          });
-      parts.insert(parts.end(), std::make_move_iterator(tmp.begin()),
-                   std::make_move_iterator(tmp.end()));
+      for (const std::unique_ptr<Expression<F>>& poly : gate.polys()) {
+        polys.push_back(Simplify(poly.get()));
+      }
     }
-    evaluator.custom_gates_.AddCalculation(Calculation::Horner(
-        ValueSource::PreviousValue(), std::move(parts), ValueSource::Y()));
+    evaluator.AddCustomGates(polys);
+    evaluator.custom_gates_.AllocateIntermediates();
+    VLOG(1) << "Custom gates: "
+            << evaluator.custom_gates_.calculations().size()
+            << " calculations per row, "
+            << evaluator.custom_gates_.invariant_calculations().size()
+            << " invariant calculations, "
+            << evaluator.custom_gates_.num_intermediates() << " intermediates";
+
+    auto compress =
+        [](GraphEvaluator<F>& graph,
+           const std::vector<std::unique_ptr<Expression<F>>>& expressions) {
+          std::vector<ValueSource> parts = base::Map(
+              expressions,
+              [&graph](const std::unique_ptr<Expression<F>>& expression) {
+                return graph.AddExpression(Simplify(expression.get()).get());
+              });
+          return graph.AddCalculation(
+              Calculation::Horner(ValueSource::ZeroConstant(),
+                                  std::move(parts), ValueSource::Theta()));
+        };
 
     for (const LookupArgument<F>& lookup : constraint_system.lookups()) {
-      GraphEvaluator<F> graph;
+      if (constraint_system.lookup_type() ==
+          LookupType::kLogDerivativeHalo2) {
+        // The log derivative lookup argument needs the compressed input and
+        // table expressions separately, so that each of them gets a graph.
+        GraphEvaluator<F> input_graph;
+        // A_compressed(X) + β
+        input_graph.AddCalculation(
+            Calculation::Add(compress(input_graph, lookup.input_expressions()),
+                             ValueSource::Beta()));
+        input_graph.AllocateIntermediates();
+
+        GraphEvaluator<F> table_graph;
+        // S_compressed(X) + β
+        table_graph.AddCalculation(
+            Calculation::Add(compress(table_graph, lookup.table_expressions()),
+                             ValueSource::Beta()));
+        table_graph.AllocateIntermediates();
 
-      auto compress =
-          [&graph](
-              const std::vector<std::unique_ptr<Expression<F>>>& expressions) {
-            std::vector<ValueSource> parts = base::Map(
-                expressions,
-                [&graph](const std::unique_ptr<Expression<F>>& expression) {
-                  return graph.AddExpression(expression.get());
-                });
-            return graph.AddCalculation(
-                Calculation::Horner(ValueSource::ZeroConstant(),
-                                    std::move(parts), ValueSource::Theta()));
-          };
+        evaluator.log_derivative_lookups_.emplace_back(std::move(input_graph),
+                                                       std::move(table_graph));
+        continue;
+      }
+
+      GraphEvaluator<F> graph;
 
       // A_compressed(X) = θᵐ⁻¹A₀(X) + θᵐ⁻²A₁(X) + ... + θAₘ₋₂(X) + Aₘ₋₁(X)
-      ValueSource compressed_input_coset = compress(lookup.input_expressions());
+      ValueSource compressed_input_coset =
+          compress(graph, lookup.input_expressions());
       // S_compressed(X) = θᵐ⁻¹S₀(X) + θᵐ⁻²S₁(X) + ... + θSₘ₋₂(X) + Sₘ₋₁(X)
-      ValueSource compressed_table_coset = compress(lookup.table_expressions());
+      ValueSource compressed_table_coset =
+          compress(graph, lookup.table_expressions());
 
       // S_compressed(X) + γ
       ValueSource right = graph.AddCalculation(
@@ -73,6 +105,7 @@ class VanishingArgument {
           Calculation::Add(compressed_input_coset, ValueSource::Beta()));
       // (A_compressed(X) + β) * (S_compressed(X) + γ)
       graph.AddCalculation(Calculation::Mul(left, right));
+      graph.AllocateIntermediates();
 
       evaluator.lookups_.push_back(std::move(graph));
     }
@@ -82,6 +115,10 @@ class VanishingArgument {
 
   const GraphEvaluator<F>& custom_gates() const { return custom_gates_; }
   const std::vector<GraphEvaluator<F>> lookups() const { return lookups_; }
+  const std::vector<LookupPair<GraphEvaluator<F>>>& log_derivative_lookups()
+      const {
+    return log_derivative_lookups_;
+  }
 
   template <typename PCS, typename Poly = typename PCS::Poly,
             typename ExtendedEvals = typename PCS::ExtendedEvals>
@@ -102,14 +139,177 @@ class VanishingArgument {
             prover->domain(), prover->extended_domain(), prover->pcs().N(),
             blinding_factors, cs_degree, &beta, &gamma, &theta, &y, &zeta,
             &challenges, &proving_key, &committed_permutations,
+            &committed_lookups_vec, nullptr, &poly_tables);
+
+    return builder.BuildExtendedCircuitColumn(custom_gates_, lookups_,
+                                              log_derivative_lookups_);
+  }
+
+  // Same as above, but for the constraint system whose lookup type is
+  // |LookupType::kLogDerivativeHalo2|.
+  template <typename PCS, typename Poly = typename PCS::Poly,
+            typename ExtendedEvals = typename PCS::ExtendedEvals>
+  ExtendedEvals BuildExtendedCircuitColumn(
+      ProverBase<PCS>* prover, const ProvingKey<PCS>& proving_key,
+      const F& beta, const F& gamma, const F& theta, const F& y, const F& zeta,
+      const std::vector<F>& challenges,
+      const std::vector<PermutationCommitted<Poly>>& committed_permutations,
+      const std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>&
+          committed_lookups_vec,
+      const std::vector<RefTable<Poly>>& poly_tables) const {
+    size_t blinding_factors = prover->blinder().blinding_factors();
+    size_t cs_degree =
+        proving_key.verifying_key().constraint_system().ComputeDegree();
+
+    CircuitPolynomialBuilder<PCS> builder =
+        CircuitPolynomialBuilder<PCS>::Create(
+            prover->domain(), prover->extended_domain(), prover->pcs().N(),
+            blinding_factors, cs_degree, &beta, &gamma, &theta, &y, &zeta,
+            &challenges, &proving_key, &committed_permutations, nullptr,
             &committed_lookups_vec, &poly_tables);
 
-    return builder.BuildExtendedCircuitColumn(custom_gates_, lookups_);
+    return builder.BuildExtendedCircuitColumn(custom_gates_, lookups_,
+                                              log_derivative_lookups_);
   }
 
  private:
+  static std::unique_ptr<Expression<F>> Simplify(
+      const Expression<F>* expression) {
+    Simplifier<F> simplifier;
+    return expression->Evaluate(&simplifier);
+  }
+
+  // Returns q(X) if |poly| is q(X) * e(X), where q(X) is a fixed column,
+  // which is what a simple selector is compressed into. q(X) may be nested in
+  // the factors of a product, a scaled or a negated expression, e.g.,
+  // c * ((q(X) * a(X)) * b(X)) is q(X) * (c * (a(X) * b(X))). e(X) is stored
+  // to |body|. Otherwise, returns nullptr.
+  static const Expression<F>* GetSelector(
+      const Expression<F>* poly, std::unique_ptr<Expression<F>>* body) {
+    std::unique_ptr<Expression<F>> inner_body;
+    switch (poly->type()) {
+      case ExpressionType::kProduct: {
+        const ProductExpression<F>* product = poly->ToProduct();
+        const Expression<F>* left = product->left();
+        const Expression<F>* right = product->right();
+        if (left->type() == ExpressionType::kFixed) {
+          *body = right->Clone();
+          return left;
+        }
+        if (right->type() == ExpressionType::kFixed) {
+          *body = left->Clone();
+          return right;
+        }
+        if (const Expression<F>* selector = GetSelector(left, &inner_body)) {
+          *body = std::move(inner_body) * right->Clone();
+          return selector;
+        }
+        if (const Expression<F>* selector = GetSelector(right, &inner_body)) {
+          *body = left->Clone() * std::move(inner_body);
+          return selector;
+        }
+        return nullptr;
+      }
+      case ExpressionType::kScaled: {
+        const ScaledExpression<F>* scaled = poly->ToScaled();
+        const Expression<F>* selector =
+            GetSelector(scaled->expr(), &inner_body);
+        if (selector != nullptr) {
+          *body = std::move(inner_body) * scaled->scale();
+        }
+        return selector;
+      }
+      case ExpressionType::kNegated: {
+        const Expression<F>* selector =
+            GetSelector(poly->ToNegated()->expr(), &inner_body);
+        if (selector != nullptr) {
+          *body = -std::move(inner_body);
+        }
+        return selector;
+      }
+      default:
+        return nullptr;
+    }
+  }
+
+  // Adds the following calculations to |custom_gates_|, where n is the number
+  // of |polys| and p is the previous value.
+  //   p * yⁿ + poly₀(X) * yⁿ⁻¹ + ... + polyₙ₋₂(X) * y + polyₙ₋₁(X)
+  // Consecutive polys that share a selector are factored, that is, instead of
+  // q(X) * e₀(X) * y + q(X) * e₁(X), q(X) * (e₀(X) * y + e₁(X)) is computed.
+  void AddCustomGates(
+      const std::vector<std::unique_ptr<Expression<F>>>& polys) {
+    ValueSource value = ValueSource::PreviousValue();
+    std::vector<ValueSource> parts;
+    bool added = false;
+    for (size_t i = 0; i < polys.size();) {
+      std::unique_ptr<Expression<F>> body;
+      const Expression<F>* selector = GetSelector(polys[i].get(), &body);
+      std::vector<std::unique_ptr<Expression<F>>> bodies;
+      bodies.push_back(std::move(body));
+      size_t j = i + 1;
+      if (selector != nullptr) {
+        for (; j < polys.size(); ++j) {
+          std::unique_ptr<Expression<F>> next_body;
+          const Expression<F>* next_selector =
+              GetSelector(polys[j].get(), &next_body);
+          if (next_selector == nullptr || *next_selector != *selector) break;
+          bodies.push_back(std::move(next_body));
+        }
+      }
+      if (bodies.size() == 1) {
+        parts.push_back(custom_gates_.AddExpression(polys[i].get()));
+        i = j;
+        continue;
+      }
+
+      if (!parts.empty()) {
+        value = custom_gates_.AddCalculation(
+            Calculation::Horner(value, std::move(parts), ValueSource::Y()));
+        parts.clear();
+      }
+      std::vector<ValueSource> body_values =
+          base::Map(bodies, [this](const std::unique_ptr<Expression<F>>& body) {
+            return custom_gates_.AddExpression(body.get());
+          });
+      ValueSource factored = body_values[0];
+      body_values.erase(body_values.begin());
+      factored = custom_gates_.AddCalculation(Calculation::Horner(
+          factored, std::move(body_values), ValueSource::Y()));
+      ValueSource selector_value = custom_gates_.AddExpression(selector);
+      if (selector_value <= factored) {
+        factored = custom_gates_.AddCalculation(
+            Calculation::Mul(selector_value, factored));
+      } else {
+        factored = custom_gates_.AddCalculation(
+            Calculation::Mul(factored, selector_value));
+      }
+      value = custom_gates_.AddCalculation(
+          Calculation::Horner(value, {factored}, AddYPower(bodies.size())));
+      added = true;
+      i = j;
+    }
+    if (!parts.empty() || !added) {
+      custom_gates_.AddCalculation(
+          Calculation::Horner(value, std::move(parts), ValueSource::Y()));
+    }
+  }
+
+  // Returns yᵉ, where e is |exponent|.
+  ValueSource AddYPower(size_t exponent) {
+    ValueSource ret = ValueSource::Y();
+    for (size_t i = 1; i < exponent; ++i) {
+      ret = custom_gates_.AddCalculation(
+          Calculation::Mul(ret, ValueSource::Y()));
+    }
+    return ret;
+  }
+
   GraphEvaluator<F> custom_gates_;
   std::vector<GraphEvaluator<F>> lookups_;
+  // The graphs of A_compressed(X) + β and S_compressed(X) + β of each lookup
+  // if the lookup type is |LookupType::kLogDerivativeHalo2|.
+  std::vector<LookupPair<GraphEvaluator<F>>> log_derivative_lookups_;
 };
 
 }  // namespace tachyon::zk
@@ -10,8 +10,13 @@
 
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/verifier_base.h"
+#include "tachyon/zk/expressions/expression_factory.h"
+#include "tachyon/zk/lookup/log_derivative_lookup_committed.h"
+#include "tachyon/zk/lookup/lookup_type.h"
 #include "tachyon/zk/plonk/circuit/examples/simple_circuit.h"
+#include "tachyon/zk/plonk/circuit/examples/simple_lookup_circuit.h"
 #include "tachyon/zk/plonk/circuit/floor_planner/simple_floor_planner.h"
+#include "tachyon/zk/plonk/circuit/owned_table.h"
 #include "tachyon/zk/plonk/constraint_system.h"
 #include "tachyon/zk/plonk/halo2/pinned_verifying_key.h"
 #include "tachyon/zk/plonk/halo2/prover_test.h"
@@ -29,6 +34,101 @@ class VanishingArgumentTest : public halo2::ProverTest {
     return {prover_->domain()->Random<Poly>(), F::Random()};
   }
   Poly GenRandomPoly() const { return prover_->domain()->Random<Poly>(); }
+
+  // Builds the custom gates of |constraint_system| without any optimization.
+  static GraphEvaluator<F> BuildUnoptimizedCustomGates(
+      const ConstraintSystem<F>& constraint_system) {
+    GraphEvaluator<F> evaluator;
+    std::vector<ValueSource> parts;
+    for (const Gate<F>& gate : constraint_system.gates()) {
+      for (const std::unique_ptr<Expression<F>>& poly : gate.polys()) {
+        parts.push_back(evaluator.AddExpression(poly.get()));
+      }
+    }
+    evaluator.AddCalculation(Calculation::Horner(
+        ValueSource::PreviousValue(), std::move(parts), ValueSource::Y()));
+    return evaluator;
+  }
+
+  // Evaluates both of the evaluators on a table of a fixed column and two
+  // advice columns and checks that they agree on every row.
+  void ExpectSameEvaluations(const GraphEvaluator<F>& optimized,
+                             const GraphEvaluator<F>& unoptimized) const {
+    size_t n = prover_->pcs().N();
+    auto random_evals = [n]() {
+      return Evals(base::CreateVector(n, []() { return F::Random(); }));
+    };
+    OwnedTable<Evals> table({random_evals()}, {random_evals(), random_evals()},
+                            {});
+    std::vector<F> challenges;
+    F beta = F::Random();
+    F gamma = F::Random();
+    F theta = F::Random();
+    F y = F::Random();
+    auto create_input = [&](const GraphEvaluator<F>& evaluator) {
+      return EvaluationInput<Poly, Evals>(
+          evaluator.CreateInitialIntermediates(),
+          evaluator.CreateEmptyRotations(), &table, &challenges, &beta, &gamma,
+          &theta, &y, static_cast<int32_t>(n));
+    };
+    EvaluationInput<Poly, Evals> unoptimized_input = create_input(unoptimized);
+    EvaluationInput<Poly, Evals> optimized_input = create_input(optimized);
+    optimized.EvaluateInvariants(optimized_input);
+    for (size_t i = 0; i < n; ++i) {
+      F previous_value = F::Random();
+      EXPECT_EQ(optimized.Evaluate(optimized_input, i, 1, previous_value),
+                unoptimized.Evaluate(unoptimized_input, i, 1, previous_value));
+    }
+  }
+
+  // Configures |Circuit| and compresses its selectors as a key does. Every
+  // selector is enabled on every row, so that each of them ends up in its own
+  // fixed column.
+  template <typename Circuit>
+  static ConstraintSystem<F> CreateConstraintSystem() {
+    ConstraintSystem<F> constraint_system;
+    Circuit::Configure(constraint_system);
+    std::vector<std::vector<bool>> selectors(constraint_system.num_selectors(),
+                                             std::vector<bool>(8, true));
+    constraint_system.CompressSelectors(selectors);
+    return constraint_system;
+  }
+
+  // Checks the number of the calculations and the intermediates of the
+  // custom gates of |Circuit| before and after the optimization. The
+  // calculations after the optimization include the invariant ones.
+  template <typename Circuit>
+  static void ExpectCalculationCounts(size_t unoptimized_calculations,
+                                      size_t unoptimized_intermediates,
+                                      size_t optimized_calculations,
+                                      size_t optimized_intermediates) {
+    ConstraintSystem<F> constraint_system = CreateConstraintSystem<Circuit>();
+    GraphEvaluator<F> unoptimized =
+        BuildUnoptimizedCustomGates(constraint_system);
+    VanishingArgument<F> vanishing_argument =
+        VanishingArgument<F>::Create(constraint_system);
+    const GraphEvaluator<F>& optimized = vanishing_argument.custom_gates();
+    EXPECT_EQ(unoptimized.calculations().size(), unoptimized_calculations);
+    EXPECT_EQ(unoptimized.num_intermediates(), unoptimized_intermediates);
+    EXPECT_EQ(optimized.calculations().size() +
+                  optimized.invariant_calculations().size(),
+              optimized_calculations);
+    EXPECT_EQ(optimized.num_intermediates(), optimized_intermediates);
+  }
+};
+
+// Same as |SimpleLookupCircuit|, but its lookup is proven with the log
+// derivative lookup argument.
+template <typename F>
+class SimpleLogDerivativeLookupCircuit
+    : public SimpleLookupCircuit<F, 3, SimpleFloorPlanner> {
+ public:
+  using SimpleLookupCircuit<F, 3, SimpleFloorPlanner>::SimpleLookupCircuit;
+
+  static SimpleLookupConfig<F, 3> Configure(ConstraintSystem<F>& meta) {
+    meta.set_lookup_type(LookupType::kLogDerivativeHalo2);
+    return SimpleLookupCircuit<F, 3, SimpleFloorPlanner>::Configure(meta);
+  }
 };
 
 }  // namespace
@@ -84,6 +184,166 @@ TEST_F(VanishingArgumentTest, BuildExtendedCircuitColumn) {
   EXPECT_FALSE(circuit_column.IsZero());
 }
 
+TEST_F(VanishingArgumentTest, BuildLogDerivativeExtendedCircuitColumn) {
+  SimpleLogDerivativeLookupCircuit<F> circuit(4);
+
+  ProvingKey<PCS> pkey;
+  ASSERT_TRUE(pkey.Load(prover_.get(), circuit));
+  const ConstraintSystem<F>& constraint_system =
+      pkey.verifying_key().constraint_system();
+  ASSERT_EQ(constraint_system.lookups().size(), size_t{1});
+
+  std::vector<Poly> advice_columns = {GenRandomPoly()};
+  std::vector<Poly> fixed_columns =
+      base::CreateVector(constraint_system.num_fixed_columns(),
+                         [this]() { return GenRandomPoly(); });
+  RefTable<Poly> table(absl::MakeConstSpan(fixed_columns),
+                       absl::MakeConstSpan(advice_columns),
+                       absl::Span<const Poly>());
+  std::vector<RefTable<Poly>> poly_tables = {table};
+
+  std::vector<F> challenges;
+  F y = F::Random();
+  F beta = F::Random();
+  F gamma = F::Random();
+  F theta = F::Random();
+  F zeta = GetZeta<F>();
+
+  size_t cs_degree = constraint_system.ComputeDegree();
+  std::vector<PermutationCommitted<Poly>> committed_permutations =
+      base::CreateVector(1, [this, cs_degree]() {
+        std::vector<BlindedPolynomial<Poly>> product_polys =
+            base::CreateVector(cs_degree - 2, GenRandomBlindedPoly());
+        return PermutationCommitted<Poly>(std::move(product_polys));
+      });
+
+  // The second running sum is φ(X) + c.
+  F c = F::Random();
+  BlindedPolynomial<Poly> multiplicities_poly = GenRandomBlindedPoly();
+  BlindedPolynomial<Poly> grand_sum_poly = GenRandomBlindedPoly();
+  Poly shifted_poly = grand_sum_poly.poly();
+  *shifted_poly[0] += c;
+  BlindedPolynomial<Poly> shifted_grand_sum_poly(std::move(shifted_poly),
+                                                 grand_sum_poly.blind());
+
+  VanishingArgument<F> vanishing_argument =
+      VanishingArgument<F>::Create(constraint_system);
+  auto build = [&](const BlindedPolynomial<Poly>& grand_sum_poly) {
+    std::vector<std::vector<LogDerivativeLookupCommitted<Poly>>>
+        committed_lookups_vec(1);
+    committed_lookups_vec[0].emplace_back(
+        BlindedPolynomial<Poly>(multiplicities_poly),
+        BlindedPolynomial<Poly>(grand_sum_poly));
+    return vanishing_argument.BuildExtendedCircuitColumn(
+        prover_.get(), pkey, beta, gamma, theta, y, zeta, challenges,
+        committed_permutations, committed_lookups_vec, poly_tables);
+  };
+  ExtendedEvals circuit_column = build(grand_sum_poly);
+  ExtendedEvals shifted_circuit_column = build(shifted_grand_sum_poly);
+  EXPECT_FALSE(circuit_column.IsZero());
+
+  // The lookup is folded into the column last with the following
+  // expressions:
+  //
+  //   l_first(X) * φ(X), l_last(X) * φ(X) and
+  //   l_active_row(X) * ((φ(ωX) - φ(X)) * (A(X) + β) * (S(X) + β) -
+  //                      (S(X) + β) + m(X) * (A(X) + β)).
+  //
+  // Only the first two change with φ(X) + c, so the columns differ by
+  // c * (y² * l_first(X) + y * l_last(X)) at ζωₑᵏ, where ωₑ is the generator
+  // of the extended domain.
+  const ExtendedDomain* extended_domain = prover_->extended_domain();
+  for (size_t k = 0; k < extended_domain->size(); ++k) {
+    F point = zeta * extended_domain->GetElement(k);
+    F expected = c * (y.Square() * pkey.l_first().Evaluate(point) +
+                      y * pkey.l_last().Evaluate(point));
+    EXPECT_EQ(*shifted_circuit_column[k] - *circuit_column[k], expected);
+  }
+}
+
+TEST_F(VanishingArgumentTest, OptimizeCustomGates) {
+  ConstraintSystem<F> constraint_system;
+  FixedColumnKey q = constraint_system.CreateFixedColumn();
+  AdviceColumnKey a = constraint_system.CreateAdviceColumn();
+  AdviceColumnKey b = constraint_system.CreateAdviceColumn();
+  constraint_system.CreateGate("gate", [q, a, b](VirtualCells<F>& meta) {
+    std::vector<Constraint<F>> constraints;
+    // q(X) * (a(X) * b(X) - a(ωX))
+    constraints.emplace_back(meta.QueryFixed(q, Rotation::Cur()) *
+                             (meta.QueryAdvice(a, Rotation::Cur()) *
+                                  meta.QueryAdvice(b, Rotation::Cur()) -
+                              meta.QueryAdvice(a, Rotation::Next())));
+    // q(X) * (3 * (a(X) * b(X)) + 2 * b(X))
+    constraints.emplace_back(
+        meta.QueryFixed(q, Rotation::Cur()) *
+        (ExpressionFactory<F>::Constant(F(3)) *
+             (meta.QueryAdvice(a, Rotation::Cur()) *
+              meta.QueryAdvice(b, Rotation::Cur())) +
+         ExpressionFactory<F>::Constant(F(2)) *
+             meta.QueryAdvice(b, Rotation::Cur())));
+    // q(X) * a(X) + q(X) * (b(X) * 1)
+    constraints.emplace_back(meta.QueryFixed(q, Rotation::Cur()) *
+                                 meta.QueryAdvice(a, Rotation::Cur()) +
+                             meta.QueryFixed(q, Rotation::Cur()) *
+                                 (meta.QueryAdvice(b, Rotation::Cur()) *
+                                  ExpressionFactory<F>::Constant(F::One())));
+    return constraints;
+  });
+
+  GraphEvaluator<F> unoptimized =
+      BuildUnoptimizedCustomGates(constraint_system);
+  VanishingArgument<F> vanishing_argument =
+      VanishingArgument<F>::Create(constraint_system);
+  const GraphEvaluator<F>& optimized = vanishing_argument.custom_gates();
+  EXPECT_LT(optimized.calculations().size(), unoptimized.calculations().size());
+  EXPECT_LT(optimized.num_intermediates(), unoptimized.num_intermediates());
+  ExpectSameEvaluations(optimized, unoptimized);
+}
+
+TEST_F(VanishingArgumentTest, FactorNestedSelectors) {
+  ConstraintSystem<F> constraint_system;
+  FixedColumnKey q = constraint_system.CreateFixedColumn();
+  AdviceColumnKey a = constraint_system.CreateAdviceColumn();
+  AdviceColumnKey b = constraint_system.CreateAdviceColumn();
+  constraint_system.CreateGate("gate", [q, a, b](VirtualCells<F>& meta) {
+    std::vector<Constraint<F>> constraints;
+    // q(X) * (a(X) - b(X))
+    constraints.emplace_back(meta.QueryFixed(q, Rotation::Cur()) *
+                             (meta.QueryAdvice(a, Rotation::Cur()) -
+                              meta.QueryAdvice(b, Rotation::Cur())));
+    // (q(X) * a(ωX)) * 3
+    constraints.emplace_back((meta.QueryFixed(q, Rotation::Cur()) *
+                              meta.QueryAdvice(a, Rotation::Next())) *
+                             F(3));
+    // -(a(X) * (q(X) * b(ωX)))
+    constraints.emplace_back(-(meta.QueryAdvice(a, Rotation::Cur()) *
+                               (meta.QueryFixed(q, Rotation::Cur()) *
+                                meta.QueryAdvice(b, Rotation::Next()))));
+    return constraints;
+  });
+
+  GraphEvaluator<F> unoptimized =
+      BuildUnoptimizedCustomGates(constraint_system);
+  VanishingArgument<F> vanishing_argument =
+      VanishingArgument<F>::Create(constraint_system);
+  const GraphEvaluator<F>& optimized = vanishing_argument.custom_gates();
+  // q(X) is multiplied once instead of three times. If the scaled and the
+  // negated polys weren't recognized, there would be 13 calculations per row
+  // as many as the unoptimized one.
+  EXPECT_EQ(unoptimized.calculations().size(), size_t{13});
+  EXPECT_EQ(optimized.calculations().size(), size_t{12});
+  EXPECT_EQ(optimized.invariant_calculations().size(), size_t{2});
+  ExpectSameEvaluations(optimized, unoptimized);
+}
+
+TEST_F(VanishingArgumentTest, CalculationCountsOfExampleCircuits) {
+  // The example circuits have a gate per selector, so there is nothing to
+  // factor, but the registers of the intermediates are reused.
+  ExpectCalculationCounts<SimpleCircuit<F, SimpleFloorPlanner>>(8, 8, 8, 4);
+  ExpectCalculationCounts<SimpleLookupCircuit<F, 3, SimpleFloorPlanner>>(1, 1,
+                                                                         1, 1);
+}
+
 TEST_F(VanishingArgumentTest, VanishingArgument) {
   VanishingCommitted<PCS> committed_p;
   ASSERT_TRUE(CommitRandomPoly(prover_.get(), &committed_p));
@@ -7,12 +7,15 @@
 #ifndef TACHYON_ZK_PLONK_VANISHING_VANISHING_UTILS_H_
 #define TACHYON_ZK_PLONK_VANISHING_VANISHING_UTILS_H_
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/parallelize.h"
+#include "tachyon/device/buffer_pool.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/entities/prover_base.h"
 
@@ -159,21 +162,41 @@ ExtendedPoly ExtendedToCoeff(const ExtendedEvals& evals,
 
 template <typename Domain, typename Poly, typename F,
           typename Evals = typename Domain::Evals>
-Evals CoeffToExtendedPart(const Domain* domain,
-                          const BlindedPolynomial<Poly>& poly, const F& zeta,
+Evals CoeffToExtendedPart(const Domain* domain, const Poly& poly, const F& zeta,
                           const F& extended_omega_factor) {
-  Poly cloned = poly.poly();
+  using Coefficients = typename Poly::Coefficients;
+
+  // The clone is only alive during the FFT, so it is recycled through
+  // |device::BufferPool| as well as the evaluations that the FFT returns.
+  device::BufferPool<F>& buffer_pool = device::BufferPool<F>::GetInstance();
+  const std::vector<F>& coeffs = poly.coefficients().coefficients();
+  std::vector<F> cloned_coeffs = buffer_pool.Acquire(coeffs.size());
+  std::copy(coeffs.begin(), coeffs.end(), cloned_coeffs.begin());
+  Poly cloned(Coefficients(std::move(cloned_coeffs)));
   Domain::DistributePowers(cloned, zeta * extended_omega_factor);
-  return domain->FFT(cloned);
+  Evals evals = domain->FFT(cloned);
+  buffer_pool.Release(std::move(cloned.coefficients().coefficients()));
+  return evals;
 }
 
 template <typename Domain, typename Poly, typename F,
           typename Evals = typename Domain::Evals>
-Evals CoeffToExtendedPart(const Domain* domain, const Poly& poly, const F& zeta,
+Evals CoeffToExtendedPart(const Domain* domain,
+                          const BlindedPolynomial<Poly>& poly, const F& zeta,
                           const F& extended_omega_factor) {
-  Poly cloned = poly;
-  Domain::DistributePowers(cloned, zeta * extended_omega_factor);
-  return domain->FFT(cloned);
+  return CoeffToExtendedPart(domain, poly.poly(), zeta, extended_omega_factor);
+}
+
+// Returns the buffers of |evals_vec| to |device::BufferPool| and clears it.
+template <typename Evals>
+void ReleaseToBufferPool(std::vector<Evals>& evals_vec) {
+  using F = typename Evals::Field;
+
+  device::BufferPool<F>& buffer_pool = device::BufferPool<F>::GetInstance();
+  for (Evals& evals : evals_vec) {
+    buffer_pool.Release(std::move(evals.evaluations()));
+  }
+  evals_vec.clear();
 }
 
 template <typename Domain, typename Poly, typename F,
@@ -187,6 +210,135 @@ std::vector<Evals> CoeffsToExtendedPart(const Domain* domain,
       });
 }
 
+// The following build the Lagrange basis polynomials of the proving key
+// without an IFFT. Lᵢ(X) is the polynomial that evaluates to 1 at ωⁱ and 0
+// elsewhere over the domain of size n:
+//
+//   Lᵢ(X) = (1 / n) * Σⱼ (ω⁻ⁱX)ʲ = ωⁱ(Xⁿ - 1) / (n(X - ωⁱ))
+//
+// So the j-th coefficient of Lᵢ(X) is ω⁻ⁱʲ / n, and Lᵢ(X) = L₀(ω⁻ⁱX).
+
+// Returns l_first(X) = L₀(X), whose coefficients are all 1 / n.
+template <typename Domain, typename Poly = typename Domain::DensePoly>
+Poly BuildLFirst(const Domain* domain) {
+  using Coefficients = typename Poly::Coefficients;
+
+  return Poly(
+      Coefficients(base::CreateVector(domain->size(), domain->size_inv())));
+}
+
+// Returns l_last(X) = Lᵤ(X), where u is |usable_rows|.
+template <typename Domain, typename Poly = typename Domain::DensePoly>
+Poly BuildLLast(const Domain* domain, size_t usable_rows) {
+  using F = typename Poly::Field;
+  using Coefficients = typename Poly::Coefficients;
+
+  // [1 / n, ω⁻ᵘ / n, ω⁻²ᵘ / n, ...]
+  return Poly(Coefficients(F::GetSuccessivePowers(
+      domain->size(), domain->group_gen_inv().Pow(usable_rows),
+      domain->size_inv())));
+}
+
+// Returns l_active_row(X) = Σ_{i < u} Lᵢ(X), where u is |usable_rows|. Since
+// Σᵢ Lᵢ(X) = 1, this is 1 - Σ_{u ≤ i < n} Lᵢ(X), whose j-th coefficient is
+// δⱼ₀ - ω⁻ᵘʲ / n * (1 + ω⁻ʲ + ... + ω⁻⁽ⁿ⁻ᵘ⁻¹⁾ʲ). There are only as many terms
+// in the sum as the blinding rows.
+template <typename Domain, typename Poly = typename Domain::DensePoly>
+Poly BuildLActiveRow(const Domain* domain, size_t usable_rows) {
+  using F = typename Poly::Field;
+  using Coefficients = typename Poly::Coefficients;
+
+  CHECK_LT(usable_rows, domain->size());
+  size_t num_terms = domain->size() - usable_rows;
+  std::vector<F> coeffs =
+      std::move(BuildLLast(domain, usable_rows).coefficients().coefficients());
+  const F& omega_inv = domain->group_gen_inv();
+  base::Parallelize(coeffs, [num_terms, &omega_inv](absl::Span<F> chunk,
+                                                    size_t chunk_idx,
+                                                    size_t chunk_size) {
+    F omega_inv_pow = omega_inv.Pow(chunk_idx * chunk_size);
+    for (F& coeff : chunk) {
+      F sum = F::One();
+      for (size_t k = 1; k < num_terms; ++k) {
+        sum *= omega_inv_pow;
+        sum += F::One();
+      }
+      coeff *= sum;
+      coeff.NegInPlace();
+      omega_inv_pow *= omega_inv;
+    }
+  });
+  coeffs[0] += F::One();
+  return Poly(Coefficients(std::move(coeffs)));
+}
+
+// Returns the evaluations of l_first(X) over the extended part, which
+// |CoeffToExtendedPart()| computes, without an FFT. The part is evaluated at
+// xⱼ = cωʲ, where c = ζ * |extended_omega_factor|, so xⱼⁿ = cⁿ and
+//
+//   l_first(xⱼ) = (cⁿ - 1) / (n(cωʲ - 1)).
+template <typename Domain, typename F, typename Evals = typename Domain::Evals>
+Evals BuildLFirstExtendedPart(const Domain* domain, const F& zeta,
+                              const F& extended_omega_factor) {
+  F c = zeta * extended_omega_factor;
+  std::vector<F> evals =
+      F::GetSuccessivePowers(domain->size(), domain->group_gen(), c);
+  base::Parallelize(evals, [](absl::Span<F> chunk) {
+    for (F& eval : chunk) {
+      eval -= F::One();
+    }
+  });
+  F::BatchInverseInPlace(evals);
+  F factor = (c.Pow(domain->size()) - F::One()) * domain->size_inv();
+  base::Parallelize(evals, [&factor](absl::Span<F> chunk) {
+    for (F& eval : chunk) {
+      eval *= factor;
+    }
+  });
+  return Evals(std::move(evals));
+}
+
+// Returns the evaluations of l_last(X) over the extended part from the ones of
+// l_first(X). Since Lᵤ(xⱼ) = L₀(ω⁻ᵘxⱼ) = L₀(xⱼ₋ᵤ), this is |l_first| rotated
+// by |usable_rows|.
+template <typename Evals>
+Evals BuildLLastExtendedPart(const Evals& l_first, size_t usable_rows) {
+  const std::vector<typename Evals::Field>& src = l_first.evaluations();
+  size_t n = src.size();
+  CHECK_LT(usable_rows, n);
+  std::vector<typename Evals::Field> evals;
+  evals.reserve(n);
+  evals.insert(evals.end(), src.end() - usable_rows, src.end());
+  evals.insert(evals.end(), src.begin(), src.end() - usable_rows);
+  return Evals(std::move(evals));
+}
+
+// Returns the evaluations of l_active_row(X) over the extended part from the
+// ones of l_first(X), that is, 1 - Σ_{u ≤ i < n} L₀(xⱼ₋ᵢ).
+template <typename Evals>
+Evals BuildLActiveRowExtendedPart(const Evals& l_first, size_t usable_rows) {
+  using F = typename Evals::Field;
+
+  const std::vector<F>& src = l_first.evaluations();
+  size_t n = src.size();
+  CHECK_LT(usable_rows, n);
+  std::vector<F> evals(n);
+  base::Parallelize(evals, [&src, n, usable_rows](absl::Span<F> chunk,
+                                                  size_t chunk_idx,
+                                                  size_t chunk_size) {
+    size_t j = chunk_idx * chunk_size;
+    for (F& eval : chunk) {
+      eval = F::One();
+      // xⱼ₋ᵢ = xⱼ₊ₖ, where k = n - i.
+      for (size_t k = 1; k <= n - usable_rows; ++k) {
+        eval -= src[(j + k) % n];
+      }
+      ++j;
+    }
+  });
+  return Evals(std::move(evals));
+}
+
 template <typename F>
 std::vector<F> BuildExtendedColumnWithColumns(
     std::vector<std::vector<F>>&& columns) {
@@ -194,24 +346,20 @@ std::vector<F> BuildExtendedColumnWithColumns(
   size_t cols = columns.size();
   size_t rows = columns[0].size();
 
-  std::vector<std::vector<F>> transposed = base::CreateVector(
-      rows, [cols]() { return base::CreateVector(cols, F::Zero()); });
-  for (size_t i = 0; i < columns.size(); ++i) {
-    base::Parallelize(transposed, [i, &src_column = columns[i]](
-                                      absl::Span<std::vector<F>> dst_columns,
-                                      size_t chunk_idx, size_t chunk_size) {
-      size_t start = chunk_idx * chunk_size;
-      for (size_t j = 0; j < dst_columns.size(); ++j) {
-        dst_columns[j][i] = src_column[start + j];
-      }
-    });
-  }
-  std::vector<F> flattened_columns;
-  flattened_columns.reserve(cols * rows);
-  for (std::vector<F>& column : transposed) {
-    flattened_columns.insert(flattened_columns.end(),
-                             std::make_move_iterator(column.begin()),
-                             std::make_move_iterator(column.end()));
+  // The i-th element of the j-th column is moved to the (j * |cols| + i)-th.
+  device::BufferPool<F>& buffer_pool = device::BufferPool<F>::GetInstance();
+  std::vector<F> flattened_columns = buffer_pool.Acquire(cols * rows);
+  base::Parallelize(flattened_columns,
+                    [cols, &columns](absl::Span<F> chunk, size_t chunk_idx,
+                                     size_t chunk_size) {
+                      size_t start = chunk_idx * chunk_size;
+                      for (size_t i = 0; i < chunk.size(); ++i) {
+                        size_t idx = start + i;
+                        chunk[i] = std::move(columns[idx % cols][idx / cols]);
+                      }
+                    });
+  for (std::vector<F>& column : columns) {
+    buffer_pool.Release(std::move(column));
   }
   return flattened_columns;
 }
@@ -0,0 +1,61 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/device/buffer_pool.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+#include "tachyon/zk/plonk/vanishing/vanishing_utils.h"
+
+namespace tachyon::zk {
+
+// Extends |state.range(1)| polynomials of |state.range(0)| coefficients to a
+// coset and returns the cosets to |device::BufferPool|, as the quotient
+// polynomial of a proof does for each extended part. The counters report the
+// pool over all the iterations:
+// - |allocs_per_iter|: the buffers allocated rather than recycled per
+//   iteration. Only the first iteration allocates, so this approaches 0.
+// - |peak_reserved_MiB|: the high-water mark of the memory held by the pool.
+// - |in_use_MiB|: the memory acquired and not released at the end, which
+//   must be 0.
+template <typename F>
+void BM_CoeffsToExtendedPart(benchmark::State& state) {
+  constexpr size_t kMaxDegree = (size_t{1} << 22) - 1;
+  using Domain = math::UnivariateEvaluationDomain<F, kMaxDegree>;
+  using Poly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  F::Init();
+  size_t n = state.range(0);
+  std::unique_ptr<Domain> domain =
+      math::Radix2EvaluationDomain<F, kMaxDegree>::Create(n);
+  std::vector<Poly> polys = base::CreateVector(
+      state.range(1), [n]() { return Poly::Random(n - 1); });
+  F zeta = F::Random();
+  F extended_omega_factor = F::Random();
+
+  device::BufferPool<F>& buffer_pool = device::BufferPool<F>::GetInstance();
+  buffer_pool.Clear();
+  buffer_pool.ClearStats();
+  for (auto _ : state) {
+    std::vector<Evals> cosets = CoeffsToExtendedPart<Domain>(
+        domain.get(), absl::MakeSpan(polys), zeta, extended_omega_factor);
+    benchmark::DoNotOptimize(cosets);
+    ReleaseToBufferPool(cosets);
+  }
+
+  device::AllocatorStats stats = buffer_pool.GetStats();
+  constexpr double kMiB = 1 << 20;
+  state.counters["allocs_per_iter"] = benchmark::Counter(
+      stats.num_allocs, benchmark::Counter::kAvgIterations);
+  state.counters["peak_reserved_MiB"] = stats.peak_bytes_reserved / kMiB;
+  state.counters["in_use_MiB"] = stats.bytes_in_use / kMiB;
+}
+
+BENCHMARK_TEMPLATE(BM_CoeffsToExtendedPart, math::bn254::Fr)
+    ->ArgsProduct({benchmark::CreateRange(1 << 16, 1 << 20, 4), {4, 16}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace tachyon::zk
@@ -64,6 +64,46 @@ TEST_F(VanishingUtilsTest, CoeffToExtendedPart) {
   EXPECT_EQ(extended_part, domain->FFT(expected_poly));
 }
 
+TEST_F(VanishingUtilsTest, BuildLagrangePolys) {
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  size_t usable_rows = N - 4;
+
+  Evals evals = domain->template Empty<Evals>();
+  *evals[0] = F::One();
+  EXPECT_EQ(BuildLFirst(domain.get()), domain->IFFT(evals));
+  *evals[0] = F::Zero();
+
+  *evals[usable_rows] = F::One();
+  EXPECT_EQ(BuildLLast(domain.get(), usable_rows), domain->IFFT(evals));
+  *evals[usable_rows] = F::Zero();
+
+  for (size_t i = 0; i < usable_rows; ++i) {
+    *evals[i] = F::One();
+  }
+  EXPECT_EQ(BuildLActiveRow(domain.get(), usable_rows), domain->IFFT(evals));
+}
+
+TEST_F(VanishingUtilsTest, BuildLagrangeExtendedParts) {
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  size_t usable_rows = N - 4;
+
+  F zeta = GetHalo2Zeta<F>();
+  F extended_omega_factor = F::Random();
+  Evals l_first =
+      BuildLFirstExtendedPart(domain.get(), zeta, extended_omega_factor);
+  EXPECT_EQ(l_first,
+            CoeffToExtendedPart(domain.get(), BuildLFirst(domain.get()), zeta,
+                                extended_omega_factor));
+  EXPECT_EQ(BuildLLastExtendedPart(l_first, usable_rows),
+            CoeffToExtendedPart(domain.get(),
+                                BuildLLast(domain.get(), usable_rows), zeta,
+                                extended_omega_factor));
+  EXPECT_EQ(BuildLActiveRowExtendedPart(l_first, usable_rows),
+            CoeffToExtendedPart(domain.get(),
+                                BuildLActiveRow(domain.get(), usable_rows),
+                                zeta, extended_omega_factor));
+}
+
 TEST_F(VanishingUtilsTest, BuildExtendedColumnWithColumns) {
   base::Range<size_t> range = base::Range<size_t>::Until(4);
   std::vector<std::vector<F>> columns =